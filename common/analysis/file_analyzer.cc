@@ -20,6 +20,7 @@
 #include <ostream>
 #include <sstream>  // IWYU pragma: keep  // for ostringstream
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -29,6 +30,7 @@
 #include "common/parser/parse.h"
 #include "common/strings/line_column_map.h"
 #include "common/text/concrete_syntax_tree.h"
+#include "common/text/symbol_arena.h"
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
 #include "common/text/token_stream_view.h"
@@ -97,9 +99,34 @@ absl::Status FileAnalyzer::Tokenize(Lexer *lexer) {
   return absl::OkStatus();
 }
 
+absl::Status FileAnalyzer::Tokenize(TokenSequence tokens,
+                                   const absl::Status &lex_status) {
+  MutableData().MutableTokenStream() = std::move(tokens);
+  if (!lex_status.ok()) {
+    const TokenSequence &lexed = Data().TokenStream();
+    if (!lexed.empty()) {
+      rejected_tokens_.push_back(
+          RejectedToken{lexed.back(), AnalysisPhase::kLexPhase,
+                        "" /* no detailed explanation */});
+    }
+    return lex_status;
+  }
+
+  MutableData().CalculateFirstTokensPerLine();
+  InitTokenStreamView(Data().TokenStream(),
+                      &MutableData().MutableTokenStreamView());
+  return absl::OkStatus();
+}
+
 // Runs the parser on the current TokenStreamView.
 absl::Status FileAnalyzer::Parse(Parser *parser) {
-  absl::Status status = parser->Parse();
+  absl::Status status;
+  {
+    // Allocate all syntax tree symbols of this file in one arena, which is
+    // released at once when the tree is gone.
+    const SymbolArena::Scope arena_scope;
+    status = parser->Parse();
+  }
   // Transfer syntax tree root, even if there were (recovered) syntax errors,
   // because the partial tree can still be useful to analyze.
   MutableData().MutableSyntaxTree() = parser->TakeRoot();
@@ -52,6 +52,7 @@
 #include "common/parser/parse.h"
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
+#include "common/text/token_stream_view.h"
 #include "common/util/logging.h"
 
 namespace verible {
@@ -105,6 +106,12 @@ class FileAnalyzer {
   // Break file contents (string) into tokens.
   absl::Status Tokenize(Lexer *lexer);
 
+  // Use tokens of the file contents that have been lexed elsewhere, e.g.
+  // incrementally from a previous version. The tokens have to point into this
+  // file's contents and end with EOF, unless "lex_status" reports an error;
+  // then the last token is the offending one.
+  absl::Status Tokenize(TokenSequence tokens, const absl::Status &lex_status);
+
   // Construct ConcreteSyntaxTree from TokenStreamView.
   absl::Status Parse(Parser *parser);
 
@@ -22,6 +22,7 @@
 #include <cstddef>
 
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule.h"
 
 namespace verible {
@@ -33,6 +34,14 @@ class LineLintRule : public LintRule {
   // Scans a single line during analysis.
   virtual void HandleLine(absl::string_view line) = 0;
 
+  // Same as HandleLine(), with the byte-level facts about the line already
+  // gathered by ScanLines(). Rules that only need these facts should override
+  // this, to avoid scanning the line again.
+  virtual void HandleScannedLine(absl::string_view line,
+                                 const LineScan &scan) {
+    HandleLine(line);
+  }
+
   // Analyze the final state of the rule, after the last line has been read.
   virtual void Finalize() {}
 };
@@ -14,11 +14,14 @@
 
 #include "common/analysis/line_linter.h"
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_lint_rule.h"
+#include "common/analysis/line_scanner.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/util/logging.h"
 
@@ -27,12 +30,26 @@ namespace verible {
 void LineLinter::Lint(const std::vector<absl::string_view> &lines) {
   VLOG(1) << "LineLinter analyzing lines with " << rules_.size() << " rules.";
   for (const auto &line : lines) {
-    for (const auto &rule : rules_) {
-      ABSL_DIE_IF_NULL(rule)->HandleLine(line);
-    }
+    HandleLine(line);
   }
-  for (const auto &rule : rules_) {
-    rule->Finalize();
+  Finalize();
+}
+
+void LineLinter::HandleLine(absl::string_view line) {
+  HandleLine(line, ScanLine(line));
+}
+
+void LineLinter::HandleLine(absl::string_view line, const LineScan &scan) {
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    LineLintRule *const r = ABSL_DIE_IF_NULL(rules_[i]).get();
+    timer_.Time(i, [&]() { r->HandleScannedLine(line, scan); });
+  }
+}
+
+void LineLinter::Finalize() {
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    LineLintRule *const r = rules_[i].get();
+    timer_.Time(i, [r]() { r->Finalize(); });
   }
 }
 
@@ -45,4 +62,19 @@ std::vector<LintRuleStatus> LineLinter::ReportStatus() const {
   return status;
 }
 
+size_t LineLinter::ViolationCount() const {
+  size_t count = 0;
+  for (const auto &rule : rules_) count += rule->ViolationCount();
+  return count;
+}
+
+std::vector<LintTiming> LineLinter::RuleTimings() const {
+  std::vector<LintTiming> timings;
+  timings.reserve(rules_.size());
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    timings.push_back(timer_.Get(i));
+  }
+  return timings;
+}
+
 }  // namespace verible
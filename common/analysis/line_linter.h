@@ -19,12 +19,15 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_LINE_LINTER_H_
 #define VERIBLE_COMMON_ANALYSIS_LINE_LINTER_H_
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_lint_rule.h"
+#include "common/analysis/line_scanner.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 
 namespace verible {
@@ -34,6 +37,17 @@ class LineLinter {
   // Analyzes a sequence of lines.
   void Lint(const std::vector<absl::string_view> &lines);
 
+  // Analyzes a single line. Lint() is the same as calling this on every line
+  // in order, followed by Finalize(), which lets callers interleave it with
+  // other passes.
+  void HandleLine(absl::string_view line);
+
+  // Same as HandleLine(line), with 'scan' already computed for it.
+  void HandleLine(absl::string_view line, const LineScan &scan);
+
+  // Lets the rules conclude their analysis after the last line.
+  void Finalize();
+
   // Transfers ownership of rule into this Linter
   void AddRule(std::unique_ptr<LineLintRule> rule) {
     rules_.emplace_back(std::move(rule));
@@ -42,10 +56,24 @@ class LineLinter {
   // Aggregates results of each held LintRule
   std::vector<LintRuleStatus> ReportStatus() const;
 
+  // Returns the number of violations found by all rules so far, without
+  // collecting them like ReportStatus().
+  size_t ViolationCount() const;
+
+  // Measures the time spent in each rule from now on.
+  void EnableProfiling() { timer_.Enable(); }
+
+  // Returns the time spent in each rule, in the same order as
+  // ReportStatus(). All zero unless profiling is enabled.
+  std::vector<LintTiming> RuleTimings() const;
+
  private:
   // List of rules that the linter is using. Rules are responsible for tracking
   // their own internal state.
   std::vector<std::unique_ptr<LineLintRule>> rules_;
+
+  // Accounts the time spent in each rule, if profiling is enabled.
+  LintRuleTimer timer_;
 };
 
 }  // namespace verible
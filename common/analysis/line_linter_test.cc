@@ -21,6 +21,7 @@
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_lint_rule.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/text/token_info.h"
 #include "gmock/gmock.h"
@@ -74,6 +75,7 @@ TEST(LineLinterTest, OneRuleAcceptsLines) {
   EXPECT_THAT(statuses, SizeIs(1));
   EXPECT_TRUE(statuses[0].isOk());
   EXPECT_THAT(statuses[0].violations, IsEmpty());
+  EXPECT_EQ(linter.ViolationCount(), 0);
 }
 
 // This test verifies that LineLinter can find violations.
@@ -86,6 +88,7 @@ TEST(LineLinterTest, OneRuleRejectsLine) {
   EXPECT_THAT(statuses, SizeIs(1));
   EXPECT_FALSE(statuses[0].isOk());
   EXPECT_THAT(statuses[0].violations, SizeIs(1));
+  EXPECT_EQ(linter.ViolationCount(), 1);
 }
 
 // Mock rule that rejects empty files.
@@ -138,5 +141,25 @@ TEST(LineLinterTest, FinalizeRejects) {
   EXPECT_THAT(statuses[0].violations, SizeIs(1));
 }
 
+// This test verifies that rules are only timed when profiling is enabled.
+TEST(LineLinterTest, RuleTimings) {
+  std::vector<absl::string_view> lines{"abc", "", "def"};
+  LineLinter linter;
+  linter.AddRule(MakeBlankLineRule());
+  linter.AddRule(MakeEmptyFileRule());
+  linter.Lint(lines);
+  std::vector<LintTiming> timings = linter.RuleTimings();
+  ASSERT_THAT(timings, SizeIs(2));
+  EXPECT_EQ(timings[0].calls, 0);
+
+  linter.EnableProfiling();
+  linter.Lint(lines);
+  timings = linter.RuleTimings();
+  ASSERT_THAT(timings, SizeIs(2));
+  // Three lines each, and one call to Finalize().
+  EXPECT_EQ(timings[0].calls, 4);
+  EXPECT_EQ(timings[1].calls, 4);
+}
+
 }  // namespace
 }  // namespace verible
@@ -0,0 +1,168 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/line_scanner.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "absl/strings/string_view.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace verible {
+namespace {
+
+constexpr size_t kBlockSize = 16;
+
+// Classification of the bytes of one block of text.
+// Bit i of each mask describes byte i of the block.
+struct BlockMasks {
+  uint32_t newline = 0;
+  uint32_t tab = 0;
+  // Whitespace as in std::isspace() in the C locale: ' ', '\t' to '\r'.
+  uint32_t space = 0;
+  // UTF-8 continuation bytes, which don't start a character.
+  uint32_t continuation = 0;
+};
+
+BlockMasks ScalarBlockMasks(const char *block, size_t size) {
+  BlockMasks masks;
+  for (size_t i = 0; i < size; ++i) {
+    const auto c = static_cast<unsigned char>(block[i]);
+    const uint32_t bit = uint32_t{1} << i;
+    if (c == '\n') masks.newline |= bit;
+    if (c == '\t') masks.tab |= bit;
+    if (c == ' ' || (c >= '\t' && c <= '\r')) masks.space |= bit;
+    if ((c & 0xc0) == 0x80) masks.continuation |= bit;
+  }
+  return masks;
+}
+
+#ifdef __SSE2__
+BlockMasks SimdBlockMasks(const char *block) {
+  const __m128i bytes =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+  const __m128i newline = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'));
+  const __m128i tab = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t'));
+  // '\t' to '\r' are contiguous: (c - '\t') is at most 4 as an unsigned byte.
+  const __m128i from_tab = _mm_sub_epi8(bytes, _mm_set1_epi8('\t'));
+  const __m128i controls = _mm_cmpeq_epi8(
+      _mm_min_epu8(from_tab, _mm_set1_epi8('\r' - '\t')), from_tab);
+  const __m128i space =
+      _mm_or_si128(controls, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')));
+  // Continuation bytes 0x80-0xbf are the signed bytes below 0xc0.
+  const __m128i continuation =
+      _mm_cmplt_epi8(bytes, _mm_set1_epi8(static_cast<char>(0xc0)));
+
+  BlockMasks masks;
+  masks.newline = static_cast<uint32_t>(_mm_movemask_epi8(newline));
+  masks.tab = static_cast<uint32_t>(_mm_movemask_epi8(tab));
+  masks.space = static_cast<uint32_t>(_mm_movemask_epi8(space));
+  masks.continuation = static_cast<uint32_t>(_mm_movemask_epi8(continuation));
+  return masks;
+}
+#endif
+
+BlockMasks GetBlockMasks(const char *block, size_t size) {
+#ifdef __SSE2__
+  if (size == kBlockSize) return SimdBlockMasks(block);
+#endif
+  return ScalarBlockMasks(block, size);
+}
+
+// Collects the facts about one line, from the blocks that it spans.
+// Offsets are relative to the beginning of the scanned text.
+class LineAccumulator {
+ public:
+  explicit LineAccumulator(size_t begin)
+      : begin_(begin), end_of_content_(begin) {}
+
+  // Adds the bytes selected by 'bits' of the block at 'offset'.
+  void Add(const BlockMasks &masks, uint32_t bits, size_t offset) {
+    const uint32_t tabs = masks.tab & bits;
+    if (tabs != 0 && first_tab_ == absl::string_view::npos) {
+      first_tab_ = offset + absl::countr_zero(tabs);
+    }
+    const uint32_t non_space = ~masks.space & bits;
+    if (non_space != 0) {
+      end_of_content_ = offset + 32 - absl::countl_zero(non_space);
+    }
+    continuations_ += absl::popcount(masks.continuation & bits);
+  }
+
+  // Returns the facts about the line, which ends at 'end' in 'text'.
+  LineScan Finish(absl::string_view text, size_t end) const {
+    LineScan scan;
+    scan.length = end - begin_;
+    scan.ends_with_cr = end > begin_ && text[end - 1] == '\r';
+    if (first_tab_ != absl::string_view::npos) {
+      scan.first_tab = first_tab_ - begin_;
+    }
+    // A final '\r' is whitespace, so it is never part of the content.
+    scan.trailing_space_begin = end_of_content_ - begin_;
+    scan.utf8_length = static_cast<int>(scan.length) - continuations_;
+    return scan;
+  }
+
+ private:
+  size_t begin_;
+  size_t first_tab_ = absl::string_view::npos;
+  // One past the last non-whitespace byte.
+  size_t end_of_content_;
+  int continuations_ = 0;
+};
+
+// Calls 'on_line' with the LineScan of every line of 'text', in order.
+template <typename OnLine>
+void ScanText(absl::string_view text, OnLine &&on_line) {
+  LineAccumulator line(0);
+  for (size_t offset = 0; offset < text.size(); offset += kBlockSize) {
+    const size_t size = std::min(kBlockSize, text.size() - offset);
+    const BlockMasks masks = GetBlockMasks(text.data() + offset, size);
+    uint32_t remaining = (uint32_t{1} << size) - 1;
+    for (uint32_t newlines = masks.newline; newlines != 0;
+         newlines &= newlines - 1) {
+      const int pos = absl::countr_zero(newlines);
+      line.Add(masks, remaining & ((uint32_t{1} << pos) - 1), offset);
+      on_line(line.Finish(text, offset + pos));
+      line = LineAccumulator(offset + pos + 1);
+      // Drop the bytes up to and including the newline.
+      remaining &= ~((uint32_t{2} << pos) - 1);
+    }
+    line.Add(masks, remaining, offset);
+  }
+  on_line(line.Finish(text, text.size()));
+}
+
+}  // namespace
+
+LineScan ScanLine(absl::string_view line) {
+  LineScan result;
+  ScanText(line, [&result](const LineScan &scan) { result = scan; });
+  return result;
+}
+
+std::vector<LineScan> ScanLines(absl::string_view text) {
+  std::vector<LineScan> result;
+  ScanText(text, [&result](const LineScan &scan) { result.push_back(scan); });
+  return result;
+}
+
+}  // namespace verible
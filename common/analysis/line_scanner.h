@@ -0,0 +1,73 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Line scanning gathers the byte-level facts that line-based lint rules
+// need (tabs, trailing whitespace, line endings, character counts), so that
+// the rules don't each have to walk every byte of every line.
+
+#ifndef VERIBLE_COMMON_ANALYSIS_LINE_SCANNER_H_
+#define VERIBLE_COMMON_ANALYSIS_LINE_SCANNER_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace verible {
+
+// Facts about a single line, which doesn't include its '\n'.
+struct LineScan {
+  // Byte offset of the first tab in the line, or absl::string_view::npos.
+  size_t first_tab = absl::string_view::npos;
+
+  // Byte offset at which the trailing whitespace (as in std::isspace) of the
+  // line begins, not counting a final '\r'. This equals ContentLength() when
+  // there is no trailing whitespace.
+  size_t trailing_space_begin = 0;
+
+  // Length of the line, including a final '\r'.
+  size_t length = 0;
+
+  // Number of UTF-8 characters in the line, including a final '\r'.
+  int utf8_length = 0;
+
+  // True if the line ends with '\r', as with DOS line endings.
+  bool ends_with_cr = false;
+
+  // Length of the line without a final '\r'.
+  size_t ContentLength() const { return length - (ends_with_cr ? 1 : 0); }
+
+  bool HasTrailingSpace() const {
+    return trailing_space_begin != ContentLength();
+  }
+
+  bool operator==(const LineScan &other) const {
+    return first_tab == other.first_tab &&
+           trailing_space_begin == other.trailing_space_begin &&
+           length == other.length && utf8_length == other.utf8_length &&
+           ends_with_cr == other.ends_with_cr;
+  }
+};
+
+// Scans a single line.
+LineScan ScanLine(absl::string_view line);
+
+// Splits 'text' at '\n', the same way as TextStructureView::Lines(), and
+// scans all lines in a single pass over the text.
+// Uses SSE2 when available, 16 bytes at a time.
+std::vector<LineScan> ScanLines(absl::string_view text);
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_ANALYSIS_LINE_SCANNER_H_
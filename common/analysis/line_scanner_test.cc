@@ -0,0 +1,113 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/line_scanner.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "common/strings/utf8.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+// Straightforward byte-by-byte version of ScanLine().
+LineScan ReferenceScanLine(absl::string_view line) {
+  LineScan scan;
+  scan.length = line.length();
+  scan.first_tab = line.find('\t');
+  scan.utf8_length = utf8_len(line);
+  scan.ends_with_cr = !line.empty() && line.back() == '\r';
+  if (scan.ends_with_cr) line.remove_suffix(1);
+  const auto last = std::find_if(line.rbegin(), line.rend(), [](char c) {
+    return !std::isspace(static_cast<unsigned char>(c));
+  });
+  scan.trailing_space_begin = line.rend() - last;
+  return scan;
+}
+
+void ExpectSameAsReference(absl::string_view text) {
+  const std::vector<absl::string_view> lines = absl::StrSplit(text, '\n');
+  const std::vector<LineScan> scans = ScanLines(text);
+  ASSERT_EQ(scans.size(), lines.size()) << "text: \"" << text << '"';
+  for (size_t i = 0; i < lines.size(); ++i) {
+    EXPECT_EQ(scans[i], ReferenceScanLine(lines[i]))
+        << "line " << i << ": \"" << lines[i] << '"';
+    EXPECT_EQ(ScanLine(lines[i]), ReferenceScanLine(lines[i]))
+        << "line " << i << ": \"" << lines[i] << '"';
+  }
+}
+
+TEST(LineScannerTest, EmptyText) {
+  const std::vector<LineScan> scans = ScanLines("");
+  ASSERT_EQ(scans.size(), 1);
+  EXPECT_EQ(scans[0].length, 0);
+  EXPECT_EQ(scans[0].first_tab, absl::string_view::npos);
+  EXPECT_FALSE(scans[0].HasTrailingSpace());
+  EXPECT_FALSE(scans[0].ends_with_cr);
+}
+
+TEST(LineScannerTest, SingleLine) {
+  const LineScan scan = ScanLine("a\tb  \r");
+  EXPECT_EQ(scan.length, 6);
+  EXPECT_EQ(scan.ContentLength(), 5);
+  EXPECT_EQ(scan.first_tab, 1);
+  EXPECT_EQ(scan.trailing_space_begin, 3);
+  EXPECT_TRUE(scan.HasTrailingSpace());
+  EXPECT_TRUE(scan.ends_with_cr);
+  EXPECT_EQ(scan.utf8_length, 6);
+}
+
+TEST(LineScannerTest, Utf8Length) {
+  EXPECT_EQ(ScanLine("äöü").utf8_length, 3);
+  EXPECT_EQ(ScanLine("x = \"∀x∃y\";").utf8_length, 11);
+}
+
+TEST(LineScannerTest, MatchesReference) {
+  for (absl::string_view text : {
+           "\n",
+           "\n\n\n",
+           "abc",
+           "abc\n",
+           "abc  \ndef\t\n\tghi\r\n",
+           " \r\n\r\n\r",
+           "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t",
+           "                                   x",
+           "x                                   \n",
+           "module m;  // comment with ünïcödé and a tab\there  \r\n"
+           "endmodule\v\f\n",
+       }) {
+    ExpectSameAsReference(text);
+  }
+}
+
+TEST(LineScannerTest, MatchesReferenceAcrossBlockBoundaries) {
+  // Puts the interesting bytes at every offset around the block size.
+  for (size_t prefix = 0; prefix < 40; ++prefix) {
+    const std::string padding(prefix, 'a');
+    ExpectSameAsReference(absl::StrCat(padding, "\tb c  \r\n", padding, " "));
+    ExpectSameAsReference(absl::StrCat(padding, "ä€𝄞 \n\n", padding, "\t"));
+    ExpectSameAsReference(absl::StrCat(padding, "\r\r\n", padding));
+  }
+}
+
+}  // namespace
+}  // namespace verible
@@ -0,0 +1,174 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/lint_profile.h"
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+
+namespace verible {
+namespace {
+
+// Slowest first; ties are ordered by name, to keep reports deterministic.
+template <typename Entry>
+void SortSlowestFirst(std::vector<Entry> *entries) {
+  std::sort(entries->begin(), entries->end(),
+            [](const Entry &a, const Entry &b) {
+              if (a.timing.time != b.timing.time) {
+                return a.timing.time > b.timing.time;
+              }
+              return a.name < b.name;
+            });
+}
+
+double Milliseconds(const LintTiming &timing) {
+  return absl::ToDoubleMilliseconds(timing.time);
+}
+
+// Returns 'text' as a JSON string literal.
+std::string JsonString(absl::string_view text) {
+  std::string result = "\"";
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          result += absl::StrFormat("\\u%04x", c);
+        } else {
+          result += c;
+        }
+    }
+  }
+  result += '"';
+  return result;
+}
+
+}  // namespace
+
+void LintProfile::AddPhase(absl::string_view phase, const LintTiming &timing) {
+  auto found = phases_.find(phase);
+  if (found == phases_.end()) {
+    found = phases_.emplace(std::string(phase), LintTiming()).first;
+  }
+  found->second += timing;
+}
+
+void LintProfile::AddRule(absl::string_view rule, absl::string_view phase,
+                          const LintTiming &timing) {
+  auto found = rules_.find(rule);
+  if (found == rules_.end()) {
+    found = rules_
+                .emplace(std::string(rule),
+                         std::make_pair(std::string(phase), LintTiming()))
+                .first;
+  }
+  found->second.second += timing;
+}
+
+void LintProfile::Merge(const LintProfile &other) {
+  files_ += other.files_;
+  for (const auto &phase : other.phases_) {
+    AddPhase(phase.first, phase.second);
+  }
+  for (const auto &rule : other.rules_) {
+    AddRule(rule.first, rule.second.first, rule.second.second);
+  }
+}
+
+std::vector<LintProfile::PhaseEntry> LintProfile::SortedPhases() const {
+  std::vector<PhaseEntry> result;
+  result.reserve(phases_.size());
+  for (const auto &phase : phases_) {
+    result.push_back({phase.first, phase.second});
+  }
+  SortSlowestFirst(&result);
+  return result;
+}
+
+std::vector<LintProfile::RuleEntry> LintProfile::SortedRules() const {
+  std::vector<RuleEntry> result;
+  result.reserve(rules_.size());
+  for (const auto &rule : rules_) {
+    result.push_back({rule.first, rule.second.first, rule.second.second});
+  }
+  SortSlowestFirst(&result);
+  return result;
+}
+
+void LintProfile::PrintReport(std::ostream *stream) const {
+  const std::vector<PhaseEntry> phases = SortedPhases();
+  const std::vector<RuleEntry> rules = SortedRules();
+  absl::Duration rules_time;
+  for (const auto &rule : rules) rules_time += rule.timing.time;
+
+  *stream << "Lint profile of " << files_ << " file(s)\n\n";
+  *stream << absl::StreamFormat("%-40s %12s %12s\n", "phase", "time [ms]",
+                                "calls");
+  for (const auto &phase : phases) {
+    *stream << absl::StreamFormat("%-40s %12.3f %12d\n", phase.name,
+                                  Milliseconds(phase.timing),
+                                  phase.timing.calls);
+  }
+  *stream << '\n';
+  *stream << absl::StreamFormat("%-40s %-16s %12s %7s %12s\n", "rule", "phase",
+                                "time [ms]", "share", "calls");
+  for (const auto &rule : rules) {
+    const double share =
+        rules_time == absl::ZeroDuration()
+            ? 0.0
+            : 100.0 * absl::FDivDuration(rule.timing.time, rules_time);
+    *stream << absl::StreamFormat("%-40s %-16s %12.3f %6.1f%% %12d\n",
+                                  rule.name, rule.phase,
+                                  Milliseconds(rule.timing), share,
+                                  rule.timing.calls);
+  }
+}
+
+void LintProfile::PrintJson(std::ostream *stream) const {
+  *stream << "{\n  \"files\": " << files_ << ",\n  \"phases\": [";
+  const char *separator = "\n";
+  for (const auto &phase : SortedPhases()) {
+    *stream << separator
+            << absl::StreamFormat(
+                   "    {\"name\": %s, \"time_ms\": %.3f, \"calls\": %d}",
+                   JsonString(phase.name), Milliseconds(phase.timing),
+                   phase.timing.calls);
+    separator = ",\n";
+  }
+  *stream << "\n  ],\n  \"rules\": [";
+  separator = "\n";
+  for (const auto &rule : SortedRules()) {
+    *stream << separator
+            << absl::StreamFormat(
+                   "    {\"name\": %s, \"phase\": %s, \"time_ms\": %.3f, "
+                   "\"calls\": %d}",
+                   JsonString(rule.name), JsonString(rule.phase),
+                   Milliseconds(rule.timing), rule.timing.calls);
+    separator = ",\n";
+  }
+  *stream << "\n  ]\n}\n";
+}
+
+}  // namespace verible
@@ -0,0 +1,144 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Lint profiling measures where the time of linting goes: per linter phase
+// (e.g. line, token, syntax-tree) and per lint rule.
+
+#ifndef VERIBLE_COMMON_ANALYSIS_LINT_PROFILE_H_
+#define VERIBLE_COMMON_ANALYSIS_LINT_PROFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace verible {
+
+// Wall time spent in, and number of calls to, one piece of lint analysis.
+struct LintTiming {
+  absl::Duration time;
+  int64_t calls = 0;
+
+  LintTiming &operator+=(const LintTiming &other) {
+    time += other.time;
+    calls += other.calls;
+    return *this;
+  }
+};
+
+// Calls 'f'. Unless 'timing' is null, the time it took is accounted to it.
+template <typename F>
+void TimeLintCall(LintTiming *timing, F &&f) {
+  if (timing == nullptr) {
+    f();
+    return;
+  }
+  const absl::Time start = absl::Now();
+  f();
+  timing->time += absl::Now() - start;
+  ++timing->calls;
+}
+
+// Accounts the time of calls to the rules of one linter, when enabled.
+// Rules are identified by their position in the linter.
+// When disabled, timing a call costs a single branch.
+class LintRuleTimer {
+ public:
+  void Enable() { enabled_ = true; }
+  bool enabled() const { return enabled_; }
+
+  // Calls 'f'. If enabled, the time it took is accounted to rule number
+  // 'rule'.
+  template <typename F>
+  void Time(size_t rule, F &&f) {
+    if (!enabled_) {
+      f();
+      return;
+    }
+    if (rule >= timings_.size()) timings_.resize(rule + 1);
+    TimeLintCall(&timings_[rule], std::forward<F>(f));
+  }
+
+  // Returns the time accounted to rule number 'rule', which is zero if it
+  // was never timed.
+  LintTiming Get(size_t rule) const {
+    return rule < timings_.size() ? timings_[rule] : LintTiming();
+  }
+
+ private:
+  bool enabled_ = false;
+  std::vector<LintTiming> timings_;
+};
+
+// Lint timings per phase and per rule, accumulated over any number of files.
+class LintProfile {
+ public:
+  struct RuleEntry {
+    std::string name;
+    // The linter phase that runs the rule.
+    std::string phase;
+    LintTiming timing;
+  };
+
+  struct PhaseEntry {
+    std::string name;
+    LintTiming timing;
+  };
+
+  // Accounts 'timing' to the phase called 'phase'.
+  void AddPhase(absl::string_view phase, const LintTiming &timing);
+
+  // Accounts 'timing' to the rule called 'rule', which runs in 'phase'.
+  void AddRule(absl::string_view rule, absl::string_view phase,
+               const LintTiming &timing);
+
+  // Counts one more profiled file.
+  void AddFile() { ++files_; }
+
+  // Adds all timings of 'other' to this profile.
+  void Merge(const LintProfile &other);
+
+  int64_t files() const { return files_; }
+
+  // Returns the phases, slowest first.
+  std::vector<PhaseEntry> SortedPhases() const;
+
+  // Returns the rules, slowest first.
+  std::vector<RuleEntry> SortedRules() const;
+
+  // Prints the phases and rules, slowest first, as a human readable table.
+  void PrintReport(std::ostream *stream) const;
+
+  // Prints the phases and rules, slowest first, as a JSON object.
+  void PrintJson(std::ostream *stream) const;
+
+ private:
+  int64_t files_ = 0;
+  std::map<std::string, LintTiming, std::less<>> phases_;
+  // Keyed by rule name; values are the phase and the timing.
+  std::map<std::string, std::pair<std::string, LintTiming>, std::less<>>
+      rules_;
+};
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_ANALYSIS_LINT_PROFILE_H_
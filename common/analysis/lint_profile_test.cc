@@ -0,0 +1,137 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/lint_profile.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+using ::testing::HasSubstr;
+
+LintTiming Timing(int milliseconds, int calls) {
+  return {absl::Milliseconds(milliseconds), calls};
+}
+
+TEST(LintRuleTimerTest, DisabledRecordsNothing) {
+  LintRuleTimer timer;
+  int called = 0;
+  timer.Time(0, [&called]() { ++called; });
+  EXPECT_EQ(called, 1);
+  EXPECT_EQ(timer.Get(0).calls, 0);
+}
+
+TEST(LintRuleTimerTest, EnabledCountsCallsPerRule) {
+  LintRuleTimer timer;
+  timer.Enable();
+  int called = 0;
+  timer.Time(2, [&called]() { ++called; });
+  timer.Time(2, [&called]() { ++called; });
+  timer.Time(0, [&called]() { ++called; });
+  EXPECT_EQ(called, 3);
+  EXPECT_EQ(timer.Get(0).calls, 1);
+  EXPECT_EQ(timer.Get(1).calls, 0);
+  EXPECT_EQ(timer.Get(2).calls, 2);
+  EXPECT_EQ(timer.Get(3).calls, 0);
+  EXPECT_GE(timer.Get(2).time, absl::ZeroDuration());
+}
+
+TEST(LintProfileTest, SortsSlowestFirst) {
+  LintProfile profile;
+  profile.AddRule("fast-rule", "token", Timing(1, 10));
+  profile.AddRule("slow-rule", "syntax-tree", Timing(5, 3));
+  profile.AddRule("medium-rule", "line", Timing(3, 7));
+  profile.AddPhase("token", Timing(2, 10));
+  profile.AddPhase("syntax-tree", Timing(6, 1));
+
+  const std::vector<LintProfile::RuleEntry> rules = profile.SortedRules();
+  ASSERT_EQ(rules.size(), 3);
+  EXPECT_EQ(rules[0].name, "slow-rule");
+  EXPECT_EQ(rules[0].phase, "syntax-tree");
+  EXPECT_EQ(rules[1].name, "medium-rule");
+  EXPECT_EQ(rules[2].name, "fast-rule");
+
+  const std::vector<LintProfile::PhaseEntry> phases = profile.SortedPhases();
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[0].name, "syntax-tree");
+  EXPECT_EQ(phases[1].name, "token");
+}
+
+TEST(LintProfileTest, MergeAccumulates) {
+  LintProfile a;
+  a.AddFile();
+  a.AddRule("rule", "line", Timing(1, 2));
+  a.AddPhase("line", Timing(2, 2));
+  LintProfile b;
+  b.AddFile();
+  b.AddRule("rule", "line", Timing(3, 4));
+  b.AddRule("other-rule", "token", Timing(1, 1));
+  a.Merge(b);
+
+  EXPECT_EQ(a.files(), 2);
+  const std::vector<LintProfile::RuleEntry> rules = a.SortedRules();
+  ASSERT_EQ(rules.size(), 2);
+  EXPECT_EQ(rules[0].name, "rule");
+  EXPECT_EQ(rules[0].timing.time, absl::Milliseconds(4));
+  EXPECT_EQ(rules[0].timing.calls, 6);
+  EXPECT_EQ(rules[1].name, "other-rule");
+}
+
+TEST(LintProfileTest, PrintReport) {
+  LintProfile profile;
+  profile.AddFile();
+  profile.AddRule("slow-rule", "syntax-tree", Timing(3, 5));
+  profile.AddRule("fast-rule", "token", Timing(1, 7));
+  profile.AddPhase("syntax-tree", Timing(4, 1));
+
+  std::ostringstream stream;
+  profile.PrintReport(&stream);
+  const std::string report = stream.str();
+  EXPECT_THAT(report, HasSubstr("Lint profile of 1 file(s)"));
+  EXPECT_THAT(report, HasSubstr("syntax-tree"));
+  EXPECT_THAT(report, HasSubstr("75.0%"));
+  EXPECT_THAT(report, HasSubstr("25.0%"));
+  EXPECT_LT(report.find("slow-rule"), report.find("fast-rule"));
+}
+
+TEST(LintProfileTest, PrintJson) {
+  LintProfile profile;
+  profile.AddFile();
+  profile.AddRule("some-rule", "line", Timing(2, 3));
+  profile.AddPhase("line", Timing(2, 9));
+
+  std::ostringstream stream;
+  profile.PrintJson(&stream);
+  EXPECT_EQ(stream.str(),
+            "{\n"
+            "  \"files\": 1,\n"
+            "  \"phases\": [\n"
+            "    {\"name\": \"line\", \"time_ms\": 2.000, \"calls\": 9}\n"
+            "  ],\n"
+            "  \"rules\": [\n"
+            "    {\"name\": \"some-rule\", \"phase\": \"line\", "
+            "\"time_ms\": 2.000, \"calls\": 3}\n"
+            "  ]\n"
+            "}\n");
+}
+
+}  // namespace
+}  // namespace verible
@@ -18,6 +18,7 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_LINT_RULE_H_
 #define VERIBLE_COMMON_ANALYSIS_LINT_RULE_H_
 
+#include <cstddef>
 #include <string>
 
 #include "absl/status/status.h"
@@ -47,6 +48,12 @@ class LintRule {
   // Report() returns a LintRuleStatus, which summarizes the results so
   // far of running the LintRule.
   virtual LintRuleStatus Report() const = 0;
+
+  // Returns the number of violations found so far, the same as
+  // Report().violations.size(). It may be asked often, e.g. to stop linting
+  // after some number of violations, so rules should override it with a
+  // cheaper count.
+  virtual size_t ViolationCount() const { return Report().violations.size(); }
 };
 
 }  // namespace verible
@@ -15,6 +15,7 @@
 #include "common/analysis/lint_rule_status.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -166,4 +167,40 @@ void LintRuleStatus::WaiveViolations(
   violations.swap(filtered_violations);
 }
 
+void KeepFirstViolations(size_t limit, std::vector<LintRuleStatus>* statuses) {
+  std::vector<const char*> locations;
+  for (const auto& status : *statuses) {
+    for (const auto& violation : status.violations) {
+      locations.push_back(violation.token.text().data());
+    }
+  }
+  if (locations.size() <= limit) return;
+  if (limit == 0) {
+    for (auto& status : *statuses) status.violations.clear();
+    return;
+  }
+
+  // Find the location of the last violation to keep. Violations before it are
+  // kept, those at it only as long as the limit allows.
+  const std::less<const char*> before;
+  std::nth_element(locations.begin(), locations.begin() + (limit - 1),
+                   locations.end(), before);
+  const char* const last = locations[limit - 1];
+  size_t keep_at_last =
+      limit - std::count_if(locations.begin(), locations.end(),
+                            [&](const char* p) { return before(p, last); });
+  for (auto& status : *statuses) {
+    for (auto iter = status.violations.begin();
+         iter != status.violations.end();) {
+      const char* const location = iter->token.text().data();
+      bool keep = before(location, last);
+      if (location == last && keep_at_last > 0) {
+        keep = true;
+        --keep_at_last;
+      }
+      iter = keep ? std::next(iter) : status.violations.erase(iter);
+    }
+  }
+}
+
 }  // namespace verible
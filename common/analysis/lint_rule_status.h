@@ -17,6 +17,7 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_LINT_RULE_STATUS_H_
 #define VERIBLE_COMMON_ANALYSIS_LINT_RULE_STATUS_H_
 
+#include <cstddef>
 #include <fstream>
 #include <functional>
 #include <initializer_list>
@@ -184,6 +185,11 @@ struct LintViolationWithStatus {
   }
 };
 
+// Keeps only the first 'limit' violations of all 'statuses', in the order of
+// their locations. Of several violations at the same location, those of
+// earlier statuses are kept.
+void KeepFirstViolations(size_t limit, std::vector<LintRuleStatus>* statuses);
+
 // LintStatusFormatter is a class for printing LintRuleStatus's and
 // LintViolations to an output stream
 // Usage:
@@ -67,6 +67,55 @@ TEST(LintRuleStatusTest, WaiveViolations) {
   EXPECT_TRUE(status.isOk());
 }
 
+// Tests limiting the number of violations over several statuses.
+TEST(LintRuleStatusTest, KeepFirstViolations) {
+  constexpr absl::string_view text("abcdef");
+  const auto make_statuses = [&]() {
+    std::vector<LintRuleStatus> statuses(2);
+    for (size_t i : {1, 3, 5}) {
+      statuses[0].violations.insert(
+          LintViolation(TokenInfo(1, text.substr(i, 1)), "odd"));
+    }
+    for (size_t i : {0, 3}) {
+      statuses[1].violations.insert(
+          LintViolation(TokenInfo(1, text.substr(i, 1)), "other"));
+    }
+    return statuses;
+  };
+  const auto locations = [&](const LintRuleStatus& status) {
+    std::vector<size_t> offsets;
+    for (const auto& violation : status.violations) {
+      offsets.push_back(violation.token.left(text));
+    }
+    return offsets;
+  };
+
+  for (size_t limit : {5, 6, 100}) {
+    std::vector<LintRuleStatus> statuses = make_statuses();
+    KeepFirstViolations(limit, &statuses);
+    EXPECT_EQ(locations(statuses[0]), std::vector<size_t>({1, 3, 5}));
+    EXPECT_EQ(locations(statuses[1]), std::vector<size_t>({0, 3}));
+  }
+  {
+    std::vector<LintRuleStatus> statuses = make_statuses();
+    KeepFirstViolations(3, &statuses);  // Of the two at offset 3, the first.
+    EXPECT_EQ(locations(statuses[0]), std::vector<size_t>({1, 3}));
+    EXPECT_EQ(locations(statuses[1]), std::vector<size_t>({0}));
+  }
+  {
+    std::vector<LintRuleStatus> statuses = make_statuses();
+    KeepFirstViolations(2, &statuses);
+    EXPECT_EQ(locations(statuses[0]), std::vector<size_t>({1}));
+    EXPECT_EQ(locations(statuses[1]), std::vector<size_t>({0}));
+  }
+  {
+    std::vector<LintRuleStatus> statuses = make_statuses();
+    KeepFirstViolations(0, &statuses);
+    EXPECT_TRUE(statuses[0].violations.empty());
+    EXPECT_TRUE(statuses[1].violations.empty());
+  }
+}
+
 // Struct for checking expected formatting of a single Lint Violation
 // Note that the filename produced by formatter is provided by LintStatusTest,
 // which contains this struct.
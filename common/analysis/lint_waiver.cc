@@ -19,12 +19,15 @@
 #include <functional>
 #include <iterator>
 #include <map>
-#include <regex>  // NOLINT
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
@@ -38,6 +41,8 @@
 #include "common/util/file_util.h"
 #include "common/util/iterator_range.h"
 #include "common/util/logging.h"
+#include "re2/re2.h"
+#include "re2/set.h"
 
 namespace verible {
 
@@ -51,27 +56,87 @@ void LintWaiver::WaiveLineRange(absl::string_view rule_name, int line_begin,
   line_set.Add({line_begin, line_end});
 }
 
-void LintWaiver::WaiveWithRegex(absl::string_view rule_name,
-                                const std::string &regex_str) {
-  RegexVector &regex_vector = waiver_re_map_[rule_name];
-  auto regex_iter = regex_cache_.find(regex_str);
+namespace {
+// Process-wide cache of compiled waiver and location regular expressions.
+// Entries are never evicted; waiver files only have a bounded number of
+// distinct patterns.
+class RegexCache {
+ public:
+  // Returns the compiled 'pattern', or an error if it is not a valid RE2.
+  absl::StatusOr<const RE2 *> Get(absl::string_view pattern) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto found = regexes_.find(pattern);
+    if (found != regexes_.end()) return found->second.get();
+    auto regex = std::make_unique<const RE2>(
+        re2::StringPiece(pattern.data(), pattern.size()), RE2::Quiet);
+    if (!regex->ok()) return absl::InvalidArgumentError(regex->error());
+    const RE2 *result = regex.get();
+    regexes_.emplace(pattern, std::move(regex));
+    return result;
+  }
 
-  if (regex_iter == regex_cache_.end()) {
-    regex_cache_[regex_str] = std::regex(regex_str);
+  // Returns a set of the patterns of 'regexes' (previously returned by Get()),
+  // in which index i refers to regexes[i].
+  const RE2::Set &GetSet(const std::vector<const RE2 *> &regexes) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto &set = sets_[regexes];
+    if (set == nullptr) {
+      set = std::make_unique<RE2::Set>(RE2::Quiet, RE2::UNANCHORED);
+      for (const RE2 *regex : regexes) {
+        const int index = set->Add(regex->pattern(), nullptr);
+        CHECK_GE(index, 0) << "Already compiled alone: " << regex->pattern();
+      }
+      CHECK(set->Compile()) << "Out of memory compiling waiver regex set";
+    }
+    return *set;
   }
 
-  regex_vector.push_back(&regex_cache_[regex_str]);
+ private:
+  std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<const RE2>, std::less<>> regexes_;
+  std::map<std::vector<const RE2 *>, std::unique_ptr<RE2::Set>> sets_;
+};
+
+RegexCache &GetRegexCache() {
+  static auto *const cache = new RegexCache();  // never freed
+  return *cache;
+}
+}  // namespace
+
+absl::Status LintWaiver::WaiveWithRegex(absl::string_view rule_name,
+                                        absl::string_view regex_str) {
+  const absl::StatusOr<const RE2 *> regex_or = GetRegexCache().Get(regex_str);
+  if (!regex_or.ok()) return regex_or.status();
+  waiver_re_map_[rule_name].push_back(*regex_or);
+  return absl::OkStatus();
 }
 
 void LintWaiver::RegexToLines(absl::string_view contents,
                               const LineColumnMap &line_map) {
+  std::vector<const RE2 *> regexes;
+  std::vector<absl::string_view> regex_rules;
   for (const auto &rule : waiver_re_map_) {
     for (const auto *re : rule.second) {
-      for (std::cregex_iterator i(contents.begin(), contents.end(), *re);
-           i != std::cregex_iterator(); i++) {
-        const std::cmatch &match = *i;
-        WaiveOneLine(rule.first, line_map.LineAtOffset(match.position()));
-      }
+      regexes.push_back(re);
+      regex_rules.push_back(rule.first);
+    }
+  }
+  if (regexes.empty()) return;
+
+  const re2::StringPiece text(contents.data(), contents.size());
+  std::vector<int> matched;
+  if (!GetRegexCache().GetSet(regexes).Match(text, &matched)) return;
+
+  for (const int index : matched) {
+    const RE2 &re = *regexes[index];
+    re2::StringPiece match;
+    size_t pos = 0;
+    while (pos <= text.size() &&
+           re.Match(text, pos, text.size(), RE2::UNANCHORED, &match, 1)) {
+      const size_t offset = match.data() - text.data();
+      WaiveOneLine(regex_rules[index], line_map.LineAtOffset(offset));
+      // Step over empty matches, like std::regex_iterator.
+      pos = offset + std::max<size_t>(match.size(), 1);
     }
   }
 }
@@ -333,15 +398,15 @@ static absl::Status WaiveCommandHandler(
         }
 
         if (option == "location") {
-          const std::string file_match_regex(val);
-          try {
-            const std::regex file_matcher(file_match_regex);
-            location_match =
-                std::regex_search(std::string(lintee_filename), file_matcher);
-          } catch (const std::regex_error &e) {
+          const absl::StatusOr<const RE2 *> file_matcher =
+              GetRegexCache().Get(val);
+          if (!file_matcher.ok()) {
             return WaiveCommandError(token_pos, waive_file,
                                      "--location regex is invalid");
           }
+          location_match = RE2::PartialMatch(
+              re2::StringPiece(lintee_filename.data(), lintee_filename.size()),
+              **file_matcher);
           continue;
         }
 
@@ -364,13 +429,10 @@ static absl::Status WaiveCommandHandler(
         }
 
         if (can_use_regex) {
-          try {
-            waiver->WaiveWithRegex(rule, regex);
-          } catch (const std::regex_error &e) {
-            const char *reason = e.what();
-
+          const absl::Status status = waiver->WaiveWithRegex(rule, regex);
+          if (!status.ok()) {
             return WaiveCommandError(regex_token_pos, waive_file,
-                                     "Invalid regex: ", reason);
+                                     "Invalid regex: ", status.message());
           }
         }
 
@@ -17,24 +17,25 @@
 
 #include <cstddef>
 #include <map>
-#include <regex>  // NOLINT
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "common/strings/position.h"
 #include "common/text/text_structure.h"
 #include "common/util/container_util.h"
 #include "common/util/interval_set.h"
+#include "re2/re2.h"
 
 namespace verible {
 
 // LintWaiver maintains a set of line ranges per lint rule that should be
 // exempt from each rule.
 class LintWaiver {
-  using RegexVector = std::vector<const std::regex *>;
+  using RegexVector = std::vector<const RE2 *>;
 
  public:
   LintWaiver() = default;
@@ -56,11 +57,14 @@ class LintWaiver {
   void WaiveLineRange(absl::string_view rule_name, int line_begin,
                       int line_end);
 
-  // Adds a regular expression which will be used to apply a waiver.
-  void WaiveWithRegex(absl::string_view rule_name, const std::string &regex);
+  // Adds a regular expression (RE2 syntax) which will be used to apply a
+  // waiver. Returns an error if 'regex' is invalid.
+  absl::Status WaiveWithRegex(absl::string_view rule_name,
+                              absl::string_view regex);
 
   // Converts the prepared regular expressions to line numbers and applies the
-  // waivers.
+  // waivers. All expressions are matched together in one pass over 'content',
+  // and only the ones that match anywhere are scanned for their locations.
   void RegexToLines(absl::string_view content, const LineColumnMap &line_map);
 
   // Returns true if `line_number` should be waived for a particular rule.
@@ -86,9 +90,9 @@ class LintWaiver {
   // and will outlive all LintWaiver objects. This applies to both waiver_map_
   // and waiver_re_map_.
   std::map<absl::string_view, LineNumberSet> waiver_map_;
+  // Compiled expressions are owned by a process-wide cache, as the same
+  // waiver file is usually applied to every linted file.
   std::map<absl::string_view, RegexVector> waiver_re_map_;
-
-  std::map<std::string, std::regex> regex_cache_;
 };
 
 // LintWaiverBuilder is a language-agnostic helper class for constructing
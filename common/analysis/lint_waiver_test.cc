@@ -822,5 +822,53 @@ TEST_F(LintWaiverBuilderTest, RegexToLinesMultipleMatches) {
   EXPECT_TRUE(lint_waiver_.RuleIsWaivedOnLine("rule-1", 2));
 }
 
+TEST_F(LintWaiverBuilderTest, RegexToLinesManyRules) {
+  const std::set<absl::string_view> active_rules{"rule-1", "rule-2"};
+  const absl::string_view user_file = "filename";
+  const absl::string_view cfg_file = "waive_file.config";
+
+  // Patterns that never match are only checked once, as part of the set.
+  const absl::string_view cfg_regex =
+      "waive --rule=rule-1 --regex=\"nomatch[0-9]+\"\n"
+      "waive --rule=rule-1 --regex=def\n"
+      "waive --rule=rule-2 --regex=\"^abc\"\n"
+      "waive --rule=rule-2 --regex=\"h.$\"\n"
+      "waive --rule=rule-2 --regex=\"nomatch\"\n";
+  EXPECT_OK(ApplyExternalWaivers(active_rules, user_file, cfg_file, cfg_regex));
+
+  const absl::string_view file = "abc\ndef\nghi";
+  const LineColumnMap line_map(file);
+
+  lint_waiver_.RegexToLines(file, line_map);
+
+  EXPECT_FALSE(lint_waiver_.RuleIsWaivedOnLine("rule-1", 0));
+  EXPECT_TRUE(lint_waiver_.RuleIsWaivedOnLine("rule-1", 1));
+  EXPECT_FALSE(lint_waiver_.RuleIsWaivedOnLine("rule-1", 2));
+  EXPECT_TRUE(lint_waiver_.RuleIsWaivedOnLine("rule-2", 0));
+  EXPECT_FALSE(lint_waiver_.RuleIsWaivedOnLine("rule-2", 1));
+  EXPECT_TRUE(lint_waiver_.RuleIsWaivedOnLine("rule-2", 2));
+}
+
+TEST_F(LintWaiverBuilderTest, RegexToLinesNoMatch) {
+  const std::set<absl::string_view> active_rules{"rule-1"};
+  const absl::string_view user_file = "filename";
+  const absl::string_view cfg_file = "waive_file.config";
+
+  const absl::string_view cfg_regex = "waive --rule=rule-1 --regex=xyz";
+  EXPECT_OK(ApplyExternalWaivers(active_rules, user_file, cfg_file, cfg_regex));
+
+  const absl::string_view file = "abc\ndef\n";
+  const LineColumnMap line_map(file);
+
+  lint_waiver_.RegexToLines(file, line_map);
+  EXPECT_TRUE(lint_waiver_.Empty());
+}
+
+TEST(LintWaiverTest, WaiveWithInvalidRegex) {
+  LintWaiver waiver;
+  EXPECT_FALSE(waiver.WaiveWithRegex("rule-1", "(").ok());
+  EXPECT_TRUE(waiver.WaiveWithRegex("rule-1", "()").ok());
+}
+
 }  // namespace
 }  // namespace verible
@@ -58,6 +58,7 @@ Matcher AllOf(Args &&...args) {
   Matcher matcher(predicate, InnerMatchAll);
 
   matcher.AddMatchers(std::forward<Args>(args)...);
+  matcher.RestrictTagsToAllInnerMatchers();
 
   return matcher;
 }
@@ -98,6 +99,7 @@ Matcher AnyOf(Args &&...args) {
   Matcher matcher(predicate, InnerMatchAny);
 
   matcher.AddMatchers(std::forward<Args>(args)...);
+  matcher.RestrictTagsToAnyInnerMatcher();
 
   return matcher;
 }
@@ -137,6 +139,7 @@ Matcher EachOf(Args &&...args) {
   Matcher matcher(predicate, InnerMatchEachOf);
 
   matcher.AddMatchers(std::forward<Args>(args)...);
+  matcher.RestrictTagsToAnyInnerMatcher();
 
   return matcher;
 }
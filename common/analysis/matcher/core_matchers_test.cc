@@ -15,6 +15,7 @@
 #include "common/analysis/matcher/core_matchers.h"
 
 #include <memory>
+#include <vector>
 
 #include "common/analysis/matcher/bound_symbol_manager.h"
 #include "common/analysis/matcher/matcher.h"
@@ -351,6 +352,26 @@ TEST(CoreMatchers, AllOfAnyOfManyTests) {
   }
 }
 
+// Tests that combined matchers know which tags they can match.
+TEST(CoreMatchers, PossibleTags) {
+  using Tags = std::vector<SymbolTag>;
+  EXPECT_EQ(Node5().PossibleTags(), Tags{NodeTag(5)});
+  EXPECT_EQ(Node5(PathLeaf1()).PossibleTags(), Tags{NodeTag(5)});
+  EXPECT_FALSE(PathNode1().PossibleTags().has_value());
+  EXPECT_EQ(AnyOf(Node5(), Leaf1(), Node5()).PossibleTags(),
+            (Tags{NodeTag(5), LeafTag(1)}));
+  EXPECT_EQ(EachOf(Node1(), Leaf1()).PossibleTags(),
+            (Tags{NodeTag(1), LeafTag(1)}));
+  EXPECT_FALSE(AnyOf(Node5(), PathNode1()).PossibleTags().has_value());
+  EXPECT_EQ(AllOf(Node5(), PathNode1()).PossibleTags(), Tags{NodeTag(5)});
+  EXPECT_EQ(AllOf(AnyOf(Node1(), Node5()), Node5()).PossibleTags(),
+            Tags{NodeTag(5)});
+  EXPECT_EQ(AllOf(Node1(), Node5()).PossibleTags(), Tags{});
+  EXPECT_EQ(Node5(AnyOf(Node1(), Node5())).PossibleTags(), Tags{NodeTag(5)});
+  EXPECT_FALSE(Unless(Node5()).PossibleTags().has_value());
+  EXPECT_FALSE(AllOf(PathNode1(), PathLeaf1()).PossibleTags().has_value());
+}
+
 }  // namespace
 }  // namespace matcher
 }  // namespace verible
@@ -15,14 +15,65 @@
 // Implementation of matcher.h
 #include "common/analysis/matcher/matcher.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
+#include "absl/types/optional.h"
+
 #include "common/analysis/matcher/bound_symbol_manager.h"
 #include "common/text/symbol.h"
 
 namespace verible {
 namespace matcher {
 
+Matcher::Matcher(SymbolTag tag, const InnerMatchHandler &handler)
+    : predicate_([tag](const Symbol &symbol) { return symbol.Tag() == tag; }),
+      inner_match_handler_(handler),
+      possible_tags_(std::vector<SymbolTag>{tag}) {}
+
+static bool Contains(const std::vector<SymbolTag> &tags, SymbolTag tag) {
+  return std::find(tags.begin(), tags.end(), tag) != tags.end();
+}
+
+void Matcher::RestrictTagsToAllInnerMatchers() {
+  for (const Matcher &inner : inner_matchers_) {
+    const auto &inner_tags = inner.PossibleTags();
+    if (!inner_tags.has_value()) continue;
+    if (!possible_tags_.has_value()) {
+      possible_tags_ = inner_tags;
+      continue;
+    }
+    // Keep the tags that both allow.
+    std::vector<SymbolTag> &tags = *possible_tags_;
+    tags.erase(std::remove_if(tags.begin(), tags.end(),
+                              [&](SymbolTag tag) {
+                                return !Contains(*inner_tags, tag);
+                              }),
+               tags.end());
+  }
+}
+
+void Matcher::RestrictTagsToAnyInnerMatcher() {
+  std::vector<SymbolTag> tags;
+  for (const Matcher &inner : inner_matchers_) {
+    const auto &inner_tags = inner.PossibleTags();
+    // One submatcher that matches anything is enough to match anything.
+    if (!inner_tags.has_value()) return;
+    for (const SymbolTag tag : *inner_tags) {
+      if (!Contains(tags, tag)) tags.push_back(tag);
+    }
+  }
+  if (possible_tags_.has_value()) {
+    tags.erase(std::remove_if(tags.begin(), tags.end(),
+                              [&](SymbolTag tag) {
+                                return !Contains(*possible_tags_, tag);
+                              }),
+               tags.end());
+  }
+  possible_tags_ = std::move(tags);
+}
+
 bool Matcher::Matches(const Symbol &symbol, BoundSymbolManager *manager) const {
   if (predicate_(symbol)) {
     // If this matcher matches (as in, predicate succeeds), test inner matchers
@@ -61,6 +61,10 @@ class Matcher {
           const SymbolTransformer &t)
       : predicate_(p), inner_match_handler_(handler), transformer_(t) {}
 
+  // Matches symbols with the given tag, like a predicate comparing tags, but
+  // also records it in PossibleTags().
+  Matcher(SymbolTag tag, const InnerMatchHandler &handler);
+
   // Returns true if this and all submatchers match on symbol.
   // Returns false otherwise.
   // If this and all submatchers match, adds their bound symbols to manager
@@ -78,6 +82,20 @@ class Matcher {
     AddMatchers(std::forward<Args>(args)...);
   }
 
+  // Returns the tags a symbol must have for this to match it, or nullopt if
+  // this may match symbols of any tag. An empty list means that this never
+  // matches. Used to only try matchers on symbols they can match (see
+  // MatcherSet).
+  const absl::optional<std::vector<SymbolTag>> &PossibleTags() const {
+    return possible_tags_;
+  }
+
+  // Narrows PossibleTags() to what the submatchers allow, for matchers that
+  // apply their submatchers to the matched symbol itself: either all of them
+  // need to match (AllOf), or any of them (AnyOf, EachOf).
+  void RestrictTagsToAllInnerMatchers();
+  void RestrictTagsToAnyInnerMatcher();
+
  private:
   // Contains all inner matchers.
   std::vector<Matcher> inner_matchers_;
@@ -100,6 +118,9 @@ class Matcher {
   // If present when Matches is called, symbol will be bound to its value
   // If null_opt, then symbol will not be
   absl::optional<std::string> bind_id_ = absl::nullopt;
+
+  // See PossibleTags().
+  absl::optional<std::vector<SymbolTag>> possible_tags_ = absl::nullopt;
 };
 
 // BindableMatcher is a subclass of matcher that enables setting
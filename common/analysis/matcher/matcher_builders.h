@@ -151,9 +151,10 @@ class TagMatchBuilder {
 
   template <typename... Args>
   BindableMatcher operator()(Args... args) const {
-    BindableMatcher matcher(EqualTagPredicate<Kind, EnumType, Tag>,
+    BindableMatcher matcher(SymbolTag{Kind, static_cast<int>(Tag)},
                             InnerMatchAll);
     matcher.AddMatchers(std::forward<Args>(args)...);
+    matcher.RestrictTagsToAllInnerMatchers();
     return matcher;
   }
 };
@@ -183,9 +184,9 @@ class DynamicTagMatchBuilder {
 
   template <typename... Args>
   BindableMatcher operator()(Args... args) const {
-    BindableMatcher matcher([this](const Symbol &s) { return s.Tag() == tag_; },
-                            InnerMatchAll);
+    BindableMatcher matcher(tag_, InnerMatchAll);
     matcher.AddMatchers(std::forward<Args>(args)...);
+    matcher.RestrictTagsToAllInnerMatchers();
     return matcher;
   }
 
@@ -0,0 +1,63 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/matcher/matcher_set.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
+#include "common/text/symbol.h"
+
+namespace verible {
+namespace matcher {
+
+size_t MatcherSet::Add(const Matcher &matcher) {
+  const size_t id = matchers_.size();
+  matchers_.push_back(matcher);
+  const auto &possible_tags = matcher.PossibleTags();
+  if (!possible_tags.has_value()) {
+    candidates_.Add(id, {});  // Candidate for every tag.
+  } else if (!possible_tags->empty()) {
+    candidates_.Add(id, *possible_tags);
+  }
+  return id;
+}
+
+void MatcherSet::Match(const Symbol &symbol,
+                       const MatchCallback &on_match) const {
+  BoundSymbolManager manager;
+  for (const size_t id : Candidates(symbol.Tag())) {
+    manager.Clear();
+    if (Matches(id, symbol, &manager)) on_match(id, manager);
+  }
+}
+
+std::vector<SymbolTag> MatcherSet::PossibleTags() const {
+  std::vector<SymbolTag> tags;
+  for (const Matcher &matcher : matchers_) {
+    if (!matcher.PossibleTags().has_value()) return {};
+    for (const SymbolTag tag : *matcher.PossibleTags()) {
+      if (std::find(tags.begin(), tags.end(), tag) == tags.end()) {
+        tags.push_back(tag);
+      }
+    }
+  }
+  return tags;
+}
+
+}  // namespace matcher
+}  // namespace verible
@@ -0,0 +1,89 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_COMMON_ANALYSIS_MATCHER_MATCHER_SET_H_
+#define VERIBLE_COMMON_ANALYSIS_MATCHER_MATCHER_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
+#include "common/text/symbol.h"
+#include "common/text/symbol_tag_dispatch_table.h"
+
+namespace verible {
+namespace matcher {
+
+// MatcherSet combines many matchers, e.g. those of all enabled lint rules,
+// into one table indexed by symbol tag. Looking up a symbol's tag once yields
+// the matchers that can possibly match it (see Matcher::PossibleTags()), so
+// the others are never tried on it.
+//
+// Usage:
+//   MatcherSet matchers;
+//   const size_t id = matchers.Add(NodekModuleDeclaration(...));
+//   ...
+//   matchers.Match(symbol, [](size_t id, const BoundSymbolManager &bound) {
+//     ... the matcher with 'id' matched, with symbols 'bound' ...
+//   });
+//
+class MatcherSet {
+ public:
+  // Receives the id of a matcher that matched, and the symbols it bound.
+  using MatchCallback =
+      std::function<void(size_t id, const BoundSymbolManager &bound)>;
+
+  MatcherSet() = default;
+
+  // Adds a copy of 'matcher', and returns its id, which is the number of
+  // matchers added before it.
+  size_t Add(const Matcher &matcher);
+
+  size_t size() const { return matchers_.size(); }
+  bool empty() const { return matchers_.empty(); }
+
+  // Returns the ids of the matchers that can match symbols with 'tag', in
+  // increasing order.
+  const std::vector<size_t> &Candidates(SymbolTag tag) const {
+    return candidates_.Get(tag);
+  }
+
+  // Returns true if matcher 'id' matches 'symbol', binding to 'manager'.
+  bool Matches(size_t id, const Symbol &symbol,
+               BoundSymbolManager *manager) const {
+    return matchers_[id].Matches(symbol, manager);
+  }
+
+  // Tries the candidate matchers on 'symbol', in the order they were added,
+  // and calls 'on_match' for every one that matches.
+  void Match(const Symbol &symbol, const MatchCallback &on_match) const;
+
+  // Returns the tags of the symbols that any matcher can match, or an empty
+  // list if some matcher can match symbols of any tag.
+  std::vector<SymbolTag> PossibleTags() const;
+
+ private:
+  std::vector<Matcher> matchers_;
+
+  // Candidates for each node tag and leaf token enum, from the matchers'
+  // PossibleTags().
+  SymbolTagDispatchTable candidates_;
+};
+
+}  // namespace matcher
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_ANALYSIS_MATCHER_MATCHER_SET_H_
@@ -0,0 +1,103 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/matcher/matcher_set.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/core_matchers.h"
+#include "common/analysis/matcher/matcher_builders.h"
+#include "common/text/symbol.h"
+#include "common/text/tree_builder_test_util.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace matcher {
+namespace {
+
+constexpr TagMatchBuilder<SymbolKind::kNode, int, 1> Node1;
+constexpr TagMatchBuilder<SymbolKind::kNode, int, 2> Node2;
+constexpr TagMatchBuilder<SymbolKind::kLeaf, int, 3> Leaf3;
+
+constexpr auto PathLeaf3 = MakePathMatcher(LeafTag(3));
+
+TEST(MatcherSetTest, Empty) {
+  MatcherSet matchers;
+  EXPECT_TRUE(matchers.empty());
+  EXPECT_TRUE(matchers.Candidates(NodeTag(1)).empty());
+  EXPECT_TRUE(matchers.PossibleTags().empty());
+  const auto node = TNode(1);
+  matchers.Match(*node, [](size_t, const BoundSymbolManager &) {
+    ADD_FAILURE() << "Nothing should match.";
+  });
+}
+
+TEST(MatcherSetTest, CandidatesByTag) {
+  MatcherSet matchers;
+  EXPECT_EQ(matchers.Add(Node1()), 0);
+  EXPECT_EQ(matchers.Add(AnyOf(Node2(), Leaf3())), 1);
+  EXPECT_EQ(matchers.Add(Node1(PathLeaf3())), 2);
+  EXPECT_EQ(matchers.size(), 3);
+  EXPECT_EQ(matchers.PossibleTags(),
+            (std::vector<SymbolTag>{NodeTag(1), NodeTag(2), LeafTag(3)}));
+
+  using Ids = std::vector<size_t>;
+  EXPECT_EQ(matchers.Candidates(NodeTag(1)), (Ids{0, 2}));
+  EXPECT_EQ(matchers.Candidates(NodeTag(2)), Ids{1});
+  EXPECT_EQ(matchers.Candidates(LeafTag(3)), Ids{1});
+  EXPECT_TRUE(matchers.Candidates(NodeTag(0)).empty());
+  EXPECT_TRUE(matchers.Candidates(LeafTag(1)).empty());
+  EXPECT_TRUE(matchers.Candidates(NodeTag(1000)).empty());
+
+  // Matchers of any tag are candidates everywhere, in order of addition.
+  EXPECT_EQ(matchers.Add(PathLeaf3()), 3);
+  EXPECT_EQ(matchers.Candidates(NodeTag(1)), (Ids{0, 2, 3}));
+  EXPECT_EQ(matchers.Candidates(LeafTag(3)), (Ids{1, 3}));
+  EXPECT_EQ(matchers.Candidates(NodeTag(1000)), Ids{3});
+  EXPECT_TRUE(matchers.PossibleTags().empty());
+}
+
+TEST(MatcherSetTest, MatchReportsBoundSymbols) {
+  MatcherSet matchers;
+  matchers.Add(Node1(PathLeaf3().Bind("leaf")));
+  matchers.Add(Node2());
+  matchers.Add(Node1().Bind("node"));
+
+  const auto tree = TNode(1, XLeaf(3));
+  std::vector<std::pair<size_t, const Symbol *>> matches;
+  matchers.Match(*tree, [&](size_t id, const BoundSymbolManager &bound) {
+    EXPECT_EQ(bound.Size(), 1);
+    matches.emplace_back(
+        id, id == 0 ? bound.FindSymbol("leaf") : bound.FindSymbol("node"));
+  });
+  ASSERT_EQ(matches.size(), 2);
+  EXPECT_EQ(matches[0].first, 0);
+  ASSERT_NE(matches[0].second, nullptr);
+  EXPECT_EQ(matches[0].second->Tag(), LeafTag(3));
+  EXPECT_EQ(matches[1].first, 2);
+  EXPECT_EQ(matches[1].second, tree.get());
+
+  // The leaf does not have the required children.
+  const auto leaf = XLeaf(3);
+  matchers.Match(*leaf, [](size_t, const BoundSymbolManager &) {
+    ADD_FAILURE() << "Nothing should match.";
+  });
+}
+
+}  // namespace
+}  // namespace matcher
+}  // namespace verible
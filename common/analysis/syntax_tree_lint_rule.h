@@ -15,7 +15,12 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_SYNTAX_TREE_LINT_RULE_H_
 #define VERIBLE_COMMON_ANALYSIS_SYNTAX_TREE_LINT_RULE_H_
 
+#include <cstddef>
+#include <vector>
+
 #include "common/analysis/lint_rule.h"
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
 #include "common/text/concrete_syntax_leaf.h"
 #include "common/text/concrete_syntax_tree.h"
 #include "common/text/symbol.h"
@@ -36,10 +41,35 @@ namespace verible {
 // Note that context is a stack nodes representing the ancestors of the
 // Symbol currented being operated on. Most recent ancestors are at the
 // top of the stack/back of vector.
+//
+// Rules that only look at a few kinds of symbols should override
+// InterestedSymbolTags(), so that the linter skips calling them for all others.
+// Rules that look for tree patterns can instead return their matchers from
+// SymbolMatchers(), which the linter tries together with those of all other
+// rules.
 class SyntaxTreeLintRule : public LintRule {
  public:
   ~SyntaxTreeLintRule() override = default;
 
+  // Returns the tags of the leaves and nodes this rule wants to handle.
+  // The Handle*() methods are only called for symbols with one of these tags,
+  // but still with the full context. An empty list, the default, means that
+  // the rule handles every symbol.
+  virtual std::vector<SymbolTag> InterestedSymbolTags() const { return {}; }
+
+  // Returns the matchers of the patterns this rule looks for. The linter
+  // combines the matchers of all rules into one table indexed by symbol tag
+  // (see matcher::MatcherSet), and calls HandleMatch() for each symbol one of
+  // them matches. A rule with matchers only has its Handle*() methods called
+  // for the symbols in InterestedSymbolTags(), none if that is empty.
+  virtual std::vector<matcher::Matcher> SymbolMatchers() const { return {}; }
+
+  // Handles 'symbol', which the matcher at 'matcher_index' of
+  // SymbolMatchers() matched, binding the symbols in 'bound'.
+  virtual void HandleMatch(size_t matcher_index, const Symbol &symbol,
+                           const matcher::BoundSymbolManager &bound,
+                           const SyntaxTreeContext &context) {}
+
   virtual void HandleLeaf(const SyntaxTreeLeaf &leaf,
                           const SyntaxTreeContext &context) {}
   virtual void HandleNode(const SyntaxTreeNode &node,
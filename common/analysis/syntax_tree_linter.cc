@@ -14,10 +14,16 @@
 
 #include "common/analysis/syntax_tree_linter.h"
 
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
+#include "common/analysis/matcher/matcher_set.h"
 #include "common/analysis/syntax_tree_lint_rule.h"
 #include "common/text/concrete_syntax_leaf.h"
 #include "common/text/concrete_syntax_tree.h"
@@ -33,6 +39,58 @@ void SyntaxTreeLinter::Lint(const Symbol &root) {
   root.Accept(this);
 }
 
+bool SyntaxTreeLinter::Stopped() {
+  if (stopped_) return true;
+  if (stop_condition_ == nullptr || --symbols_until_stop_check_ > 0) {
+    return false;
+  }
+  symbols_until_stop_check_ = stop_check_interval_;
+  stopped_ = stop_condition_();
+  if (stopped_) VLOG(1) << "SyntaxTreeLinter stopped early.";
+  return stopped_;
+}
+
+const std::vector<size_t> &SyntaxTreeLinter::RulesFor(SymbolTag tag) {
+  if (!dispatch_valid_) BuildDispatchTables();
+  return rule_table_.Get(tag);
+}
+
+void SyntaxTreeLinter::HandleMatches(const Symbol &symbol) {
+  if (!dispatch_valid_) BuildDispatchTables();
+  if (matchers_.empty()) return;
+  matcher::BoundSymbolManager bound;
+  for (const size_t id : matchers_.Candidates(symbol.Tag())) {
+    const size_t i = matcher_owners_[id].first;
+    SyntaxTreeLintRule *const rule = rules_[i].get();
+    timer_.Time(i, [&]() {
+      bound.Clear();
+      if (matchers_.Matches(id, symbol, &bound)) {
+        rule->HandleMatch(matcher_owners_[id].second, symbol, bound, Context());
+      }
+    });
+  }
+}
+
+void SyntaxTreeLinter::BuildDispatchTables() {
+  rule_table_.Clear();
+  matchers_ = matcher::MatcherSet();
+  matcher_owners_.clear();
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    const std::vector<matcher::Matcher> matchers =
+        ABSL_DIE_IF_NULL(rules_[i])->SymbolMatchers();
+    for (size_t m = 0; m < matchers.size(); ++m) {
+      matchers_.Add(matchers[m]);
+      matcher_owners_.emplace_back(i, m);
+    }
+    const std::vector<SymbolTag> interests = rules_[i]->InterestedSymbolTags();
+    // Rules with matchers are only called for matched symbols, and for the
+    // tags they explicitly ask for.
+    if (interests.empty() && !matchers.empty()) continue;
+    rule_table_.Add(i, interests);
+  }
+  dispatch_valid_ = true;
+}
+
 std::vector<LintRuleStatus> SyntaxTreeLinter::ReportStatus() const {
   std::vector<LintRuleStatus> status;
   status.reserve(rules_.size());
@@ -42,24 +100,50 @@ std::vector<LintRuleStatus> SyntaxTreeLinter::ReportStatus() const {
   return status;
 }
 
-// Visits a leaf. Every held rule handles that leaf.
+size_t SyntaxTreeLinter::ViolationCount() const {
+  size_t count = 0;
+  for (const auto &rule : rules_) count += rule->ViolationCount();
+  return count;
+}
+
+std::vector<LintTiming> SyntaxTreeLinter::RuleTimings() const {
+  std::vector<LintTiming> timings;
+  timings.reserve(rules_.size());
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    timings.push_back(timer_.Get(i));
+  }
+  return timings;
+}
+
+// Visits a leaf. Every rule interested in it, or with a matcher that matches
+// it, handles that leaf.
 void SyntaxTreeLinter::Visit(const SyntaxTreeLeaf &leaf) {
-  for (const auto &rule : rules_) {
+  if (Stopped() || (skip_subtree_ && skip_subtree_(leaf))) return;
+  for (const size_t i : RulesFor(leaf.Tag())) {
+    SyntaxTreeLintRule *const rule = rules_[i].get();
     // Have rule handle the leaf as both a leaf and a symbol.
-    ABSL_DIE_IF_NULL(rule)->HandleLeaf(leaf, Context());
-    rule->HandleSymbol(leaf, Context());
+    timer_.Time(i, [&]() {
+      rule->HandleLeaf(leaf, Context());
+      rule->HandleSymbol(leaf, Context());
+    });
   }
+  HandleMatches(leaf);
 }
 
-// Visits a node. First, linter has every rule handle that node
+// Visits a node. First, linter has every interested rule handle that node.
 // Second, linter recurses on every non-null child of that node in order
 // to visit the entire tree
 void SyntaxTreeLinter::Visit(const SyntaxTreeNode &node) {
-  for (const auto &rule : rules_) {
+  if (Stopped() || (skip_subtree_ && skip_subtree_(node))) return;
+  for (const size_t i : RulesFor(node.Tag())) {
+    SyntaxTreeLintRule *const rule = rules_[i].get();
     // Have rule handle the node as both a node and a symbol.
-    ABSL_DIE_IF_NULL(rule)->HandleNode(node, Context());
-    rule->HandleSymbol(node, Context());
+    timer_.Time(i, [&]() {
+      rule->HandleNode(node, Context());
+      rule->HandleSymbol(node, Context());
+    });
   }
+  HandleMatches(node);
 
   // Visit subtree children.
   TreeContextVisitor::Visit(node);
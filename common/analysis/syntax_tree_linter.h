@@ -19,15 +19,20 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_SYNTAX_TREE_LINTER_H_
 #define VERIBLE_COMMON_ANALYSIS_SYNTAX_TREE_LINTER_H_
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
+#include "common/analysis/matcher/matcher_set.h"
 #include "common/analysis/syntax_tree_lint_rule.h"
 #include "common/text/concrete_syntax_leaf.h"
 #include "common/text/concrete_syntax_tree.h"
 #include "common/text/symbol.h"
+#include "common/text/symbol_tag_dispatch_table.h"
 #include "common/text/syntax_tree_context.h"
 #include "common/text/tree_context_visitor.h"
 
@@ -57,18 +62,82 @@ class SyntaxTreeLinter : public TreeContextVisitor {
   // Transfers ownership of rule into Linter
   void AddRule(std::unique_ptr<SyntaxTreeLintRule> rule) {
     rules_.emplace_back(std::move(rule));
+    dispatch_valid_ = false;
   }
 
   // Aggregates results of each held LintRule
   std::vector<LintRuleStatus> ReportStatus() const;
 
+  // Returns the number of violations found by all rules so far, without
+  // collecting them like ReportStatus().
+  size_t ViolationCount() const;
+
+  // Measures the time spent in each rule from now on.
+  void EnableProfiling() { timer_.Enable(); }
+
+  // Returns the time spent in each rule, in the same order as
+  // ReportStatus(). All zero unless profiling is enabled.
+  std::vector<LintTiming> RuleTimings() const;
+
+  // Makes Lint() stop visiting symbols once 'done' returns true, e.g. when
+  // enough violations are found. As it may be costly, 'done' is only asked
+  // every 'interval' symbols.
+  void StopWhen(std::function<bool()> done, int interval) {
+    stop_condition_ = std::move(done);
+    stop_check_interval_ = interval;
+    symbols_until_stop_check_ = interval;
+  }
+
+  // Makes Lint() skip the subtrees for which 'skip' returns true, e.g. those
+  // outside the lines of interest. Rules don't see any symbol of a skipped
+  // subtree.
+  void SkipSubtreesWhere(std::function<bool(const Symbol &)> skip) {
+    skip_subtree_ = std::move(skip);
+  }
+
   // Performs lint analysis on root
   void Lint(const Symbol &root);
 
  private:
+  // Returns the indices of the rules interested in symbols with 'tag', in the
+  // order they were added.
+  const std::vector<size_t> &RulesFor(SymbolTag tag);
+
+  // Has the rules whose SymbolMatchers() match 'symbol' handle it.
+  void HandleMatches(const Symbol &symbol);
+
+  // Builds the per-tag rule lists from the rules' InterestedSymbolTags(), and
+  // combines the rules' SymbolMatchers().
+  void BuildDispatchTables();
+
+  // Returns true if no more symbols are to be visited, asking the stop
+  // condition, if any, every stop_check_interval_ calls.
+  bool Stopped();
+
   // List of rules that the linter is using. Rules are responsible for tracking
   // their own internal state.
   std::vector<std::unique_ptr<SyntaxTreeLintRule>> rules_;
+
+  // Accounts the time spent in each rule, if profiling is enabled.
+  LintRuleTimer timer_;
+
+  // Indices of the rules to run for each node tag and leaf token enum.
+  SymbolTagDispatchTable rule_table_;
+  bool dispatch_valid_ = false;
+
+  // The matchers of all rules, and for each, the index of its rule and its
+  // index in that rule's SymbolMatchers().
+  matcher::MatcherSet matchers_;
+  std::vector<std::pair<size_t, size_t>> matcher_owners_;
+
+  // Set by SkipSubtreesWhere().
+  std::function<bool(const Symbol &)> skip_subtree_;
+
+  // Set by StopWhen().
+  std::function<bool()> stop_condition_;
+  int stop_check_interval_ = 0;
+  int symbols_until_stop_check_ = 0;
+  bool stopped_ = false;
 };
 
 }  // namespace verible
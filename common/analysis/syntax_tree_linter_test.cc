@@ -17,10 +17,14 @@
 #include <cstddef>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
+#include "common/analysis/matcher/matcher_builders.h"
 #include "common/analysis/syntax_tree_lint_rule.h"
 #include "common/text/concrete_syntax_leaf.h"
 #include "common/text/concrete_syntax_tree.h"
@@ -28,6 +32,7 @@
 #include "common/text/syntax_tree_context.h"
 #include "common/text/token_info.h"
 #include "common/text/tree_builder_test_util.h"
+#include "common/util/casts.h"
 #include "gtest/gtest.h"
 
 namespace verible {
@@ -278,5 +283,172 @@ TEST(SyntaxTreeLinterTest, DepthSuccess) {
   EXPECT_EQ(statuses[0].violations.size(), 0);
 }
 
+// Testing rule that records the tags of the symbols it handles.
+class RecordHandledTags : public SyntaxTreeLintRule {
+ public:
+  explicit RecordHandledTags(std::vector<SymbolTag> interests)
+      : interests_(std::move(interests)) {}
+
+  std::vector<SymbolTag> InterestedSymbolTags() const final {
+    return interests_;
+  }
+
+  void HandleSymbol(const Symbol &symbol,
+                    const SyntaxTreeContext &context) final {
+    handled_.push_back(symbol.Tag());
+    depths_.push_back(context.size());
+  }
+
+  LintRuleStatus Report() const final { return LintRuleStatus(); }
+
+  const std::vector<SymbolTag> &Handled() const { return handled_; }
+  const std::vector<size_t> &Depths() const { return depths_; }
+
+ private:
+  const std::vector<SymbolTag> interests_;
+  std::vector<SymbolTag> handled_;
+  std::vector<size_t> depths_;
+};
+
+TEST(SyntaxTreeLinterTest, RulesOnlyHandleInterestedTags) {
+  SymbolPtr root = TNode(1, XLeaf(5), TNode(2, XLeaf(6), TNode(1)),
+                         TNode(1000), XLeaf(2000));
+  SyntaxTreeLinter linter;
+  auto *nodes = new RecordHandledTags({NodeTag(1)});
+  auto *leaves = new RecordHandledTags({LeafTag(6), LeafTag(2000)});
+  auto *mixed = new RecordHandledTags({NodeTag(2), LeafTag(2), LeafTag(5)});
+  auto *all = new RecordHandledTags({});
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(nodes));
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(leaves));
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(mixed));
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(all));
+  linter.Lint(*root);
+
+  const std::vector<SymbolTag> expect_nodes{NodeTag(1), NodeTag(1)};
+  EXPECT_EQ(nodes->Handled(), expect_nodes);
+  EXPECT_EQ(nodes->Depths(), (std::vector<size_t>{0, 2}));
+  const std::vector<SymbolTag> expect_leaves{LeafTag(6), LeafTag(2000)};
+  EXPECT_EQ(leaves->Handled(), expect_leaves);
+  const std::vector<SymbolTag> expect_mixed{LeafTag(5), NodeTag(2)};
+  EXPECT_EQ(mixed->Handled(), expect_mixed);
+  EXPECT_EQ(all->Handled().size(), 7);
+}
+
+// Testing rule that records the matches of its matchers.
+class RecordMatches : public SyntaxTreeLintRule {
+ public:
+  std::vector<matcher::Matcher> SymbolMatchers() const final {
+    constexpr matcher::TagMatchBuilder<SymbolKind::kNode, int, 2> Node2;
+    constexpr matcher::TagMatchBuilder<SymbolKind::kLeaf, int, 6> Leaf6;
+    constexpr auto PathLeaf6 = matcher::MakePathMatcher(LeafTag(6));
+    return {Leaf6(), Node2(PathLeaf6().Bind("leaf"))};
+  }
+
+  void HandleMatch(size_t matcher_index, const Symbol &symbol,
+                   const matcher::BoundSymbolManager &bound,
+                   const SyntaxTreeContext &context) final {
+    matches_.push_back(matcher_index);
+    tags_.push_back(symbol.Tag());
+    depths_.push_back(context.size());
+    if (matcher_index == 1) {
+      EXPECT_EQ(bound.FindSymbol("leaf")->Tag(), LeafTag(6));
+    }
+  }
+
+  void HandleSymbol(const Symbol &symbol, const SyntaxTreeContext &) final {
+    handled_.push_back(symbol.Tag());
+  }
+
+  LintRuleStatus Report() const final { return LintRuleStatus(); }
+
+  std::vector<size_t> matches_;
+  std::vector<SymbolTag> tags_;
+  std::vector<size_t> depths_;
+  std::vector<SymbolTag> handled_;
+};
+
+TEST(SyntaxTreeLinterTest, RulesHandleMatchesOfTheirMatchers) {
+  SymbolPtr root = TNode(1, XLeaf(6), TNode(2, XLeaf(6), TNode(2)), XLeaf(7));
+  SyntaxTreeLinter linter;
+  auto *matches = new RecordMatches;
+  auto *all = new RecordHandledTags({});
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(matches));
+  linter.AddRule(std::unique_ptr<SyntaxTreeLintRule>(all));
+  linter.Lint(*root);
+
+  EXPECT_EQ(matches->matches_, (std::vector<size_t>{0, 1, 0}));
+  EXPECT_EQ(matches->tags_,
+            (std::vector<SymbolTag>{LeafTag(6), NodeTag(2), LeafTag(6)}));
+  EXPECT_EQ(matches->depths_, (std::vector<size_t>{1, 1, 2}));
+  // Without InterestedSymbolTags(), it only handles matches.
+  EXPECT_TRUE(matches->handled_.empty());
+  EXPECT_EQ(all->Handled().size(), 6);
+}
+
+TEST(SyntaxTreeLinterTest, StopWhen) {
+  constexpr absl::string_view text("abcde");
+  SymbolPtr root =
+      Node(Leaf(3, text.substr(0, 1)), Leaf(3, text.substr(1, 1)),
+           Node(Leaf(3, text.substr(2, 1))), Leaf(3, text.substr(3, 1)),
+           Leaf(3, text.substr(4, 1)));
+  ASSERT_NE(root.get(), nullptr);
+  SyntaxTreeLinter linter;
+  linter.AddRule(MakeRuleN(2));
+  linter.StopWhen(
+      [&linter]() { return linter.ReportStatus()[0].violations.size() >= 2; },
+      1);
+  linter.Lint(*root);
+  std::vector<LintRuleStatus> statuses = linter.ReportStatus();
+  ASSERT_EQ(statuses.size(), 1);
+  EXPECT_EQ(statuses[0].violations.size(), 2);
+}
+
+TEST(SyntaxTreeLinterTest, StopWhenNeverDone) {
+  constexpr absl::string_view text("abcd");
+  SymbolPtr root =
+      Node(Leaf(3, text.substr(0, 1)), Leaf(3, text.substr(1, 1)),
+           Node(Leaf(3, text.substr(2, 1))), Leaf(3, text.substr(3, 1)));
+  ASSERT_NE(root, nullptr);
+  SyntaxTreeLinter linter;
+  linter.AddRule(MakeRuleN(2));
+  int checks = 0;
+  linter.StopWhen(
+      [&checks]() {
+        ++checks;
+        return false;
+      },
+      2);
+  linter.Lint(*root);
+  EXPECT_EQ(linter.ReportStatus()[0].violations.size(), 4);
+  EXPECT_EQ(checks, 3);  // Every other one of the 6 symbols.
+}
+
+TEST(SyntaxTreeLinterTest, SkipSubtreesWhere) {
+  constexpr absl::string_view text("abcde");
+  SymbolPtr root =
+      Node(Leaf(3, text.substr(0, 1)), Leaf(3, text.substr(1, 1)),
+           Node(Leaf(3, text.substr(2, 1)), Leaf(2, text.substr(3, 1))),
+           Leaf(3, text.substr(4, 1)));
+  ASSERT_NE(root.get(), nullptr);
+  const Symbol *const inner_node =
+      down_cast<const SyntaxTreeNode &>(*root).children().begin()[2].get();
+  SyntaxTreeLinter linter;
+  linter.AddRule(MakeRuleN(2));
+  // Skips the inner node and the leaf "b".
+  linter.SkipSubtreesWhere([&](const Symbol &symbol) {
+    return &symbol == inner_node ||
+           (symbol.Kind() == SymbolKind::kLeaf &&
+            down_cast<const SyntaxTreeLeaf &>(symbol).get().text() == "b");
+  });
+  linter.Lint(*root);
+  const std::vector<LintRuleStatus> statuses = linter.ReportStatus();
+  ASSERT_EQ(statuses.size(), 1);
+  std::vector<absl::string_view> found;
+  for (const auto &violation : statuses[0].violations) {
+    found.push_back(violation.token.text());
+  }
+  EXPECT_EQ(found, std::vector<absl::string_view>({"a", "e"}));
+}
+
 }  // namespace
 }  // namespace verible
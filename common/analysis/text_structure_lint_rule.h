@@ -30,7 +30,10 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_TEXT_STRUCTURE_LINT_RULE_H_
 #define VERIBLE_COMMON_ANALYSIS_TEXT_STRUCTURE_LINT_RULE_H_
 
+#include <vector>
+
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule.h"
 #include "common/text/text_structure.h"
 
@@ -43,6 +46,15 @@ class TextStructureLintRule : public LintRule {
   // Analyze text structure for violations.
   virtual void Lint(const TextStructureView &text_structure,
                     absl::string_view filename) = 0;
+
+  // Same as Lint(), with the lines of 'text_structure' already scanned by
+  // ScanLines(). Rules that need these facts should override this, to avoid
+  // scanning the text again.
+  virtual void LintScannedLines(const TextStructureView &text_structure,
+                                absl::string_view filename,
+                                const std::vector<LineScan> &line_scans) {
+    Lint(text_structure, filename);
+  }
 };
 
 }  // namespace verible
@@ -14,9 +14,12 @@
 
 #include "common/analysis/text_structure_linter.h"
 
+#include <cstddef>
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/text_structure_lint_rule.h"
 #include "common/text/text_structure.h"
@@ -28,8 +31,22 @@ void TextStructureLinter::Lint(const TextStructureView &text_structure,
                                absl::string_view filename) {
   VLOG(1) << "TextStructureLinter analyzing text with " << rules_.size()
           << " rules.";
-  for (const auto &rule : rules_) {
-    ABSL_DIE_IF_NULL(rule)->Lint(text_structure, filename);
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    TextStructureLintRule *const r = ABSL_DIE_IF_NULL(rules_[i]).get();
+    timer_.Time(i, [&]() { r->Lint(text_structure, filename); });
+  }
+}
+
+void TextStructureLinter::Lint(const TextStructureView &text_structure,
+                               absl::string_view filename,
+                               const std::vector<LineScan> &line_scans) {
+  VLOG(1) << "TextStructureLinter analyzing text with " << rules_.size()
+          << " rules.";
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    TextStructureLintRule *const r = ABSL_DIE_IF_NULL(rules_[i]).get();
+    timer_.Time(i, [&]() {
+      r->LintScannedLines(text_structure, filename, line_scans);
+    });
   }
 }
 
@@ -42,4 +59,19 @@ std::vector<LintRuleStatus> TextStructureLinter::ReportStatus() const {
   return status;
 }
 
+size_t TextStructureLinter::ViolationCount() const {
+  size_t count = 0;
+  for (const auto &rule : rules_) count += rule->ViolationCount();
+  return count;
+}
+
+std::vector<LintTiming> TextStructureLinter::RuleTimings() const {
+  std::vector<LintTiming> timings;
+  timings.reserve(rules_.size());
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    timings.push_back(timer_.Get(i));
+  }
+  return timings;
+}
+
 }  // namespace verible
@@ -19,11 +19,14 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_TEXT_STRUCTURE_LINTER_H_
 #define VERIBLE_COMMON_ANALYSIS_TEXT_STRUCTURE_LINTER_H_
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/text_structure_lint_rule.h"
 #include "common/text/text_structure.h"
@@ -35,6 +38,11 @@ class TextStructureLinter {
   // Analyzes a sequence of tokens.
   void Lint(const TextStructureView &, absl::string_view);
 
+  // Same as Lint(), with 'line_scans' of all lines of the text, from
+  // ScanLines(), shared with the rules that use them.
+  void Lint(const TextStructureView &, absl::string_view,
+            const std::vector<LineScan> &line_scans);
+
   // Transfers ownership of rule into this Linter
   void AddRule(std::unique_ptr<TextStructureLintRule> rule) {
     rules_.emplace_back(std::move(rule));
@@ -43,10 +51,24 @@ class TextStructureLinter {
   // Aggregates results of each held LintRule
   std::vector<LintRuleStatus> ReportStatus() const;
 
+  // Returns the number of violations found by all rules so far, without
+  // collecting them like ReportStatus().
+  size_t ViolationCount() const;
+
+  // Measures the time spent in each rule from now on.
+  void EnableProfiling() { timer_.Enable(); }
+
+  // Returns the time spent in each rule, in the same order as
+  // ReportStatus(). All zero unless profiling is enabled.
+  std::vector<LintTiming> RuleTimings() const;
+
  private:
   // List of rules that the linter is using. Rules are responsible for tracking
   // their own internal state.
   std::vector<std::unique_ptr<TextStructureLintRule>> rules_;
+
+  // Accounts the time spent in each rule, if profiling is enabled.
+  LintRuleTimer timer_;
 };
 
 }  // namespace verible
@@ -20,6 +20,7 @@
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/text_structure_lint_rule.h"
 #include "common/text/text_structure.h"
@@ -54,6 +55,33 @@ class RequireHelloRule : public TextStructureLintRule {
   std::set<LintViolation> violations_;
 };
 
+// Example lint rule that only uses the scans of lines.
+class NoTabsRule : public TextStructureLintRule {
+ public:
+  void Lint(const TextStructureView &text_structure,
+            absl::string_view filename) final {
+    LintScannedLines(text_structure, filename,
+                     ScanLines(text_structure.Contents()));
+  }
+
+  void LintScannedLines(const TextStructureView &text_structure,
+                        absl::string_view filename,
+                        const std::vector<LineScan> &line_scans) final {
+    const auto &lines = text_structure.Lines();
+    for (size_t i = 0; i < line_scans.size(); ++i) {
+      if (line_scans[i].first_tab != absl::string_view::npos) {
+        const TokenInfo token(1, lines[i].substr(line_scans[i].first_tab, 1));
+        violations_.emplace(token, "No tabs");
+      }
+    }
+  }
+
+  LintRuleStatus Report() const final { return LintRuleStatus(violations_); }
+
+ private:
+  std::set<LintViolation> violations_;
+};
+
 std::unique_ptr<TextStructureLintRule> MakeHelloRule() {
   return std::unique_ptr<TextStructureLintRule>(new RequireHelloRule);
 }
@@ -91,5 +119,19 @@ TEST(TextStructureLinterTest, OneRuleRejectsTextStructure) {
   EXPECT_THAT(statuses[0].violations, SizeIs(1));
 }
 
+// This test verifies that rules get shared line scans, and that rules that
+// don't use them still run.
+TEST(TextStructureLinterTest, RulesWithLineScans) {
+  const TextStructureView text_structure("Goodbye\tcruel world.\n\t\n");
+  TextStructureLinter linter;
+  linter.AddRule(MakeHelloRule());
+  linter.AddRule(std::make_unique<NoTabsRule>());
+  linter.Lint(text_structure, "", ScanLines(text_structure.Contents()));
+  std::vector<LintRuleStatus> statuses = linter.ReportStatus();
+  ASSERT_THAT(statuses, SizeIs(2));
+  EXPECT_THAT(statuses[0].violations, SizeIs(1));
+  EXPECT_THAT(statuses[1].violations, SizeIs(2));
+}
+
 }  // namespace
 }  // namespace verible
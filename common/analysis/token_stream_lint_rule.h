@@ -19,15 +19,24 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_TOKEN_STREAM_LINT_RULE_H_
 #define VERIBLE_COMMON_ANALYSIS_TOKEN_STREAM_LINT_RULE_H_
 
+#include <vector>
+
 #include "common/analysis/lint_rule.h"
 #include "common/text/token_info.h"
 
 namespace verible {
 
+// Rules that only look at a few kinds of tokens should override
+// InterestedTokenEnums(), so that the linter skips calling them for all others.
 class TokenStreamLintRule : public LintRule {
  public:
   ~TokenStreamLintRule() override = default;
 
+  // Returns the enums of the tokens this rule wants to handle.
+  // HandleToken() is only called for tokens with one of these enums.
+  // An empty list, the default, means that the rule handles every token.
+  virtual std::vector<int> InterestedTokenEnums() const { return {}; }
+
   // Scans a single token during analysis.
   virtual void HandleToken(const TokenInfo &token) = 0;
 };
@@ -14,10 +14,13 @@
 
 #include "common/analysis/token_stream_linter.h"
 
+#include <cstddef>
 #include <vector>
 
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/token_stream_lint_rule.h"
+#include "common/text/token_info.h"
 #include "common/text/token_stream_view.h"
 #include "common/util/logging.h"
 
@@ -27,12 +30,30 @@ void TokenStreamLinter::Lint(const TokenSequence &tokens) {
   VLOG(1) << "TokenStreamLinter analyzing tokens with " << rules_.size()
           << " rules.";
   for (const auto &token : tokens) {
-    for (const auto &rule : rules_) {
-      ABSL_DIE_IF_NULL(rule)->HandleToken(token);
-    }
+    HandleToken(token);
   }
 }
 
+void TokenStreamLinter::HandleToken(const TokenInfo &token) {
+  for (const size_t i : RulesFor(token.token_enum())) {
+    TokenStreamLintRule *const rule = rules_[i].get();
+    timer_.Time(i, [rule, &token]() { rule->HandleToken(token); });
+  }
+}
+
+const std::vector<size_t> &TokenStreamLinter::RulesFor(int token_enum) {
+  if (!dispatch_valid_) BuildDispatchTable();
+  return rule_table_.Get(token_enum);
+}
+
+void TokenStreamLinter::BuildDispatchTable() {
+  rule_table_.Clear();
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    rule_table_.Add(i, ABSL_DIE_IF_NULL(rules_[i])->InterestedTokenEnums());
+  }
+  dispatch_valid_ = true;
+}
+
 std::vector<LintRuleStatus> TokenStreamLinter::ReportStatus() const {
   std::vector<LintRuleStatus> status;
   status.reserve(rules_.size());
@@ -42,4 +63,19 @@ std::vector<LintRuleStatus> TokenStreamLinter::ReportStatus() const {
   return status;
 }
 
+size_t TokenStreamLinter::ViolationCount() const {
+  size_t count = 0;
+  for (const auto &rule : rules_) count += rule->ViolationCount();
+  return count;
+}
+
+std::vector<LintTiming> TokenStreamLinter::RuleTimings() const {
+  std::vector<LintTiming> timings;
+  timings.reserve(rules_.size());
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    timings.push_back(timer_.Get(i));
+  }
+  return timings;
+}
+
 }  // namespace verible
@@ -19,13 +19,17 @@
 #ifndef VERIBLE_COMMON_ANALYSIS_TOKEN_STREAM_LINTER_H_
 #define VERIBLE_COMMON_ANALYSIS_TOKEN_STREAM_LINTER_H_
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/token_stream_lint_rule.h"
+#include "common/text/token_info.h"
 #include "common/text/token_stream_view.h"
+#include "common/util/tag_dispatch_table.h"
 
 namespace verible {
 
@@ -34,18 +38,48 @@ class TokenStreamLinter {
   // Analyzes a sequence of tokens.
   void Lint(const TokenSequence &tokens);
 
+  // Analyzes a single token. Lint() is the same as calling this on every
+  // token in order, which lets callers interleave it with other passes.
+  void HandleToken(const TokenInfo &token);
+
   // Transfers ownership of rule into this Linter
   void AddRule(std::unique_ptr<TokenStreamLintRule> rule) {
     rules_.emplace_back(std::move(rule));
+    dispatch_valid_ = false;
   }
 
   // Aggregates results of each held LintRule
   std::vector<LintRuleStatus> ReportStatus() const;
 
+  // Returns the number of violations found by all rules so far, without
+  // collecting them like ReportStatus().
+  size_t ViolationCount() const;
+
+  // Measures the time spent in each rule from now on.
+  void EnableProfiling() { timer_.Enable(); }
+
+  // Returns the time spent in each rule, in the same order as
+  // ReportStatus(). All zero unless profiling is enabled.
+  std::vector<LintTiming> RuleTimings() const;
+
  private:
+  // Returns the indices of the rules interested in tokens with 'token_enum',
+  // in the order they were added.
+  const std::vector<size_t> &RulesFor(int token_enum);
+
+  // Builds the per-enum rule lists from the rules' InterestedTokenEnums().
+  void BuildDispatchTable();
+
   // List of rules that the linter is using. Rules are responsible for tracking
   // their own internal state.
   std::vector<std::unique_ptr<TokenStreamLintRule>> rules_;
+
+  // Accounts the time spent in each rule, if profiling is enabled.
+  LintRuleTimer timer_;
+
+  // Indices of the rules to run for each token enum.
+  TagDispatchTable rule_table_;
+  bool dispatch_valid_ = false;
 };
 
 }  // namespace verible
@@ -16,11 +16,13 @@
 
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/token_stream_lint_rule.h"
+#include "common/text/constants.h"
 #include "common/text/token_info.h"
 #include "common/text/token_stream_view.h"
 #include "gmock/gmock.h"
@@ -29,6 +31,7 @@
 namespace verible {
 namespace {
 
+using testing::ElementsAre;
 using testing::IsEmpty;
 using testing::SizeIs;
 
@@ -90,5 +93,49 @@ TEST(TokenStreamLinterTest, OneRuleRejectsTokenStream) {
   EXPECT_THAT(statuses[0].violations, SizeIs(1));
 }
 
+// Records the enums of all tokens it handles.
+class RecordingTokenRule : public TokenStreamLintRule {
+ public:
+  explicit RecordingTokenRule(std::vector<int> interests)
+      : interests_(std::move(interests)) {}
+
+  std::vector<int> InterestedTokenEnums() const final { return interests_; }
+
+  void HandleToken(const TokenInfo &token) final {
+    seen_.push_back(token.token_enum());
+  }
+
+  LintRuleStatus Report() const final { return LintRuleStatus(); }
+
+  const std::vector<int> &seen() const { return seen_; }
+
+ private:
+  const std::vector<int> interests_;
+  std::vector<int> seen_;
+};
+
+// This test verifies that rules only handle the tokens they are interested in.
+TEST(TokenStreamLinterTest, RulesOnlyHandleInterestedEnums) {
+  const absl::string_view text;
+  const TokenSequence tokens = {TokenInfo(1, text), TokenInfo(4, text),
+                                TokenInfo(2, text), TokenInfo(4, text),
+                                TokenInfo(100, text), TokenInfo::EOFToken()};
+  auto all = std::make_unique<RecordingTokenRule>(std::vector<int>{});
+  auto some = std::make_unique<RecordingTokenRule>(std::vector<int>{4, 2, 4});
+  auto none = std::make_unique<RecordingTokenRule>(std::vector<int>{7});
+  const RecordingTokenRule *all_rule = all.get();
+  const RecordingTokenRule *some_rule = some.get();
+  const RecordingTokenRule *none_rule = none.get();
+
+  TokenStreamLinter linter;
+  linter.AddRule(std::move(all));
+  linter.AddRule(std::move(some));
+  linter.AddRule(std::move(none));
+  linter.Lint(tokens);
+  EXPECT_THAT(all_rule->seen(), ElementsAre(1, 4, 2, 4, 100, TK_EOF));
+  EXPECT_THAT(some_rule->seen(), ElementsAre(4, 2, 4));
+  EXPECT_THAT(none_rule->seen(), IsEmpty());
+}
+
 }  // namespace
 }  // namespace verible
@@ -26,9 +26,12 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "common/strings/diff.h"
+#include "common/strings/line_column_map.h"
+#include "common/text/token_info.h"
 #include "common/util/file_util.h"
 #include "common/util/logging.h"
 #include "common/util/user_interaction.h"
+#include "nlohmann/json.hpp"
 
 namespace verible {
 namespace {
@@ -62,29 +65,69 @@ void PrintFixAlternatives(std::ostream& stream, absl::string_view text,
 void ViolationPrinter::HandleViolations(
     const std::set<LintViolationWithStatus>& violations, absl::string_view base,
     absl::string_view path) {
+  // Output streams like std::cerr are unbuffered; format everything first, so
+  // that there is a single write per file.
+  std::ostringstream buffer;
   verible::LintStatusFormatter formatter(base);
   for (auto violation : violations) {
-    formatter.FormatViolation(stream_, *violation.violation, base, path,
+    formatter.FormatViolation(&buffer, *violation.violation, base, path,
                               violation.status->url,
                               violation.status->lint_rule_name);
-    (*stream_) << std::endl;
+    buffer << '\n';
   }
+  (*stream_) << buffer.str();
+}
+
+void ViolationJsonLinesPrinter::HandleViolations(
+    const std::set<LintViolationWithStatus>& violations, absl::string_view base,
+    absl::string_view path) {
+  std::string buffer;
+  const LineColumnMap line_column_map(base);
+  const std::string file(path);
+  for (auto violation : violations) {
+    const verible::TokenInfo& token = violation.violation->token;
+    const LineColumn start =
+        line_column_map.GetLineColAtOffset(base, token.left(base));
+    const LineColumn end =
+        line_column_map.GetLineColAtOffset(base, token.right(base));
+    const nlohmann::json line = {
+        {"file", file},
+        {"line", start.line + 1},
+        {"column", start.column + 1},
+        {"end_line", end.line + 1},
+        {"end_column", end.column + 1},
+        {"rule", std::string(violation.status->lint_rule_name)},
+        {"reason", violation.violation->reason},
+        {"url", violation.status->url},
+        {"autofix", !violation.violation->autofixes.empty()},
+    };
+    // Invalid UTF-8, e.g. in a file name, must not abort the output.
+    absl::StrAppend(&buffer,
+                    line.dump(-1, ' ', false,
+                              nlohmann::json::error_handler_t::replace),
+                    "\n");
+  }
+  (*stream_) << buffer;
 }
 
 void ViolationWaiverPrinter::HandleViolations(
     const std::set<LintViolationWithStatus>& violations, absl::string_view base,
     absl::string_view path) {
+  std::ostringstream messages;
+  std::ostringstream waivers;
   verible::LintStatusFormatter formatter(base);
   for (auto violation : violations) {
-    formatter.FormatViolation(message_stream_, *violation.violation, base, path,
+    formatter.FormatViolation(&messages, *violation.violation, base, path,
                               violation.status->url,
                               violation.status->lint_rule_name);
-    (*message_stream_) << std::endl;
+    messages << '\n';
 
-    formatter.FormatViolationWaiver(waiver_stream_, *violation.violation, base,
-                                    path, violation.status->lint_rule_name);
-    (*waiver_stream_) << std::endl;
+    formatter.FormatViolationWaiver(&waivers, *violation.violation, base, path,
+                                    violation.status->lint_rule_name);
+    waivers << '\n';
   }
+  (*message_stream_) << messages.str();
+  (*waiver_stream_) << waivers.str();
 }
 
 void ViolationFixer::CommitFixes(absl::string_view source_content,
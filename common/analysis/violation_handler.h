@@ -44,7 +44,8 @@ class ViolationHandler {
 };
 
 // ViolationHandler that prints all violations in a form of user-friendly
-// messages.
+// messages. The messages of one file are written to the stream at once,
+// without flushing it.
 class ViolationPrinter : public ViolationHandler {
  public:
   explicit ViolationPrinter(std::ostream* stream) : stream_(stream) {}
@@ -58,6 +59,28 @@ class ViolationPrinter : public ViolationHandler {
   verible::LintStatusFormatter* formatter_ = nullptr;
 };
 
+// ViolationHandler that prints all violations as JSON Lines: one JSON object
+// per violation and line, for consumption by other tools. Like
+// ViolationPrinter, it writes the violations of one file at once.
+//
+// Example line (wrapped here):
+//   {"autofix":true,"column":6,"end_column":7,"end_line":1,"file":"foo.sv",
+//    "line":1,"reason":"Use spaces, not tabs.","rule":"no-tabs","url":"..."}
+//
+// Lines and columns are 1-based; the end position is one past the last
+// character of the violation.
+class ViolationJsonLinesPrinter : public ViolationHandler {
+ public:
+  explicit ViolationJsonLinesPrinter(std::ostream* stream) : stream_(stream) {}
+
+  void HandleViolations(
+      const std::set<verible::LintViolationWithStatus>& violations,
+      absl::string_view base, absl::string_view path) override;
+
+ private:
+  std::ostream* const stream_;
+};
+
 // ViolationHandler that prints all violations in a format required by
 // --waiver_files flag
 class ViolationWaiverPrinter : public ViolationHandler {
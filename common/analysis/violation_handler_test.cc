@@ -0,0 +1,103 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/analysis/violation_handler.h"
+
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+#include "common/analysis/lint_rule_status.h"
+#include "common/text/token_info.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+constexpr absl::string_view kText = "wire\tx;\nwire y_;\n";
+
+class ViolationHandlerTest : public testing::Test {
+ protected:
+  ViolationHandlerTest()
+      : tab_status_({LintViolation(TokenInfo(1, kText.substr(4, 1)),
+                                   "tab found",
+                                   {AutoFix("Replace tab", {{kText.substr(4, 1),
+                                                             " "}})})},
+                    "no-tabs", "https://example.com/tabs"),
+        name_status_({LintViolation(TokenInfo(2, kText.substr(13, 2)),
+                                    "bad \"name\"")},
+                     "naming", "https://example.com/naming") {
+    for (const LintRuleStatus* status : {&name_status_, &tab_status_}) {
+      for (const LintViolation& violation : status->violations) {
+        violations_.emplace(&violation, status);
+      }
+    }
+  }
+
+  const LintRuleStatus tab_status_;
+  const LintRuleStatus name_status_;
+  std::set<LintViolationWithStatus> violations_;
+};
+
+TEST_F(ViolationHandlerTest, PrinterWritesSortedMessages) {
+  std::ostringstream output;
+  ViolationPrinter printer(&output);
+  printer.HandleViolations(violations_, kText, "a.sv");
+  EXPECT_EQ(output.str(),
+            "a.sv:1:5: tab found https://example.com/tabs [no-tabs]\n"
+            "a.sv:2:6-7: bad \"name\" https://example.com/naming [naming]\n");
+}
+
+TEST_F(ViolationHandlerTest, JsonLinesPrinter) {
+  std::ostringstream output;
+  ViolationJsonLinesPrinter printer(&output);
+  printer.HandleViolations(violations_, kText, "a.sv");
+  printer.HandleViolations({}, kText, "b.sv");
+  EXPECT_EQ(output.str(),
+            R"({"autofix":true,"column":5,"end_column":6,"end_line":1,)"
+            R"("file":"a.sv","line":1,"reason":"tab found","rule":"no-tabs",)"
+            R"("url":"https://example.com/tabs"})"
+            "\n"
+            R"({"autofix":false,"column":6,"end_column":8,"end_line":2,)"
+            R"("file":"a.sv","line":2,"reason":"bad \"name\"",)"
+            R"("rule":"naming","url":"https://example.com/naming"})"
+            "\n");
+}
+
+TEST_F(ViolationHandlerTest, JsonLinesPrinterReplacesInvalidUtf8) {
+  std::ostringstream output;
+  ViolationJsonLinesPrinter printer(&output);
+  printer.HandleViolations(violations_, kText, "\xff.sv");
+  // Replaced by U+FFFD, the replacement character.
+  EXPECT_TRUE(absl::StrContains(output.str(), "\"file\":\"\xef\xbf\xbd.sv\""))
+      << output.str();
+}
+
+TEST_F(ViolationHandlerTest, WaiverPrinter) {
+  std::ostringstream messages;
+  std::ostringstream waivers;
+  ViolationWaiverPrinter printer(&messages, &waivers);
+  printer.HandleViolations(violations_, kText, "a.sv");
+  EXPECT_EQ(messages.str(),
+            "a.sv:1:5: tab found https://example.com/tabs [no-tabs]\n"
+            "a.sv:2:6-7: bad \"name\" https://example.com/naming [naming]\n");
+  EXPECT_EQ(waivers.str(),
+            "waive --rule=no-tabs --line=1 --location=\"a.sv\"\n"
+            "waive --rule=naming --line=2 --location=\"a.sv\"\n");
+}
+
+}  // namespace
+}  // namespace verible
@@ -26,10 +26,14 @@
 #include <ios>
 #include <limits>
 #include <ostream>
+#include <string>
 #include <utility>
 
 #include "absl/container/fixed_array.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "common/formatting/basic_format_style.h"
+#include "common/formatting/format_token.h"
 #include "common/formatting/layout_optimizer_internal.h"
 #include "common/formatting/line_wrap_searcher.h"
 #include "common/formatting/token_partition_tree.h"
@@ -109,6 +113,35 @@ int AlreadyFormattedPartitionLength(const TokenPartitionTree& partition) {
   return width;
 }
 
+// Appends to 'key' everything about 'token' that layout functions depend on.
+// Token texts only matter through their lengths and line breaks.
+void AppendTokenLayoutKey(const PreFormatToken& token, std::string* key) {
+  const absl::string_view text = token.Text();
+  absl::StrAppend(key, token.Length(), ",",
+                  static_cast<int>(text.find_first_of('\n')), ",",
+                  static_cast<int>(text.find_last_of('\n')), ",",
+                  token.before.spaces_required, ",",
+                  token.before.break_penalty, ",",
+                  static_cast<int>(token.before.break_decision), ",",
+                  static_cast<int>(token.balancing));
+  if (token.before.break_decision == SpacingOptions::kPreserve) {
+    // Preserved spacing is copied as is.
+    const absl::string_view spaces = token.OriginalLeadingSpaces();
+    absl::StrAppend(key, ",", spaces.size(), ":", spaces);
+  }
+  absl::StrAppend(key, ";");
+}
+
+// Moves the tokens of all layouts in 'lf' by 'offset'.
+void ShiftTokensRanges(std::ptrdiff_t offset, LayoutFunction* lf) {
+  if (offset == 0) return;
+  for (auto& segment : *lf) {
+    ApplyPreOrder(segment.layout, [offset](LayoutItem& item) {
+      if (item.Type() == LayoutType::kLine) item.ShiftTokensRange(offset);
+    });
+  }
+}
+
 // Largest possible column value, used as infinity.
 constexpr int kInfinity = std::numeric_limits<int>::max();
 
@@ -491,6 +524,69 @@ void TokenPartitionsLayoutOptimizer::Optimize(int indentation,
 
 LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayout(
     const TokenPartitionTree& node) const {
+  PartitionLayoutKeys keys;
+  AssignLayoutKeys(node, &keys);
+  return CalculateOptimalLayout(node, keys);
+}
+
+LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayout(
+    const TokenPartitionTree& node, const PartitionLayoutKeys& keys) const {
+  // Other leaves are single lines, which are cheaper to calculate than to
+  // look up.
+  if (is_leaf(node) &&
+      node.Value().PartitionPolicy() != PartitionPolicyEnum::kWrap) {
+    return CalculateOptimalLayoutUncached(node, keys);
+  }
+
+  const int key = keys.at(&node);
+  const auto tokens_begin = node.Value().TokensRange().begin();
+  const auto found = layout_cache_.find(key);
+  if (found != layout_cache_.end()) {
+    VLOG(4) << __FUNCTION__ << ": reusing layout function of an identical "
+            << "partition";
+    LayoutFunction lf = found->second.layout_function;
+    ShiftTokensRanges(tokens_begin - found->second.tokens_begin, &lf);
+    return lf;
+  }
+  LayoutFunction lf = CalculateOptimalLayoutUncached(node, keys);
+  layout_cache_.emplace(key, CachedLayout{lf, tokens_begin});
+  return lf;
+}
+
+int TokenPartitionsLayoutOptimizer::AssignLayoutKeys(
+    const TokenPartitionTree& node, PartitionLayoutKeys* keys) const {
+  // Each token is described once, by the lowest partition that has it;
+  // subpartitions are referred to by their keys. Token positions are left
+  // out, so that identical partitions at different positions have equal
+  // keys.
+  const UnwrappedLine& uwline = node.Value();
+  const FormatTokenRange tokens = uwline.TokensRange();
+  std::string key;
+  absl::StrAppend(&key, static_cast<int>(uwline.PartitionPolicy()), ",",
+                  uwline.IndentationSpaces(), ",", tokens.size(), "(");
+  auto next_token = tokens.begin();
+  for (const auto& child : node.Children()) {
+    const FormatTokenRange child_tokens = child.Value().TokensRange();
+    for (; next_token < child_tokens.begin(); ++next_token) {
+      AppendTokenLayoutKey(*next_token, &key);
+    }
+    absl::StrAppend(&key, "#", AssignLayoutKeys(child, keys), ";");
+    next_token = std::max(next_token, child_tokens.end());
+  }
+  for (; next_token < tokens.end(); ++next_token) {
+    AppendTokenLayoutKey(*next_token, &key);
+  }
+  absl::StrAppend(&key, ")");
+
+  const int id =
+      layout_keys_.try_emplace(std::move(key), layout_keys_.size())
+          .first->second;
+  (*keys)[&node] = id;
+  return id;
+}
+
+LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayoutUncached(
+    const TokenPartitionTree& node, const PartitionLayoutKeys& keys) const {
   if (is_leaf(node)) {
     // Wrapping complexity is n*(n+1)/2.
     constexpr int kWrapTokensLimit = 25;
@@ -515,8 +611,9 @@ LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayout(
     case PartitionPolicyEnum::kAppendFittingSubPartitions:
     case PartitionPolicyEnum::kJuxtapositionOrIndentedStack: {
       std::transform(node.Children().begin(), node.Children().end(),
-                     layouts.begin(), [this](const TokenPartitionTree& n) {
-                       return this->CalculateOptimalLayout(n);
+                     layouts.begin(),
+                     [this, &keys](const TokenPartitionTree& n) {
+                       return this->CalculateOptimalLayout(n, keys);
                      });
       break;
     }
@@ -527,7 +624,7 @@ LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayout(
       const int indentation = node.Value().IndentationSpaces();
       std::transform(
           node.Children().begin(), node.Children().end(), layouts.begin(),
-          [this, &node, indentation](const TokenPartitionTree& n) {
+          [this, &node, &keys, indentation](const TokenPartitionTree& n) {
             const int relative_indentation =
                 n.Value().IndentationSpaces() - indentation;
             if (relative_indentation < 0) {
@@ -539,10 +636,10 @@ LayoutFunction TokenPartitionsLayoutOptimizer::CalculateOptimalLayout(
             LayoutFunction lf;
 
             if (relative_indentation > 0) {
-              lf = factory_.Indent(this->CalculateOptimalLayout(n),
+              lf = factory_.Indent(this->CalculateOptimalLayout(n, keys),
                                    relative_indentation);
             } else {
-              lf = this->CalculateOptimalLayout(n);
+              lf = this->CalculateOptimalLayout(n, keys);
             }
             return lf;
           });
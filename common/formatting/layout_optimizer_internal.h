@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "absl/container/fixed_array.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
@@ -163,6 +164,15 @@ class LayoutItem {
     return tokens_;
   }
 
+  // Moves the tokens range spanned by the Line item by 'offset' tokens, e.g.
+  // to reuse a layout of identical tokens elsewhere in the same sequence.
+  // Can be called only on Line items.
+  void ShiftTokensRange(std::ptrdiff_t offset) {
+    CHECK_EQ(type_, LayoutType::kLine);
+    tokens_ =
+        FormatTokenRange(tokens_.begin() + offset, tokens_.end() + offset);
+  }
+
   friend bool operator==(const LayoutItem &lhs, const LayoutItem &rhs) {
     return (lhs.type_ == rhs.type_ && lhs.indentation_ == rhs.indentation_ &&
             lhs.tokens_ == rhs.tokens_ &&
@@ -740,10 +750,43 @@ class TokenPartitionsLayoutOptimizer {
 
   void Optimize(int indentation, TokenPartitionTree *node) const;
 
+  // Returns the layout function of 'node'. Results for partitions with the
+  // same structure and token properties as a partition calculated before are
+  // copies of that partition's result, moved to the tokens of 'node'.
   LayoutFunction CalculateOptimalLayout(const TokenPartitionTree &node) const;
 
  private:
+  // Layout function of a partition, and the first token of that partition.
+  struct CachedLayout {
+    LayoutFunction layout_function;
+    FormatTokenRange::iterator tokens_begin;
+  };
+
+  // Keys of partitions, see AssignLayoutKeys().
+  using PartitionLayoutKeys =
+      absl::flat_hash_map<const TokenPartitionTree *, int>;
+
+  // Assigns keys to 'node' and all its subpartitions, and returns the key
+  // of 'node'. Partitions get equal keys if their layout functions are equal
+  // up to the positions of their tokens. Keys are built bottom-up from the
+  // keys of subpartitions, so that every token is only looked at once.
+  int AssignLayoutKeys(const TokenPartitionTree &node,
+                       PartitionLayoutKeys *keys) const;
+
+  LayoutFunction CalculateOptimalLayout(const TokenPartitionTree &node,
+                                        const PartitionLayoutKeys &keys) const;
+
+  LayoutFunction CalculateOptimalLayoutUncached(
+      const TokenPartitionTree &node, const PartitionLayoutKeys &keys) const;
+
   const LayoutFunctionFactory factory_;
+
+  // Keys of partitions by everything their layout functions depend on.
+  mutable absl::flat_hash_map<std::string, int> layout_keys_;
+
+  // Results of CalculateOptimalLayout(), by partition key. Instance lists
+  // and array initializers often repeat identical partitions.
+  mutable absl::flat_hash_map<int, CachedLayout> layout_cache_;
 };
 
 class TreeReconstructor {
@@ -2591,5 +2591,77 @@ TEST_F(TokenPartitionsLayoutOptimizerTest, CalculateOptimalLayout) {
   }
 }
 
+class RepeatedPartitionsLayoutOptimizerTest
+    : public ::testing::Test,
+      public UnwrappedLineMemoryHandler {
+ public:
+  RepeatedPartitionsLayoutOptimizerTest()
+      : sample_(
+            "f ( a , b )\n"
+            "f ( a , b )\n"
+            "f ( a , b )\n"),
+        tokens_(
+            absl::StrSplit(sample_, absl::ByAnyChar(" \n"), absl::SkipEmpty())),
+        style_(CreateStyle()) {
+    for (const auto token : tokens_) {
+      ftokens_.emplace_back(1, token);
+    }
+    CreateTokenInfosExternalStringBuffer(ftokens_);
+    ConnectPreFormatTokensPreservedSpaceStarts(sample_.data(),
+                                               &pre_format_tokens_);
+
+    for (auto& token : pre_format_tokens_) {
+      if (absl::StrContains(token.OriginalLeadingSpaces(), '\n')) {
+        token.before.break_decision = SpacingOptions::kMustWrap;
+      } else {
+        token.before.spaces_required = token.OriginalLeadingSpaces().size();
+      }
+    }
+    pre_format_tokens_.front().before.break_decision =
+        SpacingOptions::kMustWrap;
+  }
+
+ protected:
+  const std::string sample_;
+  const std::vector<absl::string_view> tokens_;
+  std::vector<TokenInfo> ftokens_;
+  const BasicFormatStyle style_;
+};
+
+TEST_F(RepeatedPartitionsLayoutOptimizerTest, ReusedLayoutsUseOwnTokens) {
+  using TPT = TokenPartitionTreeBuilder;
+  using PP = PartitionPolicyEnum;
+
+  const auto trees = {
+      TPT(PP::kAlwaysExpand,
+          {
+              TPT(PP::kFitOnLineElseExpand, {TPT(2, {0, 2}), TPT(4, {2, 6})}),
+              TPT(PP::kFitOnLineElseExpand, {TPT(2, {6, 8}), TPT(4, {8, 12})}),
+              TPT(PP::kFitOnLineElseExpand,
+                  {TPT(2, {12, 14}), TPT(4, {14, 18})}),
+          })
+          .build(pre_format_tokens_),
+      TPT(PP::kAlwaysExpand,
+          {
+              TPT(2, {0, 6}, PP::kWrap),
+              TPT(2, {6, 12}, PP::kWrap),
+              TPT(2, {12, 18}, PP::kWrap),
+          })
+          .build(pre_format_tokens_),
+  };
+
+  for (const auto& tree : trees) {
+    // Layouts of the later children come from the cache of the first one.
+    const auto optimizer = TokenPartitionsLayoutOptimizer(style_);
+    optimizer.CalculateOptimalLayout(tree);
+    for (const auto& child : tree.Children()) {
+      const auto fresh_optimizer = TokenPartitionsLayoutOptimizer(style_);
+      ExpectLayoutFunctionsEqual(optimizer.CalculateOptimalLayout(child),
+                                 fresh_optimizer.CalculateOptimalLayout(child),
+                                 __LINE__);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace verible
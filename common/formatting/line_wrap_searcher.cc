@@ -14,11 +14,13 @@
 
 #include "common/formatting/line_wrap_searcher.h"
 
-#include <memory>
+#include <cstddef>
 #include <ostream>
 #include <queue>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
 #include "common/formatting/basic_format_style.h"
 #include "common/formatting/format_token.h"
 #include "common/formatting/state_node.h"
@@ -32,16 +34,40 @@ namespace {
 
 // Wrapped class around StateNode for the sake of adapting to a
 // std::priority_queue interface.
-// TODO(fangism): if performance of memory allocations is an issue,
-// use some sort of pool-allocator.
 struct SearchState {
-  std::shared_ptr<const StateNode> state;
+  const StateNode *state;
 
-  explicit SearchState(const std::shared_ptr<const StateNode> &s) : state(s) {}
+  explicit SearchState(const StateNode *s) : state(s) {}
 
   // Inverted to min-heap: *lowest* penalty has the highest search priority.
   bool operator<(const SearchState &r) const { return *r.state < *state; }
 };
+
+// States that are about to decide on the same token, with the same column
+// position, decision on the current token and wrap column positions, have the
+// same future: every sequence of remaining decisions adds the same cost to
+// either of them. So of such equivalent states, only the first one expanded,
+// which has the lowest cost, needs to be explored.
+struct SameFutureHash {
+  size_t operator()(const StateNode *s) const {
+    return absl::HashOf(&s->GetNextToken(), s->current_column,
+                        s->spacing_choice, s->wrap_column_positions.size(),
+                        s->wrap_column_positions.top());
+  }
+};
+
+struct SameFutureEqual {
+  bool operator()(const StateNode *s, const StateNode *t) const {
+    return &s->GetNextToken() == &t->GetNextToken() &&
+           s->current_column == t->current_column &&
+           s->spacing_choice == t->spacing_choice &&
+           s->wrap_column_positions == t->wrap_column_positions;
+  }
+};
+
+// Expanded states, none of which is equivalent to another.
+using ExpandedStates =
+    absl::flat_hash_set<const StateNode *, SameFutureHash, SameFutureEqual>;
 }  // namespace
 
 std::vector<FormattedExcerpt> SearchLineWraps(const UnwrappedLine &uwline,
@@ -62,19 +88,37 @@ std::vector<FormattedExcerpt> SearchLineWraps(const UnwrappedLine &uwline,
   // important, consider switching to a std::map.
   std::priority_queue<SearchState> worklist;
 
+  // All states of this search, released when it is over.
+  StateNodeArena arena;
+  ExpandedStates expanded_states;
+  // Pushes a new state, unless an equivalent one was expanded already, at
+  // lower or equal cost.
+  const auto push_unless_dominated = [&](const StateNode *state) {
+    if (!state->Done() && expanded_states.contains(state)) return;
+    worklist.push(SearchState(state));
+  };
+
   // Seed worklist with a NodeState that should have 0 penalty.
-  SearchState seed(std::make_shared<StateNode>(uwline, style));
+  SearchState seed(arena.Create(uwline, style));
   worklist.push(seed);
 
   bool aborted_search = false;
-  std::vector<std::shared_ptr<const StateNode>> winning_paths;
+  std::vector<const StateNode *> winning_paths;
   int state_count = 0;
+  int dominated_count = 0;
   while (!worklist.empty()) {
-    ++state_count;
-
     SearchState next(worklist.top());
     worklist.pop();
 
+    // Dijkstra expands states in order of increasing cost, so an equivalent
+    // state expanded before never costs more.
+    // Final states are kept, they are the equally optimal solutions.
+    if (!next.state->Done() && !expanded_states.insert(next.state).second) {
+      ++dominated_count;
+      continue;
+    }
+    ++state_count;
+
     VLOG(4) << "\n---- line wrapping search state " << state_count << " ----"
             << "\ncurrent cost: " << next.state->cumulative_cost
             << "\ncurrent column: " << next.state->current_column;
@@ -104,7 +148,8 @@ std::vector<FormattedExcerpt> SearchLineWraps(const UnwrappedLine &uwline,
     if (state_count >= max_search_states) {
       // Search limit exceeded, abandon search.
       // Greedily finish formatting this partition, and return it.
-      winning_paths.push_back(StateNode::QuickFinish(next.state, style));
+      winning_paths.push_back(
+          StateNode::QuickFinish(next.state, style, &arena));
       aborted_search = true;
       break;
     }
@@ -115,29 +160,28 @@ std::vector<FormattedExcerpt> SearchLineWraps(const UnwrappedLine &uwline,
     const auto &token = next.state->GetNextToken();
     if (token.before.break_decision == SpacingOptions::kPreserve) {
       VLOG(4) << "preserving spaces before \'" << token.token->text() << '\'';
-      SearchState preserved(std::make_shared<StateNode>(
-          next.state, style, SpacingDecision::kPreserve));
-      worklist.push(preserved);
+      push_unless_dominated(
+          arena.Create(next.state, style, SpacingDecision::kPreserve));
     } else {
       // Remaining options are: Undecided, MustWrap, MustAppend
       // Explore one or both: SpacingDecision::Wrap/Append
       if (token.before.break_decision != SpacingOptions::kMustWrap) {
         VLOG(4) << "considering appending \'" << token.token->text() << '\'';
         // Consider cost of appending token to current line.
-        SearchState appended(std::make_shared<StateNode>(
-            next.state, style, SpacingDecision::kAppend));
-        worklist.push(appended);
-        VLOG(4) << "  cost: " << appended.state->cumulative_cost;
-        VLOG(4) << "  column: " << appended.state->current_column;
+        const StateNode *appended =
+            arena.Create(next.state, style, SpacingDecision::kAppend);
+        push_unless_dominated(appended);
+        VLOG(4) << "  cost: " << appended->cumulative_cost;
+        VLOG(4) << "  column: " << appended->current_column;
       }
       if (token.before.break_decision != SpacingOptions::kMustAppend) {
         VLOG(4) << "considering wrapping \'" << token.token->text() << '\'';
         // Consider cost of line wrapping here.
-        SearchState wrapped(std::make_shared<StateNode>(
-            next.state, style, SpacingDecision::kWrap));
-        worklist.push(wrapped);
-        VLOG(4) << "  cost: " << wrapped.state->cumulative_cost;
-        VLOG(4) << "  column: " << wrapped.state->current_column;
+        const StateNode *wrapped =
+            arena.Create(next.state, style, SpacingDecision::kWrap);
+        push_unless_dominated(wrapped);
+        VLOG(4) << "  cost: " << wrapped->cumulative_cost;
+        VLOG(4) << "  column: " << wrapped->current_column;
       }
     }
 
@@ -148,6 +192,8 @@ std::vector<FormattedExcerpt> SearchLineWraps(const UnwrappedLine &uwline,
   }  // while (!worklist.empty())
 
   CHECK_GE(winning_paths.size(), 1);
+  VLOG(3) << "search created " << arena.size() << " states, expanded "
+          << state_count << ", skipped " << dominated_count << " dominated";
 
   // Reconstruct the unwrapped_line to reflect the decisions made to reach the
   // winning_paths.  Return a modified copy of the original UnwrappedLine.
@@ -189,7 +235,8 @@ FitResult FitsOnLine(const UnwrappedLine &uwline,
 
   // Initialize on first token.
   // This accounts for space consumed by left-indentation.
-  auto state = std::make_shared<const StateNode>(uwline, style);
+  StateNodeArena arena;
+  const StateNode *state = arena.Create(uwline, style);
 
   while (!state->Done()) {
     const auto &token = state->GetNextToken();
@@ -199,7 +246,7 @@ FitResult FitsOnLine(const UnwrappedLine &uwline,
     }
 
     // Append token onto same line while it fits.
-    state = std::make_shared<StateNode>(state, style, SpacingDecision::kAppend);
+    state = arena.Create(state, style, SpacingDecision::kAppend);
     if (state->current_column > style.column_limit) {
       return {false, state->current_column};
     }
@@ -320,6 +320,33 @@ TEST_F(SearchLineWrapsTestFixture, ForcedWraps) {
             "         bbbbb ccccc");
 }
 
+// Test that states reached on different paths are only explored once, so that
+// long partitions with many equally good places to wrap finish their search.
+TEST_F(SearchLineWrapsTestFixture, EquivalentStatesExploredOnce) {
+  const std::vector<TokenInfo> tokens(24, {0, "aaa"});
+  CreateTokenInfos(tokens);
+  UnwrappedLine uwline_in(LevelsToSpaces(0), pre_format_tokens_.begin());
+  AddFormatTokens(&uwline_in);
+  for (auto &ftoken : pre_format_tokens_) {
+    ftoken.before.break_penalty = 2;
+    ftoken.before.spaces_required = 1;
+  }
+  const auto formatted_lines = verible::SearchLineWraps(uwline_in, style_, 500);
+  ASSERT_FALSE(formatted_lines.empty());
+  const auto &first = formatted_lines.front();
+  EXPECT_TRUE(first.CompletedFormatting());
+  // Five tokens fit on the first line, three on the wrapped ones.
+  EXPECT_EQ(first.Render(),
+            "aaa aaa aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa aaa aaa\n"
+            "      aaa");
+}
+
 // Test multiple equally good wrapping solutions can be found and diagnosed.
 TEST_F(SearchLineWrapsTestFixture, DisplayEquallyOptimalWrappings) {
   const std::vector<TokenInfo> tokens = {
@@ -19,7 +19,9 @@
 #include <iosfwd>
 #include <iterator>
 #include <memory>
-#include <stack>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "common/formatting/basic_format_style.h"
@@ -29,19 +31,67 @@
 
 namespace verible {
 
+// Stack of column positions that shares all elements below its top with the
+// stack it was copied from, so that copying, pushing and popping take
+// constant time and no allocation.
+// Pushed elements are stored by the caller, and must outlive the stack and
+// all of its copies.
+class ColumnPositionStack {
+ public:
+  struct Element {
+    int column = 0;
+    // Number of elements in the stack up to and including this one.
+    size_t depth = 0;
+    const Element *below = nullptr;
+  };
+
+  bool empty() const { return top_ == nullptr; }
+
+  size_t size() const { return empty() ? 0 : top_->depth; }
+
+  int top() const { return top_->column; }
+
+  // Pushes 'column', stored in 'element'.
+  void push(int column, Element *element) {
+    *element = {column, size() + 1, top_};
+    top_ = element;
+  }
+
+  void pop() { top_ = top_->below; }
+
+  // Returns true if both stacks hold the same column positions.
+  bool operator==(const ColumnPositionStack &r) const {
+    if (size() != r.size()) return false;
+    // Stops early where the stacks start sharing elements.
+    for (const Element *e = top_, *f = r.top_; e != f;
+         e = e->below, f = f->below) {
+      if (e->column != f->column) return false;
+    }
+    return true;
+  }
+  bool operator!=(const ColumnPositionStack &r) const { return !(*this == r); }
+
+ private:
+  const Element *top_ = nullptr;
+};
+
+class StateNodeArena;
+
 // A StateNode is used to keep a formatting state as the tokens of an
 // UnwrappedLine are searched left to right.  Each StateNode represents one
 // formatting decision: wrap or not-wrap.  Each StateNode maintains a pointer
 // to its parent state, which is used for backtracking once a solution
 // is reached.  StateNode is language-agnostic.
 // StateNode is purely an implementation detail of line_wrap_searcher.cc.
+// StateNodes of a search are allocated in a StateNodeArena, which keeps all
+// of them alive until the search is over.
 struct StateNode {
   using path_type = std::vector<PreFormatToken>;
   using range_type = container_iterator_range<path_type::const_iterator>;
 
   // The StateNode that has an edge to this StateNode, to backtrack once a final
   // state is reached.
-  std::shared_ptr<const StateNode> prev_state;
+  const StateNode *prev_state;
 
   // Iterator range marking the unexplored decisions beyond the current token.
   // TODO(fangism): make the iterator type a template parameter.  Might help
@@ -74,9 +124,8 @@ struct StateNode {
   // These column positions correspond to either the current indentation level
   // plus wrapping or the column position of the nearest group-opening
   // delimiter.
-  // TODO(b/135730018): re-implement to minimize copying of stacks.
-  // For example, use pointer or iterator to previous stack update.
-  std::stack<int> wrap_column_positions;
+  // Elements below the top are shared with the ancestor states.
+  ColumnPositionStack wrap_column_positions;
 
   // Constructor for the root node of the search path, with no parent.
   // This automatically places the first token at the beginning of a new line
@@ -88,8 +137,12 @@ struct StateNode {
   // Constructor for nodes that represent new wrap decision trees to explore.
   // 'spacing_choice' reflects the decision being explored, e.g. append, wrap,
   // preserve.
-  StateNode(const std::shared_ptr<const StateNode> &parent,
-            const BasicFormatStyle &style, SpacingDecision spacing_choice);
+  StateNode(const StateNode *parent, const BasicFormatStyle &style,
+            SpacingDecision spacing_choice);
+
+  // wrap_column_positions may refer to this state's own storage.
+  StateNode(const StateNode &) = delete;
+  StateNode &operator=(const StateNode &) = delete;
 
   // Returns true when the undecided_path is empty.
   // The search is over when there are no more decisions to explore.
@@ -110,7 +163,7 @@ struct StateNode {
 
   // Returns pointer to previous state before this decision node.
   // This functions as a forward-iterator going up the state ancestry chain.
-  const StateNode *next() const { return prev_state.get(); }
+  const StateNode *next() const { return prev_state; }
 
   // Returns true if this state was initialized with an unwrapped line and
   // has no parent state.
@@ -123,22 +176,23 @@ struct StateNode {
     const auto *iter = this;
     while (!iter->IsRootState()) {
       ++depth;
-      iter = iter->prev_state.get();
+      iter = iter->prev_state;
     }
     return depth;
   }
 
   // Produce next state by appending a token if the result stays under the
   // column limit, or breaking onto a new line if required.
-  static std::shared_ptr<const StateNode> AppendIfItFits(
-      const std::shared_ptr<const StateNode> &current_state,
-      const BasicFormatStyle &style);
+  // New states are allocated in 'arena'.
+  static const StateNode *AppendIfItFits(const StateNode *current_state,
+                                         const BasicFormatStyle &style,
+                                         StateNodeArena *arena);
 
   // Repeatedly apply AppendIfItFits() until Done() with formatting.
   // TODO(b/134711965): We may want a variant that preserves spaces too.
-  static std::shared_ptr<const StateNode> QuickFinish(
-      const std::shared_ptr<const StateNode> &current_state,
-      const BasicFormatStyle &style);
+  static const StateNode *QuickFinish(const StateNode *current_state,
+                                      const BasicFormatStyle &style,
+                                      StateNodeArena *arena);
 
   // Comparator provides an ordering of which paths should be explored
   // when maintained in a priority queue.  For Dijsktra-style algorithms,
@@ -164,10 +218,55 @@ struct StateNode {
  private:
   const PreFormatToken &GetPreviousToken() const;
 
+  // Pushes onto wrap_column_positions. Each state pushes at most once.
+  void PushWrapColumnPosition(int column);
+
   int UpdateColumnPosition();
   void UpdateCumulativeCost(const BasicFormatStyle &, int column_for_penalty);
   void OpenGroupBalance(const BasicFormatStyle &);
   void CloseGroupBalance();
+
+  // Storage of the element this state pushed onto wrap_column_positions.
+  ColumnPositionStack::Element pushed_wrap_column_position_;
+};
+
+// StateNodes only point to their ancestors, they don't own them, so that
+// creating one doesn't involve reference counting or copying.
+static_assert(std::is_trivially_destructible<StateNode>::value,
+              "StateNodeArena does not run destructors.");
+
+// StateNodeArena allocates the StateNodes of a search in blocks, and releases
+// all of them at once when it is destroyed.
+class StateNodeArena {
+ public:
+  StateNodeArena() = default;
+
+  StateNodeArena(const StateNodeArena &) = delete;
+  StateNodeArena &operator=(const StateNodeArena &) = delete;
+
+  // Constructs a StateNode with 'args', valid as long as this arena.
+  template <typename... Args>
+  const StateNode *Create(Args &&...args) {
+    ++size_;
+    return new (Allocate()) StateNode(std::forward<Args>(args)...);
+  }
+
+  // Returns the number of StateNodes created.
+  size_t size() const { return size_; }
+
+ private:
+  struct alignas(StateNode) Slot {
+    unsigned char bytes[sizeof(StateNode)];
+  };
+
+  // Returns uninitialized storage for one StateNode.
+  void *Allocate();
+
+  // Blocks grow in size, so that small searches stay cheap.
+  std::vector<std::unique_ptr<Slot[]>> blocks_;
+  size_t last_block_size_ = 0;
+  size_t last_block_used_ = 0;
+  size_t size_ = 0;
 };
 
 // Human-readable representation for debugging only.
@@ -17,7 +17,6 @@
 #include <cstddef>
 #include <memory>
 #include <sstream>
-#include <stack>
 #include <string>
 #include <vector>
 
@@ -33,6 +32,50 @@
 namespace verible {
 namespace {
 
+// Tests that copies of a stack share elements, but not pushes and pops.
+TEST(ColumnPositionStackTest, CopiesAreIndependent) {
+  ColumnPositionStack::Element elements[3];
+  ColumnPositionStack stack;
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.size(), 0);
+  stack.push(4, &elements[0]);
+  stack.push(8, &elements[1]);
+
+  ColumnPositionStack copy(stack);
+  copy.pop();
+  EXPECT_EQ(copy.size(), 1);
+  EXPECT_EQ(copy.top(), 4);
+  copy.push(6, &elements[2]);
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.top(), 6);
+
+  EXPECT_EQ(stack.size(), 2);
+  EXPECT_EQ(stack.top(), 8);
+  stack.pop();
+  EXPECT_EQ(stack.top(), 4);
+  stack.pop();
+  EXPECT_TRUE(stack.empty());
+}
+
+// Tests that stacks compare equal by their columns, shared or not.
+TEST(ColumnPositionStackTest, Equality) {
+  ColumnPositionStack::Element elements[4];
+  ColumnPositionStack stack, other;
+  EXPECT_EQ(stack, other);
+  stack.push(4, &elements[0]);
+  EXPECT_NE(stack, other);
+  other.push(4, &elements[1]);
+  EXPECT_EQ(stack, other);
+
+  ColumnPositionStack copy(stack);
+  copy.push(8, &elements[2]);
+  other.push(8, &elements[3]);
+  EXPECT_EQ(copy, other);
+  EXPECT_NE(copy, stack);
+  copy.pop();
+  EXPECT_EQ(copy, stack);
+}
+
 std::string RenderFormattedText(const StateNode &path,
                                 const UnwrappedLine &uwline) {
   FormattedExcerpt formatted_line(uwline);
@@ -72,6 +115,7 @@ struct StateNodeTestFixture : public UnwrappedLineMemoryHandler,
 
   BasicFormatStyle style;
   std::unique_ptr<UnwrappedLine> uwline;
+  StateNodeArena arena;
 };
 
 // Tests that root StateNode of search can be initialized with full
@@ -138,7 +182,7 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevState) {
   ftokens[0].before.spaces_required = 1;
   ftokens[1].before.spaces_required = 1;
   ftokens[1].before.break_penalty = 5;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -151,9 +195,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevState) {
   const auto &child_state = parent_state;
   {
     // Second token, also appended to same line as first:
-    auto child2_state = std::make_shared<StateNode>(child_state, style,
-                                                    SpacingDecision::kAppend);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+    auto child2_state =
+        arena.Create(child_state, style, SpacingDecision::kAppend);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               child_state->current_column +            // 8 +
                   ftokens[1].before.spaces_required +  // 1 +
@@ -166,8 +210,8 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevState) {
   {
     // Second token, but wrapped onto next line:
     auto child2_state =
-        std::make_shared<StateNode>(child_state, style, SpacingDecision::kWrap);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+        arena.Create(child_state, style, SpacingDecision::kWrap);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               initial_column +               // 2 +
                   style.wrap_spaces +        // 4 +
@@ -193,7 +237,7 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateNoGap) {
   ftokens[1].before.spaces_required = 4;  // ignored because of preserving
   ftokens[1].before.preserved_space_start = ftokens[0].Text().end();
   ftokens[1].before.break_penalty = 5;  // ignored because of preserving
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());  // 2 + 3
@@ -201,9 +245,9 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateNoGap) {
   EXPECT_TRUE(parent_state->IsRootState());
 
   // Appended with preserved spaces from original text.
-  auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                 SpacingDecision::kPreserve);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  auto child_state =
+      arena.Create(parent_state, style, SpacingDecision::kPreserve);
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             parent_state->current_column +  // 5 +
                 tokens[1].text().length()   // 3
@@ -227,7 +271,7 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateSpaces) {
   ftokens[1].before.preserved_space_start = ftokens[0].Text().end();
   ftokens[1].before.break_penalty = 5;  // ignored because of preserving
 
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());  // 2 + 3
@@ -235,9 +279,9 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateSpaces) {
   EXPECT_TRUE(parent_state->IsRootState());
 
   // Appended with preserved spaces from original text.
-  auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                 SpacingDecision::kPreserve);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  auto child_state =
+      arena.Create(parent_state, style, SpacingDecision::kPreserve);
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             parent_state->current_column +  // 5 +
                 4 +                         // spaces
@@ -261,7 +305,7 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateNewline) {
   ftokens[1].before.preserved_space_start = ftokens[0].Text().end();
   ftokens[1].before.break_penalty = 5;  // ignored because of preserving
 
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());  // 2 + 3
@@ -269,9 +313,9 @@ TEST_F(StateNodeTestFixture, ConstructionPreserveSpacesFromPrevStateNewline) {
   EXPECT_TRUE(parent_state->IsRootState());
 
   // Appended with preserved spaces from original text.
-  auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                 SpacingDecision::kPreserve);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  auto child_state =
+      arena.Create(parent_state, style, SpacingDecision::kPreserve);
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             1 +                            // space after last newline
                 tokens[1].text().length()  // 3
@@ -298,7 +342,7 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
   ftokens[3].balancing = verible::GroupBalancing::kClose;
   ftokens[3].before.spaces_required = 1;
   ftokens[3].before.break_penalty = 3;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -313,9 +357,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
     // Second token, also appended to same line as first:
     // > function_caller (
     // >     ^-- next wrap should be here
-    auto child2_state = std::make_shared<StateNode>(child_state, style,
-                                                    SpacingDecision::kAppend);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+    auto child2_state =
+        arena.Create(child_state, style, SpacingDecision::kAppend);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               child_state->current_column +            // 17 +
                   ftokens[1].before.spaces_required +  // 1 +
@@ -330,9 +374,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
       // Third token, also appended to same line:
       // > function_caller ( 11
       // >                  ^-- next wrap should be here
-      auto child3_state = std::make_shared<StateNode>(child2_state, style,
-                                                      SpacingDecision::kAppend);
-      EXPECT_EQ(child3_state->next(), child2_state.get());
+      auto child3_state =
+          arena.Create(child2_state, style, SpacingDecision::kAppend);
+      EXPECT_EQ(child3_state->next(), child2_state);
       EXPECT_EQ(child3_state->current_column,
                 child2_state->current_column +           // 19 +
                     ftokens[2].before.spaces_required +  // 1 +
@@ -347,9 +391,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // Fourth token, also appended to same line:
         // > function_caller ( 11 )
         // >     ^-- next wrap should be here, after closing balance group
-        auto child4_state = std::make_shared<StateNode>(
-            child3_state, style, SpacingDecision::kAppend);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kAppend);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child3_state->current_column +           // 22 +
                       ftokens[3].before.spaces_required +  // 1 +
@@ -370,9 +414,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // >                 )  // aligned with open-group
         // As-is, it is not because we pop the column stack on close-group
         // first, which is not an unreasonable choice.
-        auto child4_state = std::make_shared<StateNode>(child3_state, style,
-                                                        SpacingDecision::kWrap);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kWrap);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child2_state->wrap_column_positions
                           .top() +  // not a typo: child2_state
@@ -392,9 +436,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
       // > function_caller (
       // >     11
       // >         ^-- next wrap should be here
-      auto child3_state = std::make_shared<StateNode>(child2_state, style,
-                                                      SpacingDecision::kWrap);
-      EXPECT_EQ(child3_state->next(), child2_state.get());
+      auto child3_state =
+          arena.Create(child2_state, style, SpacingDecision::kWrap);
+      EXPECT_EQ(child3_state->next(), child2_state);
       EXPECT_EQ(child3_state->current_column,
                 initial_column + style.wrap_spaces + tokens[2].text().length());
       EXPECT_EQ(child3_state->cumulative_cost, ftokens[2].before.break_penalty);
@@ -409,9 +453,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // > function_caller (
         // >     11 )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(
-            child3_state, style, SpacingDecision::kAppend);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kAppend);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child3_state->current_column +           // 8
                       ftokens[3].before.spaces_required +  // 1
@@ -431,9 +475,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // >     11
         // >     )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(child3_state, style,
-                                                        SpacingDecision::kWrap);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kWrap);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(
             child4_state->current_column,
             initial_column + style.wrap_spaces + tokens[3].text().length());
@@ -456,8 +500,8 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
     // >     (
     // >     ^-- next wrap should be here
     auto child2_state =
-        std::make_shared<StateNode>(child_state, style, SpacingDecision::kWrap);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+        arena.Create(child_state, style, SpacingDecision::kWrap);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               initial_column +               // 2 +
                   style.wrap_spaces +        // 4 +
@@ -476,9 +520,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
       // > function_caller
       // >     ( 11
       // >     ^-- next wrap should be here
-      auto child3_state = std::make_shared<StateNode>(child2_state, style,
-                                                      SpacingDecision::kAppend);
-      EXPECT_EQ(child3_state->next(), child2_state.get());
+      auto child3_state =
+          arena.Create(child2_state, style, SpacingDecision::kAppend);
+      EXPECT_EQ(child3_state->next(), child2_state);
       EXPECT_EQ(child3_state->current_column,
                 child2_state->current_column +           // 7
                     ftokens[2].before.spaces_required +  // 1
@@ -496,9 +540,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // > function_caller
         // >     ( 11 )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(
-            child3_state, style, SpacingDecision::kAppend);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kAppend);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child3_state->current_column +           // 10
                       ftokens[3].before.spaces_required +  // 1
@@ -518,9 +562,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // >     ( 11
         // >     )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(child3_state, style,
-                                                        SpacingDecision::kWrap);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kWrap);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child2_state->wrap_column_positions.top() +
                       tokens[3].text().length()  // 1: ")"
@@ -543,9 +587,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
       // >     (
       // >         11
       // >         ^-- next wrap should be here
-      auto child3_state = std::make_shared<StateNode>(child2_state, style,
-                                                      SpacingDecision::kWrap);
-      EXPECT_EQ(child3_state->next(), child2_state.get());
+      auto child3_state =
+          arena.Create(child2_state, style, SpacingDecision::kWrap);
+      EXPECT_EQ(child3_state->next(), child2_state);
       EXPECT_EQ(child3_state->current_column,
                 initial_column + (style.wrap_spaces * 2) +  // 10
                     tokens[2].text().length()               // 2: "11"
@@ -566,9 +610,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // >     (
         // >         11 )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(
-            child3_state, style, SpacingDecision::kAppend);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kAppend);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child3_state->current_column +           // 10
                       ftokens[3].before.spaces_required +  // 1
@@ -590,9 +634,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateWithGroupBalancing) {
         // >         11
         // >     )
         // >     ^-- next wrap should be here
-        auto child4_state = std::make_shared<StateNode>(child3_state, style,
-                                                        SpacingDecision::kWrap);
-        EXPECT_EQ(child4_state->next(), child3_state.get());
+        auto child4_state =
+            arena.Create(child3_state, style, SpacingDecision::kWrap);
+        EXPECT_EQ(child4_state->next(), child3_state);
         EXPECT_EQ(child4_state->current_column,
                   child_state->wrap_column_positions.top() +
                       tokens[3].text().length()  // 1: ")"
@@ -626,7 +670,7 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateOverflow) {
   ftokens[1].before.break_penalty = 8;
 
   // First token on line:
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -636,9 +680,9 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateOverflow) {
 
   {
     // Second token, also appended to same line as first:
-    auto child2_state = std::make_shared<StateNode>(child_state, style,
-                                                    SpacingDecision::kAppend);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+    auto child2_state =
+        arena.Create(child_state, style, SpacingDecision::kAppend);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               child_state->current_column +            // 8 +
                   ftokens[1].before.spaces_required +  // 1 +
@@ -651,8 +695,8 @@ TEST_F(StateNodeTestFixture, ConstructionAppendingPrevStateOverflow) {
   {
     // Second token, but wrapped onto a new line:
     auto child2_state =
-        std::make_shared<StateNode>(child_state, style, SpacingDecision::kWrap);
-    EXPECT_EQ(child2_state->next(), child_state.get());
+        arena.Create(child_state, style, SpacingDecision::kWrap);
+    EXPECT_EQ(child2_state->next(), child_state);
     EXPECT_EQ(child2_state->current_column,
               initial_column +         // 2 +
                   style.wrap_spaces +  // 4 +
@@ -670,7 +714,7 @@ TEST_F(StateNodeTestFixture, MultiLineTokenFront) {
   ftokens[0].before.spaces_required = 1;
 
   // First token on line:
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             4 /* length("b234") */);
   EXPECT_EQ(parent_state->cumulative_cost, 0);
@@ -689,7 +733,7 @@ TEST_F(StateNodeTestFixture, MultiLineToken) {
   ftokens[1].before.break_penalty = 8;
 
   // First token on line:
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -697,9 +741,9 @@ TEST_F(StateNodeTestFixture, MultiLineToken) {
 
   {
     // Second token, also appended to same line as first:
-    auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                   SpacingDecision::kAppend);
-    EXPECT_EQ(child_state->next(), parent_state.get());
+    auto child_state =
+        arena.Create(parent_state, style, SpacingDecision::kAppend);
+    EXPECT_EQ(child_state->next(), parent_state);
     EXPECT_EQ(child_state->current_column,
               13  // length("c2345...."), no wrapping indentation
     );
@@ -710,9 +754,9 @@ TEST_F(StateNodeTestFixture, MultiLineToken) {
   }
   {
     // Second token, but wrapped onto a new line:
-    auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                   SpacingDecision::kWrap);
-    EXPECT_EQ(child_state->next(), parent_state.get());
+    auto child_state =
+        arena.Create(parent_state, style, SpacingDecision::kWrap);
+    EXPECT_EQ(child_state->next(), parent_state);
     EXPECT_EQ(child_state->current_column,
               13  // length("c2345...."), no wrapping indentation
     );
@@ -736,7 +780,7 @@ TEST_F(StateNodeTestFixture, MultiLineTokenOverflow) {
   ftokens[1].before.break_penalty = 8;
 
   // First token on line:
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -744,9 +788,9 @@ TEST_F(StateNodeTestFixture, MultiLineTokenOverflow) {
 
   {
     // Second token, also appended to same line as first:
-    auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                   SpacingDecision::kAppend);
-    EXPECT_EQ(child_state->next(), parent_state.get());
+    auto child_state =
+        arena.Create(parent_state, style, SpacingDecision::kAppend);
+    EXPECT_EQ(child_state->next(), parent_state);
     EXPECT_EQ(child_state->current_column,
               10  // length("c2345...."), no wrapping indentation
     );
@@ -760,9 +804,9 @@ TEST_F(StateNodeTestFixture, MultiLineTokenOverflow) {
   }
   {
     // Second token, but wrapped onto a new line:
-    auto child_state = std::make_shared<StateNode>(parent_state, style,
-                                                   SpacingDecision::kWrap);
-    EXPECT_EQ(child_state->next(), parent_state.get());
+    auto child_state =
+        arena.Create(parent_state, style, SpacingDecision::kWrap);
+    EXPECT_EQ(child_state->next(), parent_state);
     EXPECT_EQ(child_state->current_column,
               10  // length("c2345...."), no wrapping indentation
     );
@@ -782,16 +826,15 @@ TEST_F(StateNodeTestFixture, ConstructionWrappingLinePrevState) {
   Initialize(kInitialIndent, tokens);
   auto &ftokens = pre_format_tokens_;
   ftokens[1].before.break_penalty = 7;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
   EXPECT_EQ(parent_state->cumulative_cost, 0);
 
   // Wrap the next token onto a new line.
-  auto child_state =
-      std::make_shared<StateNode>(parent_state, style, SpacingDecision::kWrap);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  auto child_state = arena.Create(parent_state, style, SpacingDecision::kWrap);
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             initial_column + style.wrap_spaces + tokens[1].text().length());
   EXPECT_EQ(child_state->cumulative_cost, ftokens[1].before.break_penalty);
@@ -815,7 +858,7 @@ TEST_F(StateNodeTestFixture, AppendIfItFitsTryToAppend) {
   ftokens[0].before.spaces_required = 1;
   ftokens[1].before.spaces_required = 1;
   ftokens[2].before.spaces_required = 1;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -825,9 +868,9 @@ TEST_F(StateNodeTestFixture, AppendIfItFitsTryToAppend) {
   EXPECT_TRUE(parent_state->IsRootState());
 
   // Second token, also appended to same line as first:
-  auto child_state = StateNode::AppendIfItFits(parent_state, style);
+  auto child_state = StateNode::AppendIfItFits(parent_state, style, &arena);
   EXPECT_EQ(child_state->spacing_choice, SpacingDecision::kAppend);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             parent_state->current_column +           // 12 +
                 ftokens[1].before.spaces_required +  // 1 +
@@ -836,9 +879,9 @@ TEST_F(StateNodeTestFixture, AppendIfItFitsTryToAppend) {
   EXPECT_FALSE(child_state->IsRootState());
 
   // Third token, doesn't fit, and will be wrapped.
-  auto child2_state = StateNode::AppendIfItFits(child_state, style);
+  auto child2_state = StateNode::AppendIfItFits(child_state, style, &arena);
   EXPECT_EQ(child2_state->spacing_choice, SpacingDecision::kWrap);
-  EXPECT_EQ(child2_state->next(), child_state.get());
+  EXPECT_EQ(child2_state->next(), child_state);
   EXPECT_EQ(child2_state->current_column,
             initial_column + style.wrap_spaces + tokens[2].text().length());
 }
@@ -856,7 +899,7 @@ TEST_F(StateNodeTestFixture, AppendIfItFitsForcedWrap) {
   ftokens[1].before.spaces_required = 1;
   // Tokens stay under column limit, but here, we force a wrap.
   ftokens[1].before.break_decision = SpacingOptions::kMustWrap;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -866,9 +909,9 @@ TEST_F(StateNodeTestFixture, AppendIfItFitsForcedWrap) {
   EXPECT_TRUE(parent_state->IsRootState());
 
   // Second token, forced to wrap onto new line.
-  auto child_state = StateNode::AppendIfItFits(parent_state, style);
+  auto child_state = StateNode::AppendIfItFits(parent_state, style, &arena);
   EXPECT_EQ(child_state->spacing_choice, SpacingDecision::kWrap);
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  EXPECT_EQ(child_state->next(), parent_state);
   EXPECT_EQ(child_state->current_column,
             initial_column + style.wrap_spaces + tokens[0].text().length());
   EXPECT_FALSE(child_state->IsRootState());
@@ -888,7 +931,7 @@ TEST_F(StateNodeTestFixture, QuickFinish) {
   ftokens[0].before.spaces_required = 1;
   ftokens[1].before.spaces_required = 1;
   ftokens[2].before.spaces_required = 1;
-  auto parent_state = std::make_shared<StateNode>(*uwline, style);
+  auto parent_state = arena.Create(*uwline, style);
   const int initial_column = kInitialIndent * style.indentation_spaces;  // 2
   EXPECT_EQ(ABSL_DIE_IF_NULL(parent_state)->current_column,
             initial_column + tokens[0].text().length());
@@ -897,7 +940,7 @@ TEST_F(StateNodeTestFixture, QuickFinish) {
             initial_column + style.wrap_spaces);
   EXPECT_TRUE(parent_state->IsRootState());
 
-  auto final_state = StateNode::QuickFinish(parent_state, style);
+  auto final_state = StateNode::QuickFinish(parent_state, style, &arena);
 
   // Checking up the ancestry chain of previous states
   // Third token, doesn't fit, and will be wrapped.
@@ -908,7 +951,26 @@ TEST_F(StateNodeTestFixture, QuickFinish) {
   EXPECT_EQ(child_state->spacing_choice, SpacingDecision::kAppend);
 
   // Second state is decended from initial state.
-  EXPECT_EQ(child_state->next(), parent_state.get());
+  EXPECT_EQ(child_state->next(), parent_state);
+}
+
+// Tests that states created in an arena stay valid as the arena grows.
+TEST_F(StateNodeTestFixture, ArenaKeepsStates) {
+  const std::vector<TokenInfo> tokens = {{0, "xxxxx"}, {1, "yyyyy"}};
+  Initialize(1, tokens);
+  const StateNode *root = arena.Create(*uwline, style);
+  std::vector<const StateNode *> children;
+  for (int i = 0; i < 1000; ++i) {
+    children.push_back(arena.Create(root, style, SpacingDecision::kWrap));
+  }
+  EXPECT_EQ(arena.size(), 1001);
+  for (const StateNode *child : children) {
+    EXPECT_EQ(child->next(), root);
+    EXPECT_TRUE(child->Done());
+    EXPECT_EQ(child->wrap_column_positions.size(), 1);
+    EXPECT_EQ(child->wrap_column_positions.top(),
+              root->wrap_column_positions.top());
+  }
 }
 
 // Tests that equal cumulative penalty does not count as less.
@@ -936,11 +998,11 @@ TEST_F(StateNodeTestFixture, Stringify) {
   const std::vector<TokenInfo> tokens;
   Initialize(0, tokens);
   StateNode::path_type path;
+  style.wrap_spaces = 3;  // Becomes the wrap column position of the root.
   StateNode s(*uwline, style);
   s.spacing_choice = SpacingDecision::kWrap;
   s.current_column = 7;
   s.cumulative_cost = 11;
-  s.wrap_column_positions.top() = 3;
   std::ostringstream stream;
   stream << s;
   EXPECT_EQ(stream.str(), "spacing:wrap, col@7, cost=11, [...3]");
@@ -34,7 +34,7 @@
 
 #include <cstdlib>
 #include <iostream>
-#include <sstream>  // IWYU pragma: keep  // for ostringstream
+#include <streambuf>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -51,13 +51,26 @@ namespace verible {
 // ordered before "L" in FlexLexerAdaptor's base classes.
 class CodeStreamHolder {
  protected:
+  // Read-only stream buffer directly reading the code to be scanned; unlike
+  // a std::istringstream, it does not copy it. This way, lexing only part of
+  // a large text only costs what is actually read.
+  class CodeStreamBuf : public std::streambuf {
+   public:
+    void Reset(absl::string_view code) {
+      // The get area is only read from, so casting away const is safe.
+      char *const begin = const_cast<char *>(code.data());
+      setg(begin, begin, begin + code.length());
+    }
+  };
+
   // The stream object conforms to the FlexLexer input interface.
-  // Even though scanning is done on the stream's internal copy of the input
-  // string, the byte offsets being tracked can be used to construct
-  // string_views based on the original string's start address.
+  // The byte offsets being tracked can be used to construct string_views
+  // based on the original string's start address; the code needs to outlive
+  // the lexer (as do the tokens pointing into it).
   // Using the standard istream interface also lets us switch buffers, e.g.
   // during preprocessing.
-  std::istringstream code_stream_;
+  CodeStreamBuf code_buffer_;
+  std::istream code_stream_{&code_buffer_};
 };
 
 // L is a (flex-generated) yyFlexLexer-like class.
@@ -69,8 +82,7 @@ class FlexLexerAdapter : private CodeStreamHolder, protected L, public Lexer {
         code_(code),
         // last_token_ points to the beginning of the code_ buffer
         last_token_(0 /* enum doesn't matter */, code_.substr(0, 0)) {
-    code_stream_.str(std::string(code));
-    // istringstream copies text into its own internal buffer.
+    code_buffer_.Reset(code_);
   }
 
   // Returns the token associated with the last UpdateLocation() call.
@@ -111,7 +123,8 @@ class FlexLexerAdapter : private CodeStreamHolder, protected L, public Lexer {
   void Restart(absl::string_view code) override {
     at_eof_ = false;
     code_ = code;
-    code_stream_.str(std::string(code_));
+    code_buffer_.Reset(code_);
+    code_stream_.clear();  // Reset EOF state of previous input.
     last_token_ = TokenInfo(0, code_.substr(0, 0));
 
     // Reset buffer stack.
@@ -14,7 +14,10 @@
 
 #include "common/lsp/lsp-text-buffer.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,6 +30,9 @@
 
 namespace verible {
 namespace lsp {
+// Number of changes remembered for ChangedRegionSince().
+static constexpr size_t kMaxChangeLog = 1024;
+
 EditTextBuffer::EditTextBuffer(absl::string_view initial_text) {
   ReplaceDocument(initial_text);
 }
@@ -37,6 +43,7 @@ void EditTextBuffer::ApplyChanges(
 }
 
 bool EditTextBuffer::ApplyChange(const TextDocumentContentChangeEvent &c) {
+  RecordChange(c);
   if (!c.has_range) {
     ReplaceDocument(c.text);
     return true;
@@ -53,6 +60,49 @@ bool EditTextBuffer::ApplyChange(const TextDocumentContentChangeEvent &c) {
   return MultiLineEdit(c);
 }
 
+void EditTextBuffer::RecordChange(const TextDocumentContentChangeEvent &c) {
+  const int64_t lines_before = lines_.size();
+  LineChange change{last_global_version_, lines_before, 0, lines_before};
+  if (c.has_range) {
+    // Edits beyond the last line append to it.
+    change.end_line = std::min<int64_t>(c.range.end.line + 1, lines_before);
+    change.first_line =
+        std::clamp<int64_t>(c.range.start.line, 0, change.end_line);
+  }
+  change_log_.push_back(change);
+  if (change_log_.size() > kMaxChangeLog) {
+    change_log_start_version_ = change_log_.front().base_version + 1;
+    change_log_.pop_front();
+  }
+}
+
+std::optional<EditTextBuffer::ChangedRegion>
+EditTextBuffer::ChangedRegionSince(int64_t version) const {
+  if (version < change_log_start_version_) return std::nullopt;
+
+  // Lines at the beginning and end that none of the changes touched.
+  const int64_t lines = lines_.size();
+  int64_t prefix_lines = lines;
+  int64_t suffix_lines = lines;
+  for (const LineChange &change : change_log_) {
+    if (change.base_version < version) continue;
+    prefix_lines = std::min(prefix_lines, change.first_line);
+    suffix_lines =
+        std::min(suffix_lines, change.lines_before - change.end_line);
+  }
+  prefix_lines = std::min(prefix_lines, lines);
+  suffix_lines = std::clamp<int64_t>(suffix_lines, 0, lines - prefix_lines);
+
+  ChangedRegion result = {0, 0};
+  for (int64_t i = 0; i < prefix_lines; ++i) {
+    result.unchanged_prefix += lines_[i]->length();
+  }
+  for (int64_t i = lines - suffix_lines; i < lines; ++i) {
+    result.unchanged_suffix += lines_[i]->length();
+  }
+  return result;
+}
+
 /*static*/ EditTextBuffer::LineVector EditTextBuffer::GenerateLines(
     absl::string_view content) {
   LineVector result;
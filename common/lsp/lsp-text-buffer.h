@@ -17,8 +17,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -68,6 +70,20 @@ class EditTextBuffer {
   // Set global version; this typically will be done by the BufferCollection.
   void set_last_global_version(int64_t v) { last_global_version_ = v; }
 
+  // Byte range of the document that changed compared to a previous version:
+  // the first "unchanged_prefix" and the last "unchanged_suffix" bytes
+  // are the same in both versions.
+  struct ChangedRegion {
+    int64_t unchanged_prefix;
+    int64_t unchanged_suffix;
+  };
+
+  // Returns the region changed since the buffer had global "version",
+  // derived from the ranges of the changes applied since. This allows
+  // consumers to only re-process the part that changed.
+  // Returns nullopt if this is not known (anymore).
+  std::optional<ChangedRegion> ChangedRegionSince(int64_t version) const;
+
  private:
   // TODO: this should be unique_ptr, but assignment in the insert() command
   // will not work. Needs to be formulated with something something std::move ?
@@ -78,9 +94,23 @@ class EditTextBuffer {
   bool LineEdit(const TextDocumentContentChangeEvent &c, std::string *str);
   bool MultiLineEdit(const TextDocumentContentChangeEvent &c);
 
+  // Lines replaced by a change.
+  struct LineChange {
+    int64_t base_version;  // last_global_version_ the change was applied to.
+    int64_t lines_before;  // Number of lines before the change.
+    int64_t first_line;    // First replaced line.
+    int64_t end_line;      // One past the last replaced line.
+  };
+  void RecordChange(const TextDocumentContentChangeEvent &c);
+
   int64_t last_global_version_ = 0;
   int64_t document_length_ = 0;
   LineVector lines_;
+
+  // Recent changes, oldest first. Complete for all changes applied to
+  // versions starting with change_log_start_version_.
+  std::deque<LineChange> change_log_;
+  int64_t change_log_start_version_ = 0;
 };
 
 // A buffer collection keeps track of various open text buffers on the
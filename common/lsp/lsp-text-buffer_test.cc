@@ -338,6 +338,95 @@ TEST(TextBufferTest, ChangeApplyMultiLine_RemoveLines) {
   EXPECT_EQ(buffer.document_length(), 8);
 }
 
+TEST(TextBufferTest, ChangedRegionSinceVersion) {
+  EditTextBuffer buffer("Foo\nBar\nBaz\nQuux\n");
+  buffer.set_last_global_version(1);
+
+  // Nothing changed yet: everything is unchanged prefix.
+  auto region = buffer.ChangedRegionSince(1);
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, buffer.document_length());
+  EXPECT_EQ(region->unchanged_suffix, 0);
+
+  const TextDocumentContentChangeEvent edit_bar = {
+      .range =
+          {
+              .start = {1, 1},
+              .end = {1, 2},
+          },
+      .has_range = true,
+      .text = "AAA",
+  };
+  EXPECT_TRUE(buffer.ApplyChange(edit_bar));
+  buffer.set_last_global_version(2);
+  region = buffer.ChangedRegionSince(1);
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, 4);  // "Foo\n"
+  EXPECT_EQ(region->unchanged_suffix, 9);  // "Baz\nQuux\n"
+
+  // Lines joined: the edit spans two lines.
+  const TextDocumentContentChangeEvent join_baz_quux = {
+      .range =
+          {
+              .start = {2, 3},
+              .end = {3, 0},
+          },
+      .has_range = true,
+      .text = "",
+  };
+  EXPECT_TRUE(buffer.ApplyChange(join_baz_quux));
+  buffer.set_last_global_version(3);
+  buffer.RequestContent([&](absl::string_view s) {
+    EXPECT_EQ("Foo\nBAAAr\nBazQuux\n", std::string(s));
+  });
+
+  region = buffer.ChangedRegionSince(2);  // Only the last change.
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, 10);  // "Foo\nBAAAr\n"
+  EXPECT_EQ(region->unchanged_suffix, 0);
+
+  region = buffer.ChangedRegionSince(1);  // Both changes.
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, 4);
+  EXPECT_EQ(region->unchanged_suffix, 0);
+
+  region = buffer.ChangedRegionSince(3);  // Nothing since.
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, buffer.document_length());
+
+  // Full replacement changes everything.
+  const TextDocumentContentChangeEvent replace_all = {
+      .has_range = false,
+      .text = "Hello\n",
+  };
+  EXPECT_TRUE(buffer.ApplyChange(replace_all));
+  buffer.set_last_global_version(4);
+  region = buffer.ChangedRegionSince(3);
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(region->unchanged_prefix, 0);
+  EXPECT_EQ(region->unchanged_suffix, 0);
+}
+
+TEST(TextBufferTest, ChangedRegionSinceForgottenVersion) {
+  EditTextBuffer buffer("Foo\n");
+  const TextDocumentContentChangeEvent change = {
+      .range =
+          {
+              .start = {0, 0},
+              .end = {0, 0},
+          },
+      .has_range = true,
+      .text = "x",
+  };
+  for (int64_t version = 1; version <= 2000; ++version) {
+    buffer.set_last_global_version(version);
+    EXPECT_TRUE(buffer.ApplyChange(change));
+  }
+  buffer.set_last_global_version(2001);
+  EXPECT_FALSE(buffer.ChangedRegionSince(1).has_value());
+  EXPECT_TRUE(buffer.ChangedRegionSince(2000).has_value());
+}
+
 TEST(BufferCollection, SimulateDocumentLifecycleThroughRPC) {
   // Let's walk a BufferCollection through the lifecycle of a document
   // by sending it the JSON RPC notifications for open, change and close.
@@ -43,7 +43,8 @@
 #include <vector>
 
 #include "common/text/constants.h"
-#include "common/text/symbol.h"      // IWYU pragma: export
+#include "common/text/symbol.h"  // IWYU pragma: export
+#include "common/text/symbol_arena.h"
 #include "common/text/symbol_ptr.h"  // IWYU pragma: export
 #include "common/text/tree_compare.h"
 #include "common/text/visitors.h"
@@ -74,7 +75,8 @@ class SyntaxTreeNode final : public Symbol {
  public:
   // This container needs to provide a random access [] operator and
   // rbegin(), rend() iterators.
-  using ChildContainer = std::vector<SymbolPtr>;
+  using ChildContainer =
+      std::vector<SymbolPtr, SymbolArenaAllocator<SymbolPtr>>;
   using ConstRange = iterator_range<ChildContainer::const_iterator>;
   using MutableRange = iterator_range<ChildContainer::iterator>;
 
@@ -105,6 +107,11 @@ class SyntaxTreeNode final : public Symbol {
     node->children_.clear();
   }
 
+  // Makes room for "n" more children, e.g. when their number is known
+  // upfront. Avoids growing the container, which in a SymbolArena leaves the
+  // old buffers unused until the arena is released.
+  void ReserveChildren(size_t n) { children_.reserve(children_.size() + n); }
+
   // This no-op case is the base case for the variadic Append.
   void Append() const {}
 
@@ -216,6 +223,7 @@ class SyntaxTreeNode final : public Symbol {
 template <typename... Args>
 SymbolPtr MakeNode(Args &&...args) {
   auto *const node_pointer = new SyntaxTreeNode();
+  node_pointer->ReserveChildren(sizeof...(Args));
   node_pointer->Append(std::forward<Args>(args)...);
   return SymbolPtr(node_pointer);
 }
@@ -228,6 +236,7 @@ SymbolPtr MakeNode(Args &&...args) {
 template <typename Enum, typename... Args>
 SymbolPtr MakeTaggedNode(const Enum tag, Args &&...args) {
   auto *const node_pointer = new SyntaxTreeNode(static_cast<int>(tag));
+  node_pointer->ReserveChildren(sizeof...(Args));
   node_pointer->Append(std::forward<Args>(args)...);
   return SymbolPtr(node_pointer);
 }
@@ -18,10 +18,12 @@
 #ifndef VERIBLE_COMMON_TEXT_SYMBOL_H_
 #define VERIBLE_COMMON_TEXT_SYMBOL_H_
 
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <memory>
 
+#include "common/text/symbol_arena.h"
 #include "common/text/symbol_ptr.h"  // IWYU pragma: export
 #include "common/text/token_info.h"
 #include "common/text/visitors.h"
@@ -62,6 +64,10 @@ class Symbol {
  public:
   virtual ~Symbol() = default;
 
+  // Symbols are allocated from the active SymbolArena, if there is one.
+  static void *operator new(size_t size) { return SymbolArena::Allocate(size); }
+  static void operator delete(void *p) { SymbolArena::Deallocate(p); }
+
   virtual bool equals(const Symbol *symbol,
                       const TokenComparator &compare_tokens) const = 0;
 
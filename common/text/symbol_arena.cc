@@ -0,0 +1,104 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/text/symbol_arena.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace verible {
+
+// Each allocation is preceded by a header with the arena it belongs to, or
+// nullptr if it is allocated on the heap.
+using AllocationHeader = SymbolArena *;
+static constexpr size_t kHeaderSize = sizeof(AllocationHeader);
+static constexpr size_t kAlignment = alignof(void *);
+static_assert(kHeaderSize % kAlignment == 0, "Header breaks alignment");
+
+// Blocks grow, so that small trees (e.g. of expressions in macro arguments)
+// don't hold on to a lot of memory.
+static constexpr size_t kFirstBlockSize = 1024;
+static constexpr size_t kMaxBlockSize = 1 << 20;
+
+// Larger allocations, i.e. child containers of long lists, are taken from
+// the heap, so that they are released when the container grows.
+static constexpr size_t kMaxArenaAllocation = 4096;
+
+static thread_local SymbolArena *active_arena = nullptr;
+
+static AllocationHeader *HeaderOf(const void *memory) {
+  return reinterpret_cast<AllocationHeader *>(
+      static_cast<char *>(const_cast<void *>(memory)) - kHeaderSize);
+}
+
+SymbolArena::Scope::Scope()
+    : arena_(new SymbolArena()), previous_(active_arena) {
+  active_arena = arena_;
+}
+
+SymbolArena::Scope::~Scope() {
+  active_arena = previous_;
+  arena_->Unref();
+}
+
+void *SymbolArena::Allocate(size_t size) {
+  const size_t total =
+      (size + kHeaderSize + kAlignment - 1) / kAlignment * kAlignment;
+  SymbolArena *arena = active_arena;
+  char *memory;
+  if (arena != nullptr && total <= kMaxArenaAllocation) {
+    memory = arena->AllocateFromBlock(total);
+    arena->references_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    memory = static_cast<char *>(::operator new(total));
+    arena = nullptr;
+  }
+  *reinterpret_cast<AllocationHeader *>(memory) = arena;
+  return memory + kHeaderSize;
+}
+
+void SymbolArena::Deallocate(void *memory) {
+  if (memory == nullptr) return;
+  AllocationHeader *const header = HeaderOf(memory);
+  if (*header == nullptr) {
+    ::operator delete(header);
+  } else {
+    (*header)->Unref();
+  }
+}
+
+bool SymbolArena::IsArenaAllocated(const void *memory) {
+  return *HeaderOf(memory) != nullptr;
+}
+
+char *SymbolArena::AllocateFromBlock(size_t size) {
+  if (static_cast<size_t>(end_ - next_) < size) {
+    last_block_size_ = std::max(
+        size, std::clamp(2 * last_block_size_, kFirstBlockSize, kMaxBlockSize));
+    blocks_.emplace_back(new char[last_block_size_]);
+    next_ = blocks_.back().get();
+    end_ = next_ + last_block_size_;
+  }
+  char *const result = next_;
+  next_ += size;
+  return result;
+}
+
+void SymbolArena::Unref() {
+  if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+}
+
+}  // namespace verible
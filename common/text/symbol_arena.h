@@ -0,0 +1,129 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_COMMON_TEXT_SYMBOL_ARENA_H_
+#define VERIBLE_COMMON_TEXT_SYMBOL_ARENA_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace verible {
+
+// SymbolArena is a bump allocator for syntax tree symbols and their child
+// containers. Building a large syntax tree otherwise spends most of its time
+// in malloc() and free() of small objects.
+//
+// While a SymbolArena::Scope is alive, all symbols created in that thread
+// are allocated from its arena:
+//
+//   {
+//     SymbolArena::Scope arena_scope;
+//     root = parser.Parse();  // Symbols are allocated in the arena.
+//   }
+//
+// Symbols still are owned by SymbolPtr as usual and can be moved, modified
+// or deleted independently. Deleting an arena allocated symbol does not
+// free its memory though: the arena keeps track of how many of its
+// allocations are still alive, and releases all of its memory at once when
+// the last of them is gone. So trees may outlive the scope they were created
+// in, and may be transferred to other threads.
+//
+// Costs: allocation is a pointer bump plus an atomic increment. Deleting a
+// tree still runs the destructor of every symbol and child container, each
+// doing an atomic decrement instead of a free(); only the blocks are freed
+// at once, so teardown is linear in the number of symbols, but without any
+// allocator work per symbol. Memory of containers that grew, or of symbols
+// deleted early, is not reused until the whole arena is released. This
+// waste is bounded, as allocations of more than 4 KiB, e.g. the children of
+// long lists, are taken from the heap.
+class SymbolArena {
+ public:
+  // Activates a new arena for all symbol allocations of the current thread
+  // until destruction. Scopes can be nested, the innermost one is active.
+  class Scope {
+   public:
+    Scope();
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    SymbolArena *const arena_;
+    SymbolArena *const previous_;
+  };
+
+  SymbolArena(const SymbolArena &) = delete;
+  SymbolArena &operator=(const SymbolArena &) = delete;
+
+  // Allocate "size" bytes from the active arena of this thread or, if there
+  // is none, from the heap. The memory is aligned for pointer-sized types.
+  static void *Allocate(size_t size);
+
+  // Free memory previously returned by Allocate().
+  static void Deallocate(void *memory);
+
+  // Returns true if "memory", returned by Allocate(), is in an arena.
+  static bool IsArenaAllocated(const void *memory);
+
+ private:
+  SymbolArena() = default;
+  ~SymbolArena() = default;
+
+  // Returns "size" bytes from the current block or a new one.
+  char *AllocateFromBlock(size_t size);
+
+  // Drop one reference; deletes the arena with the last one.
+  void Unref();
+
+  // One reference per live allocation, plus one while the scope is active.
+  std::atomic<int64_t> references_{1};
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  size_t last_block_size_ = 0;
+  char *next_ = nullptr;
+  char *end_ = nullptr;
+};
+
+// Standard allocator for containers of symbols, using SymbolArena.
+template <typename T>
+struct SymbolArenaAllocator {
+  using value_type = T;
+
+  SymbolArenaAllocator() = default;
+  template <typename U>
+  SymbolArenaAllocator(const SymbolArenaAllocator<U> &) {}  // NOLINT
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(SymbolArena::Allocate(n * sizeof(T)));
+  }
+  void deallocate(T *p, size_t) { SymbolArena::Deallocate(p); }
+
+  // Stateless: memory from any instance can be deallocated by any other.
+  template <typename U>
+  bool operator==(const SymbolArenaAllocator<U> &) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const SymbolArenaAllocator<U> &) const {
+    return false;
+  }
+};
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_TEXT_SYMBOL_ARENA_H_
@@ -0,0 +1,111 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/text/symbol_arena.h"
+
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "common/text/concrete_syntax_leaf.h"
+#include "common/text/concrete_syntax_tree.h"
+#include "common/text/tree_builder_test_util.h"
+#include "common/text/tree_utils.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+TEST(SymbolArenaTest, HeapAllocationWithoutScope) {
+  SymbolPtr leaf = Leaf(1, "foo");
+  EXPECT_FALSE(SymbolArena::IsArenaAllocated(leaf.get()));
+}
+
+TEST(SymbolArenaTest, ArenaAllocationInScope) {
+  SymbolPtr tree;
+  {
+    SymbolArena::Scope arena_scope;
+    tree = TNode(3, Leaf(1, "foo"), Leaf(2, "bar"));
+  }
+  EXPECT_TRUE(SymbolArena::IsArenaAllocated(tree.get()));
+  const auto &node = SymbolCastToNode(*tree);
+  ASSERT_EQ(node.size(), 2);
+  EXPECT_TRUE(SymbolArena::IsArenaAllocated(node[0].get()));
+  EXPECT_EQ(SymbolCastToLeaf(*node[1]).get().text(), "bar");
+}
+
+TEST(SymbolArenaTest, LargeAllocationsFromHeap) {
+  SymbolArena::Scope arena_scope;
+  void *small = SymbolArena::Allocate(16);
+  void *large = SymbolArena::Allocate(1 << 16);
+  EXPECT_TRUE(SymbolArena::IsArenaAllocated(small));
+  EXPECT_FALSE(SymbolArena::IsArenaAllocated(large));
+  SymbolArena::Deallocate(small);
+  SymbolArena::Deallocate(large);
+}
+
+TEST(SymbolArenaTest, AllocationsAreAligned) {
+  SymbolArena::Scope arena_scope;
+  for (size_t size = 1; size < 64; ++size) {
+    void *memory = SymbolArena::Allocate(size);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignof(void *), 0);
+    SymbolArena::Deallocate(memory);
+  }
+}
+
+TEST(SymbolArenaTest, NestedScopes) {
+  SymbolPtr outer_leaf;
+  SymbolPtr inner_leaf;
+  {
+    SymbolArena::Scope outer_scope;
+    {
+      SymbolArena::Scope inner_scope;
+      inner_leaf = Leaf(1, "inner");
+    }
+    outer_leaf = Leaf(1, "outer");
+  }
+  EXPECT_TRUE(SymbolArena::IsArenaAllocated(inner_leaf.get()));
+  EXPECT_TRUE(SymbolArena::IsArenaAllocated(outer_leaf.get()));
+  // Both arenas are released independently.
+  inner_leaf.reset();
+  EXPECT_EQ(SymbolCastToLeaf(*outer_leaf).get().text(), "outer");
+}
+
+TEST(SymbolArenaTest, ModifyTreeAfterScope) {
+  SymbolPtr tree;
+  {
+    SymbolArena::Scope arena_scope;
+    tree = TNode(3, Leaf(1, "foo"));
+  }
+  // Growing the tree outside of the scope mixes heap and arena allocations.
+  auto &node = SymbolCastToNode(*tree);
+  for (int i = 0; i < 100; ++i) node.AppendChild(Leaf(2, "bar"));
+  EXPECT_EQ(node.size(), 101);
+  EXPECT_FALSE(SymbolArena::IsArenaAllocated(node.back().get()));
+  node[0].reset();
+  tree.reset();
+}
+
+TEST(SymbolArenaTest, ReleaseTreeInOtherThread) {
+  SymbolPtr tree;
+  {
+    SymbolArena::Scope arena_scope;
+    tree = TNode(3, Leaf(1, "foo"), TNode(4, Leaf(2, "bar")));
+  }
+  std::thread other([tree = std::move(tree)]() mutable { tree.reset(); });
+  other.join();
+}
+
+}  // namespace
+}  // namespace verible
@@ -0,0 +1,40 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/text/symbol_tag_dispatch_table.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "common/text/symbol.h"
+
+namespace verible {
+
+void SymbolTagDispatchTable::Add(size_t id,
+                                 const std::vector<SymbolTag> &tags) {
+  if (tags.empty()) {
+    nodes_.Add(id, {});
+    leaves_.Add(id, {});
+    return;
+  }
+  std::vector<int> node_tags;
+  std::vector<int> leaf_tags;
+  for (const SymbolTag tag : tags) {
+    (tag.kind == SymbolKind::kNode ? node_tags : leaf_tags).push_back(tag.tag);
+  }
+  if (!node_tags.empty()) nodes_.Add(id, node_tags);
+  if (!leaf_tags.empty()) leaves_.Add(id, leaf_tags);
+}
+
+}  // namespace verible
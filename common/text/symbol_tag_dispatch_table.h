@@ -0,0 +1,52 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_COMMON_TEXT_SYMBOL_TAG_DISPATCH_TABLE_H_
+#define VERIBLE_COMMON_TEXT_SYMBOL_TAG_DISPATCH_TABLE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "common/text/symbol.h"
+#include "common/util/tag_dispatch_table.h"
+
+namespace verible {
+
+// SymbolTagDispatchTable is a TagDispatchTable for symbol tags, with one
+// table for node tags and one for leaf token enums.
+class SymbolTagDispatchTable {
+ public:
+  // Adds handler 'id' for all of 'tags', or for every tag of nodes and leaves
+  // if 'tags' is empty. Ids must be added in increasing order.
+  void Add(size_t id, const std::vector<SymbolTag> &tags);
+
+  // Returns the ids of the handlers for 'tag', in increasing order.
+  const std::vector<size_t> &Get(SymbolTag tag) const {
+    return (tag.kind == SymbolKind::kNode ? nodes_ : leaves_).Get(tag.tag);
+  }
+
+  // Removes all handlers.
+  void Clear() {
+    nodes_.Clear();
+    leaves_.Clear();
+  }
+
+ private:
+  TagDispatchTable nodes_;
+  TagDispatchTable leaves_;
+};
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_TEXT_SYMBOL_TAG_DISPATCH_TABLE_H_
@@ -0,0 +1,45 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/text/symbol_tag_dispatch_table.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "common/text/symbol.h"
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+using Ids = std::vector<size_t>;
+
+TEST(SymbolTagDispatchTableTest, NodesAndLeavesAreSeparate) {
+  SymbolTagDispatchTable table;
+  table.Add(0, {NodeTag(1), LeafTag(2)});
+  table.Add(1, {LeafTag(1)});
+  table.Add(2, {});
+  EXPECT_EQ(table.Get(NodeTag(1)), Ids({0, 2}));
+  EXPECT_EQ(table.Get(LeafTag(1)), Ids({1, 2}));
+  EXPECT_EQ(table.Get(NodeTag(2)), Ids({2}));
+  EXPECT_EQ(table.Get(LeafTag(2)), Ids({0, 2}));
+  EXPECT_EQ(table.Get(NodeTag(50)), Ids({2}));
+
+  table.Clear();
+  EXPECT_EQ(table.Get(NodeTag(1)), Ids());
+  EXPECT_EQ(table.Get(LeafTag(1)), Ids());
+}
+
+}  // namespace
+}  // namespace verible
@@ -0,0 +1,49 @@
+// Copyright 2024 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/util/line_ranges_flag.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+namespace verible {
+
+LineRanges::storage_type LineRanges::values;  // global initializer
+
+bool AbslParseFlag(absl::string_view flag_arg, LineRanges * /* unused */,
+                   std::string *error) {
+  auto &values = LineRanges::values;
+  // Pre-split strings, so that "--flag v1,v2" and "--flag v1 --flag v2" are
+  // equivalent.
+  const std::vector<absl::string_view> tokens = absl::StrSplit(flag_arg, ',');
+  values.reserve(values.size() + tokens.size());
+  for (const absl::string_view &token : tokens) {
+    // need to copy string, cannot just use string_view
+    values.emplace_back(token.begin(), token.end());
+  }
+  // Range validation done later.
+  return true;
+}
+
+std::string AbslUnparseFlag(LineRanges /* unused */) {
+  const auto &values = LineRanges::values;
+  return absl::StrJoin(values.begin(), values.end(), ",",
+                       absl::StreamFormatter());
+}
+
+}  // namespace verible
@@ -0,0 +1,42 @@
+// Copyright 2024 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_COMMON_UTIL_LINE_RANGES_FLAG_H_
+#define VERIBLE_COMMON_UTIL_LINE_RANGES_FLAG_H_
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace verible {
+
+// Flag type for line ranges, like "--lines 1-10,20".
+// Pseudo-singleton, so that repeated flag occurrences accumulate values.
+//   --flag x --flag y yields [x, y]
+// The values are validated when parsing them with ParseInclusiveRanges().
+struct LineRanges {
+  // need to copy string, cannot just use string_view
+  using storage_type = std::vector<std::string>;
+  static storage_type values;
+};
+
+bool AbslParseFlag(absl::string_view flag_arg, LineRanges * /* unused */,
+                   std::string *error);
+
+std::string AbslUnparseFlag(LineRanges /* unused */);
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_UTIL_LINE_RANGES_FLAG_H_
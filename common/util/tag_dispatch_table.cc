@@ -0,0 +1,42 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/util/tag_dispatch_table.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "common/util/logging.h"
+
+namespace verible {
+
+void TagDispatchTable::Add(size_t id, const std::vector<int> &tags) {
+  if (tags.empty()) {
+    // Interested in everything, including tags past the end of the table.
+    any_tag_handlers_.push_back(id);
+    for (auto &handlers : handlers_) handlers.push_back(id);
+    return;
+  }
+  for (const int tag : tags) {
+    CHECK_GE(tag, 0);
+    if (static_cast<size_t>(tag) >= handlers_.size()) {
+      handlers_.resize(tag + 1, any_tag_handlers_);
+    }
+    auto &handlers = handlers_[tag];
+    // Ignore duplicate tags.
+    if (handlers.empty() || handlers.back() != id) handlers.push_back(id);
+  }
+}
+
+}  // namespace verible
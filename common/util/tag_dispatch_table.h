@@ -0,0 +1,63 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_COMMON_UTIL_TAG_DISPATCH_TABLE_H_
+#define VERIBLE_COMMON_UTIL_TAG_DISPATCH_TABLE_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace verible {
+
+// TagDispatchTable maps tags, i.e. small non-negative integers such as token
+// enums or node tags, to the ids of the handlers interested in them, e.g. lint
+// rules or matchers. Looking up a tag yields the handlers to call for it, so
+// that the others are not even asked.
+//
+// Usage:
+//   TagDispatchTable table;
+//   table.Add(0, {kFoo, kBar});  // Handler 0 is interested in two tags.
+//   table.Add(1, {});            // Handler 1 is interested in all tags.
+//   for (const size_t id : table.Get(tag)) ...
+class TagDispatchTable {
+ public:
+  // Adds handler 'id' for all of 'tags', or for every tag if 'tags' is empty.
+  // Ids must be added in increasing order, which is the order Get() returns
+  // them in.
+  void Add(size_t id, const std::vector<int> &tags);
+
+  // Returns the ids of the handlers for 'tag', in increasing order.
+  const std::vector<size_t> &Get(int tag) const {
+    if (tag < 0 || static_cast<size_t>(tag) >= handlers_.size()) {
+      return any_tag_handlers_;
+    }
+    return handlers_[tag];
+  }
+
+  // Removes all handlers.
+  void Clear() {
+    handlers_.clear();
+    any_tag_handlers_.clear();
+  }
+
+ private:
+  // Handlers of each tag. Tags past the end of this table only have the
+  // handlers for every tag.
+  std::vector<std::vector<size_t>> handlers_;
+  std::vector<size_t> any_tag_handlers_;
+};
+
+}  // namespace verible
+
+#endif  // VERIBLE_COMMON_UTIL_TAG_DISPATCH_TABLE_H_
@@ -0,0 +1,64 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/util/tag_dispatch_table.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace verible {
+namespace {
+
+using Ids = std::vector<size_t>;
+
+TEST(TagDispatchTableTest, Empty) {
+  const TagDispatchTable table;
+  EXPECT_TRUE(table.Get(0).empty());
+  EXPECT_TRUE(table.Get(-1).empty());
+}
+
+TEST(TagDispatchTableTest, HandlersOfTags) {
+  TagDispatchTable table;
+  table.Add(0, {3, 1});
+  table.Add(1, {1});
+  table.Add(2, {5, 5});  // Duplicates are ignored.
+  EXPECT_EQ(table.Get(0), Ids());
+  EXPECT_EQ(table.Get(1), Ids({0, 1}));
+  EXPECT_EQ(table.Get(3), Ids({0}));
+  EXPECT_EQ(table.Get(5), Ids({2}));
+  EXPECT_EQ(table.Get(6), Ids());
+  EXPECT_EQ(table.Get(-1), Ids());
+}
+
+TEST(TagDispatchTableTest, HandlersOfAllTags) {
+  TagDispatchTable table;
+  table.Add(0, {2});
+  table.Add(1, {});
+  table.Add(4, {7});  // Extends the table past tags seen before.
+  table.Add(5, {});
+  EXPECT_EQ(table.Get(0), Ids({1, 5}));
+  EXPECT_EQ(table.Get(2), Ids({0, 1, 5}));
+  EXPECT_EQ(table.Get(5), Ids({1, 5}));
+  EXPECT_EQ(table.Get(7), Ids({1, 4, 5}));
+  EXPECT_EQ(table.Get(100), Ids({1, 5}));
+  EXPECT_EQ(table.Get(-1), Ids({1, 5}));
+
+  table.Clear();
+  EXPECT_EQ(table.Get(2), Ids());
+}
+
+}  // namespace
+}  // namespace verible
@@ -16,6 +16,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -26,6 +27,7 @@
 #include "common/text/syntax_tree_context.h"
 #include "common/util/casts.h"
 #include "verilog/CST/verilog_matchers.h"  // IWYU pragma: keep
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -38,6 +40,7 @@ using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SearchSyntaxTree;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register AlwaysCombBlockingRule
@@ -63,28 +66,29 @@ static const Matcher &AlwaysCombMatcher() {
   return matcher;
 }
 
-void AlwaysCombBlockingRule::HandleSymbol(const verible::Symbol &symbol,
-                                          const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-
-  if (AlwaysCombMatcher().Matches(symbol, &manager)) {
-    for (const auto &match :
-         SearchSyntaxTree(symbol, NodekNonblockingAssignmentStatement())) {
-      if (match.match->Kind() != verible::SymbolKind::kNode) continue;
-
-      const auto *node =
-          down_cast<const verible::SyntaxTreeNode *>(match.match);
-
-      const verible::SyntaxTreeLeaf *leaf = verible::GetSubtreeAsLeaf(
-          *node, NodeEnum::kNonblockingAssignmentStatement, 1);
+std::vector<Matcher> AlwaysCombBlockingRule::SymbolMatchers() const {
+  return {AlwaysCombMatcher()};
+}
 
-      if (leaf && leaf->get().token_enum() == TK_LE) {
-        violations_.insert(
-            LintViolation(*leaf, kMessage, match.context,
-                          {AutoFix("Use blocking assignment '=' instead of "
-                                   "nonblocking assignment '<='",
-                                   {leaf->get(), "="})}));
-      }
+void AlwaysCombBlockingRule::HandleMatch(size_t matcher_index,
+                                         const verible::Symbol &symbol,
+                                         const BoundSymbolManager &bound,
+                                         const SyntaxTreeContext &context) {
+  for (const auto &match :
+       SearchSyntaxTree(symbol, NodekNonblockingAssignmentStatement())) {
+    if (match.match->Kind() != verible::SymbolKind::kNode) continue;
+
+    const auto *node = down_cast<const verible::SyntaxTreeNode *>(match.match);
+
+    const verible::SyntaxTreeLeaf *leaf = verible::GetSubtreeAsLeaf(
+        *node, NodeEnum::kNonblockingAssignmentStatement, 1);
+
+    if (leaf && leaf->get().token_enum() == TK_LE) {
+      violations_.insert(
+          LintViolation(*leaf, kMessage, match.context,
+                        {AutoFix("Use blocking assignment '=' instead of "
+                                 "nonblocking assignment '<='",
+                                 {leaf->get(), "="})}));
     }
   }
 }
@@ -26,6 +26,7 @@
 #include "common/text/syntax_tree_context.h"
 #include "verilog/CST/statement.h"
 #include "verilog/CST/verilog_matchers.h"  // IWYU pragma: keep
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -36,6 +37,7 @@ using verible::AutoFix;
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register AlwaysCombRule
@@ -72,18 +74,19 @@ static const Matcher &AlwaysStarMatcherWithParentheses() {
   return matcher;
 }
 
-void AlwaysCombRule::HandleSymbol(const verible::Symbol &symbol,
-                                  const SyntaxTreeContext &context) {
-  // Check for offending use of always @*
-  verible::matcher::BoundSymbolManager manager;
+// Indices of the matchers in SymbolMatchers().
+enum { kAlwaysStarMatcher, kAlwaysStarWithParenthesesMatcher };
 
-  bool always_no_paren = AlwaysStarMatcher().Matches(symbol, &manager);
-  bool always_paren =
-      AlwaysStarMatcherWithParentheses().Matches(symbol, &manager);
-  if (!always_no_paren && !always_paren) {
-    return;
-  }
+std::vector<Matcher> AlwaysCombRule::SymbolMatchers() const {
+  return {AlwaysStarMatcher(), AlwaysStarMatcherWithParentheses()};
+}
 
+void AlwaysCombRule::HandleMatch(size_t matcher_index,
+                                 const verible::Symbol &symbol,
+                                 const BoundSymbolManager &bound,
+                                 const SyntaxTreeContext &context) {
+  // Offending use of always @*
+  const bool always_paren = matcher_index == kAlwaysStarWithParenthesesMatcher;
   const absl::string_view fix_message =
       always_paren ? "Substitute 'always @(*)' for 'always_comb'"
                    : "Substitute 'always @*' for 'always_comb'";
@@ -43,6 +43,8 @@ class AlwaysFFNonBlockingRule : public verible::SyntaxTreeLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Detects entering and leaving relevant code inside always_ff
   bool InsideBlock(const verible::Symbol &symbol, int depth);
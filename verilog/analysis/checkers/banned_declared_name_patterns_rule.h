@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_BANNED_DECLARED_NAME_PATTERNS_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_BANNED_DECLARED_NAME_PATTERNS_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -42,6 +43,8 @@ class BannedDeclaredNamePatternsRule : public verible::SyntaxTreeLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   std::set<verible::LintViolation> violations_;
 };
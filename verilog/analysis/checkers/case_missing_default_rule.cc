@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/case_missing_default_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -25,6 +26,7 @@
 #include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -33,6 +35,7 @@ namespace analysis {
 
 using verible::LintRuleStatus;
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register CaseMissingDefaultRule
@@ -56,11 +59,15 @@ static const Matcher &CaseMatcher() {
   return matcher;
 }
 
-void CaseMissingDefaultRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (context.DirectParentIs(NodeEnum::kCaseStatement) &&
-      CaseMatcher().Matches(symbol, &manager)) {
+std::vector<Matcher> CaseMissingDefaultRule::SymbolMatchers() const {
+  return {CaseMatcher()};
+}
+
+void CaseMissingDefaultRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  if (context.DirectParentIs(NodeEnum::kCaseStatement)) {
     violations_.insert(LintViolation(symbol, kMessage, context));
   }
 }
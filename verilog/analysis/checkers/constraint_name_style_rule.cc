@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/constraint_name_style_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -27,6 +28,7 @@
 #include "common/text/token_info.h"
 #include "verilog/CST/constraints.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -37,6 +39,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register ConstraintNameStyleRule.
@@ -61,28 +64,31 @@ static const Matcher& ConstraintMatcher() {
   return matcher;
 }
 
-void ConstraintNameStyleRule::HandleSymbol(const verible::Symbol& symbol,
-                                           const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ConstraintMatcher().Matches(symbol, &manager)) {
-    // Since an out-of-line definition is always followed by a forward
-    // declaration somewhere else (in this case inside a class), we can just
-    // ignore all out-of-line definitions to  avoid duplicate lint errors on
-    // the same name.
-    if (IsOutOfLineConstraintDefinition(symbol)) {
-      return;
-    }
-
-    const auto* identifier_token =
-        GetSymbolIdentifierFromConstraintDeclaration(symbol);
-    if (!identifier_token) return;
-
-    const absl::string_view constraint_name = identifier_token->text();
-
-    if (!verible::IsLowerSnakeCaseWithDigits(constraint_name) ||
-        !absl::EndsWith(constraint_name, "_c")) {
-      violations_.insert(LintViolation(*identifier_token, kMessage, context));
-    }
+std::vector<Matcher> ConstraintNameStyleRule::SymbolMatchers() const {
+  return {ConstraintMatcher()};
+}
+
+void ConstraintNameStyleRule::HandleMatch(size_t matcher_index,
+                                          const verible::Symbol& symbol,
+                                          const BoundSymbolManager& bound,
+                                          const SyntaxTreeContext& context) {
+  // Since an out-of-line definition is always followed by a forward
+  // declaration somewhere else (in this case inside a class), we can just
+  // ignore all out-of-line definitions to  avoid duplicate lint errors on
+  // the same name.
+  if (IsOutOfLineConstraintDefinition(symbol)) {
+    return;
+  }
+
+  const auto* identifier_token =
+      GetSymbolIdentifierFromConstraintDeclaration(symbol);
+  if (!identifier_token) return;
+
+  const absl::string_view constraint_name = identifier_token->text();
+
+  if (!verible::IsLowerSnakeCaseWithDigits(constraint_name) ||
+      !absl::EndsWith(constraint_name, "_c")) {
+    violations_.insert(LintViolation(*identifier_token, kMessage, context));
   }
 }
 
@@ -15,10 +15,14 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_CONSTRAINT_NAME_STYLE_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_CONSTRAINT_NAME_STYLE_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "common/analysis/lint_rule_status.h"
+#include "common/analysis/matcher/bound_symbol_manager.h"
+#include "common/analysis/matcher/matcher.h"
 #include "common/analysis/syntax_tree_lint_rule.h"
 #include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
@@ -36,11 +40,16 @@ class ConstraintNameStyleRule : public verible::SyntaxTreeLintRule {
 
   static const LintRuleDescriptor& GetDescriptor();
 
-  void HandleSymbol(const verible::Symbol& symbol,
-                    const verible::SyntaxTreeContext& context) final;
+  std::vector<verible::matcher::Matcher> SymbolMatchers() const final;
+
+  void HandleMatch(size_t matcher_index, const verible::Symbol& symbol,
+                   const verible::matcher::BoundSymbolManager& bound,
+                   const verible::SyntaxTreeContext& context) final;
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   std::set<verible::LintViolation> violations_;
 };
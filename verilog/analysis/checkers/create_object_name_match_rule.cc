@@ -18,6 +18,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -48,6 +49,7 @@ using verible::SyntaxTreeContext;
 using verible::SyntaxTreeLeaf;
 using verible::SyntaxTreeNode;
 using verible::TokenInfo;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register CreateObjectNameMatchRule
@@ -176,23 +178,25 @@ static std::string FormatReason(absl::string_view decl_name,
       decl_name, ", got: ", name_text, ". ");
 }
 
-void CreateObjectNameMatchRule::HandleSymbol(const verible::Symbol &symbol,
-                                             const SyntaxTreeContext &context) {
-  // Check for assignments that match the pattern.
-  verible::matcher::BoundSymbolManager manager;
-  if (!CreateAssignmentMatcher().Matches(symbol, &manager)) return;
+std::vector<Matcher> CreateObjectNameMatchRule::SymbolMatchers() const {
+  return {CreateAssignmentMatcher()};
+}
 
+void CreateObjectNameMatchRule::HandleMatch(size_t matcher_index,
+                                            const verible::Symbol &symbol,
+                                            const BoundSymbolManager &bound,
+                                            const SyntaxTreeContext &context) {
   // Extract named bindings for matched nodes within this match.
 
-  const auto *lval_ref = manager.GetAs<SyntaxTreeNode>("lval_ref");
+  const auto *lval_ref = bound.GetAs<SyntaxTreeNode>("lval_ref");
   if (lval_ref == nullptr) return;
 
   const TokenInfo *lval_id = ReferenceIsSimpleIdentifier(*lval_ref);
   if (lval_id == nullptr) return;
   if (lval_id->token_enum() != SymbolIdentifier) return;
 
-  const auto *call = manager.GetAs<SyntaxTreeNode>("func");
-  const auto *args = manager.GetAs<SyntaxTreeNode>("args");
+  const auto *call = bound.GetAs<SyntaxTreeNode>("func");
+  const auto *args = bound.GetAs<SyntaxTreeNode>("args");
   if (call == nullptr) return;
   if (args == nullptr) return;
   if (!QualifiedCallIsTypeIdCreate(*call)) return;
@@ -15,10 +15,13 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_CREATE_OBJECT_NAME_MATCH_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_CREATE_OBJECT_NAME_MATCH_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "common/analysis/lint_rule_status.h"
+#include "common/analysis/matcher/bound_symbol_manager.h"
 #include "common/analysis/matcher/core_matchers.h"
 #include "common/analysis/matcher/matcher.h"
 #include "common/analysis/matcher/matcher_builders.h"
@@ -46,11 +49,16 @@ class CreateObjectNameMatchRule : public verible::SyntaxTreeLintRule {
 
   static const LintRuleDescriptor &GetDescriptor();
 
-  void HandleSymbol(const verible::Symbol &symbol,
-                    const verible::SyntaxTreeContext &context) final;
+  std::vector<verible::matcher::Matcher> SymbolMatchers() const final;
+
+  void HandleMatch(size_t matcher_index, const verible::Symbol &symbol,
+                   const verible::matcher::BoundSymbolManager &bound,
+                   const verible::SyntaxTreeContext &context) final;
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Record of found violations.
   std::set<verible::LintViolation> violations_;
@@ -16,6 +16,7 @@
 
 #include <iterator>
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -36,6 +37,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(DisableStatementNoLabelsRule);
@@ -65,12 +67,13 @@ static const Matcher &DisableMatcher() {
   return matcher;
 }
 
-void DisableStatementNoLabelsRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (!DisableMatcher().Matches(symbol, &manager)) {
-    return;
-  }
+std::vector<Matcher> DisableStatementNoLabelsRule::SymbolMatchers() const {
+  return {DisableMatcher()};
+}
+
+void DisableStatementNoLabelsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
   absl::string_view message_final = kMessage;
   // if no kDisable label, return, nothing to be checked
   const auto &disableLabels = FindAllSymbolIdentifierLeafs(symbol);
@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_ENDIF_COMMENT_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_ENDIF_COMMENT_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <stack>
 #include <string>
@@ -56,6 +57,8 @@ class EndifCommentRule : public verible::TokenStreamLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // States of the internal token-based analysis.
   enum class State {
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/enum_name_style_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -27,6 +28,7 @@
 #include "common/util/logging.h"
 #include "verilog/CST/type.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
@@ -37,6 +39,7 @@ VERILOG_REGISTER_LINT_RULE(EnumNameStyleRule);
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 static constexpr absl::string_view kMessage =
@@ -59,24 +62,27 @@ static const Matcher& TypedefMatcher() {
   return matcher;
 }
 
-void EnumNameStyleRule::HandleSymbol(const verible::Symbol& symbol,
-                                     const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (TypedefMatcher().Matches(symbol, &manager)) {
-    // TODO: This can be changed to checking type of child (by index) when we
-    // have consistent shape for all kTypeDeclaration nodes.
-    if (!FindAllEnumTypes(symbol).empty()) {
-      const auto* identifier_leaf = GetIdentifierFromTypeDeclaration(symbol);
-      const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
-      if (!verible::IsLowerSnakeCaseWithDigits(name) ||
-          !(absl::EndsWith(name, "_t") || absl::EndsWith(name, "_e"))) {
-        violations_.insert(
-            LintViolation(identifier_leaf->get(), kMessage, context));
-      }
-    } else {
-      // Not an enum definition
-      return;
+std::vector<Matcher> EnumNameStyleRule::SymbolMatchers() const {
+  return {TypedefMatcher()};
+}
+
+void EnumNameStyleRule::HandleMatch(size_t matcher_index,
+                                    const verible::Symbol& symbol,
+                                    const BoundSymbolManager& bound,
+                                    const SyntaxTreeContext& context) {
+  // TODO: This can be changed to checking type of child (by index) when we
+  // have consistent shape for all kTypeDeclaration nodes.
+  if (!FindAllEnumTypes(symbol).empty()) {
+    const auto* identifier_leaf = GetIdentifierFromTypeDeclaration(symbol);
+    const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
+    if (!verible::IsLowerSnakeCaseWithDigits(name) ||
+        !(absl::EndsWith(name, "_t") || absl::EndsWith(name, "_e"))) {
+      violations_.insert(
+          LintViolation(identifier_leaf->get(), kMessage, context));
     }
+  } else {
+    // Not an enum definition
+    return;
   }
 }
 
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/explicit_function_lifetime_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -27,6 +28,7 @@
 #include "verilog/CST/functions.h"
 #include "verilog/CST/identifier.h"
 #include "verilog/CST/verilog_matchers.h"  // IWYU pragma: keep
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -36,6 +38,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register ExplicitFunctionLifetimeRule
@@ -60,25 +63,27 @@ static const Matcher &FunctionMatcher() {
   return matcher;
 }
 
-void ExplicitFunctionLifetimeRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
+std::vector<Matcher> ExplicitFunctionLifetimeRule::SymbolMatchers() const {
+  return {FunctionMatcher()};
+}
+
+void ExplicitFunctionLifetimeRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
   // Don't need to check for lifetime declaration if context is inside a class
   if (ContextIsInsideClass(context)) return;
 
-  verible::matcher::BoundSymbolManager manager;
-  if (FunctionMatcher().Matches(symbol, &manager)) {
-    // If function id is qualified, it is an out-of-line
-    // class method definition, which is also exempt.
-    const auto *function_id = ABSL_DIE_IF_NULL(GetFunctionId(symbol));
-    if (IdIsQualified(*function_id)) return;
+  // If function id is qualified, it is an out-of-line
+  // class method definition, which is also exempt.
+  const auto *function_id = ABSL_DIE_IF_NULL(GetFunctionId(symbol));
+  if (IdIsQualified(*function_id)) return;
 
-    // Make sure the lifetime was set
-    if (GetFunctionLifetime(symbol) == nullptr) {
-      // Point to the function id.
-      const verible::TokenInfo token(SymbolIdentifier,
-                                     verible::StringSpanOfSymbol(*function_id));
-      violations_.insert(LintViolation(token, kMessage, context));
-    }
+  // Make sure the lifetime was set
+  if (GetFunctionLifetime(symbol) == nullptr) {
+    // Point to the function id.
+    const verible::TokenInfo token(SymbolIdentifier,
+                                   verible::StringSpanOfSymbol(*function_id));
+    violations_.insert(LintViolation(token, kMessage, context));
   }
 }
 
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/explicit_function_task_parameter_type_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -27,6 +28,7 @@
 #include "verilog/CST/port.h"
 #include "verilog/CST/type.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -36,6 +38,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register ExplicitFunctionTaskParameterTypeRule
@@ -61,15 +64,18 @@ static const Matcher &PortMatcher() {
   return matcher;
 }
 
-void ExplicitFunctionTaskParameterTypeRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (PortMatcher().Matches(symbol, &manager)) {
-    const auto *type_node = GetTypeOfTaskFunctionPortItem(symbol);
-    if (!IsStorageTypeOfDataTypeSpecified(*ABSL_DIE_IF_NULL(type_node))) {
-      const auto *port_id = GetIdentifierFromTaskFunctionPortItem(symbol);
-      violations_.insert(LintViolation(*port_id, kMessage, context));
-    }
+std::vector<Matcher> ExplicitFunctionTaskParameterTypeRule::SymbolMatchers()
+    const {
+  return {PortMatcher()};
+}
+
+void ExplicitFunctionTaskParameterTypeRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
+  const auto *type_node = GetTypeOfTaskFunctionPortItem(symbol);
+  if (!IsStorageTypeOfDataTypeSpecified(*ABSL_DIE_IF_NULL(type_node))) {
+    const auto *port_id = GetIdentifierFromTaskFunctionPortItem(symbol);
+    violations_.insert(LintViolation(*port_id, kMessage, context));
   }
 }
 
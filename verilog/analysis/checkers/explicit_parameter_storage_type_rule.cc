@@ -29,6 +29,7 @@
 #include "common/util/logging.h"
 #include "verilog/CST/parameters.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -38,6 +39,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register ExplicitParameterStorageTypeRule
@@ -74,21 +76,23 @@ static bool HasStringAssignment(const verible::Symbol &param_decl) {
          verilog_tokentype::TK_StringLiteral;
 }
 
-void ExplicitParameterStorageTypeRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamMatcher().Matches(symbol, &manager)) {
-    // 'parameter type' declarations have a storage type declared.
-    if (IsParamTypeDeclaration(symbol)) return;
-
-    const auto *type_info_symbol = GetParamTypeInfoSymbol(symbol);
-    if (IsTypeInfoEmpty(*ABSL_DIE_IF_NULL(type_info_symbol))) {
-      if (exempt_string_ && HasStringAssignment(symbol)) return;
-      const verible::TokenInfo *param_name = GetParameterNameToken(symbol);
-      violations_.insert(LintViolation(
-          *param_name, absl::StrCat(kMessage, "(", param_name->text(), ")."),
-          context));
-    }
+std::vector<Matcher> ExplicitParameterStorageTypeRule::SymbolMatchers() const {
+  return {ParamMatcher()};
+}
+
+void ExplicitParameterStorageTypeRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
+  // 'parameter type' declarations have a storage type declared.
+  if (IsParamTypeDeclaration(symbol)) return;
+
+  const auto *type_info_symbol = GetParamTypeInfoSymbol(symbol);
+  if (IsTypeInfoEmpty(*ABSL_DIE_IF_NULL(type_info_symbol))) {
+    if (exempt_string_ && HasStringAssignment(symbol)) return;
+    const verible::TokenInfo *param_name = GetParameterNameToken(symbol);
+    violations_.insert(LintViolation(
+        *param_name, absl::StrCat(kMessage, "(", param_name->text(), ")."),
+        context));
   }
 }
 
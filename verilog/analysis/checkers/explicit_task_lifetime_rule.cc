@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/explicit_task_lifetime_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -27,6 +28,7 @@
 #include "verilog/CST/identifier.h"
 #include "verilog/CST/tasks.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -36,6 +38,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register ExplicitTaskLifetimeRule
@@ -60,25 +63,28 @@ static const Matcher &TaskMatcher() {
   return matcher;
 }
 
-void ExplicitTaskLifetimeRule::HandleSymbol(const verible::Symbol &symbol,
-                                            const SyntaxTreeContext &context) {
+std::vector<Matcher> ExplicitTaskLifetimeRule::SymbolMatchers() const {
+  return {TaskMatcher()};
+}
+
+void ExplicitTaskLifetimeRule::HandleMatch(size_t matcher_index,
+                                           const verible::Symbol &symbol,
+                                           const BoundSymbolManager &bound,
+                                           const SyntaxTreeContext &context) {
   // Don't need to check for lifetime declaration if context is inside a class
   if (ContextIsInsideClass(context)) return;
 
-  verible::matcher::BoundSymbolManager manager;
-  if (TaskMatcher().Matches(symbol, &manager)) {
-    // If task id is qualified, it is an out-of-line
-    // class task definition, which is also exempt.
-    const auto *task_id = GetTaskId(symbol);
-    if (IdIsQualified(*task_id)) return;
+  // If task id is qualified, it is an out-of-line
+  // class task definition, which is also exempt.
+  const auto *task_id = GetTaskId(symbol);
+  if (IdIsQualified(*task_id)) return;
 
-    // Make sure the lifetime was set
-    if (GetTaskLifetime(symbol) == nullptr) {
-      // Point to the task id.
-      const verible::TokenInfo token(SymbolIdentifier,
-                                     verible::StringSpanOfSymbol(*task_id));
-      violations_.insert(LintViolation(token, kMessage, context));
-    }
+  // Make sure the lifetime was set
+  if (GetTaskLifetime(symbol) == nullptr) {
+    // Point to the task id.
+    const verible::TokenInfo token(SymbolIdentifier,
+                                   verible::StringSpanOfSymbol(*task_id));
+    violations_.insert(LintViolation(token, kMessage, context));
   }
 }
 
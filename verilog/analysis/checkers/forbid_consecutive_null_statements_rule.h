@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_FORBID_CONSECUTIVE_NULL_STATEMENTS_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_FORBID_CONSECUTIVE_NULL_STATEMENTS_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -45,6 +46,8 @@ class ForbidConsecutiveNullStatementsRule : public verible::SyntaxTreeLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // States of the internal leaf-based analysis.
   enum class State {
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/forbid_defparam_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -24,12 +25,14 @@
 #include "common/text/syntax_tree_context.h"
 #include "common/util/logging.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -52,18 +55,21 @@ static const Matcher &OverrideMatcher() {
   return matcher;
 }
 
-void ForbidDefparamRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (OverrideMatcher().Matches(symbol, &manager)) {
-    const verible::SyntaxTreeLeaf *defparam =
-        GetSubtreeAsLeaf(symbol, NodeEnum::kParameterOverride, 0);
-    if (defparam) {
-      const auto &defparam_token = defparam->get();
-      CHECK_EQ(defparam_token.token_enum(), TK_defparam);
-      violations_.insert(
-          verible::LintViolation(defparam_token, kMessage, context));
-    }
+std::vector<Matcher> ForbidDefparamRule::SymbolMatchers() const {
+  return {OverrideMatcher()};
+}
+
+void ForbidDefparamRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  const verible::SyntaxTreeLeaf *defparam =
+      GetSubtreeAsLeaf(symbol, NodeEnum::kParameterOverride, 0);
+  if (defparam) {
+    const auto &defparam_token = defparam->get();
+    CHECK_EQ(defparam_token.token_enum(), TK_defparam);
+    violations_.insert(
+        verible::LintViolation(defparam_token, kMessage, context));
   }
 }
 
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/forbid_negative_array_dim.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -25,12 +26,14 @@
 #include "common/text/tree_utils.h"
 #include "verilog/CST/expression.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -54,8 +57,14 @@ static const Matcher &UnaryPrefixExprMatcher() {
   return matcher;
 }
 
-void ForbidNegativeArrayDim::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
+std::vector<Matcher> ForbidNegativeArrayDim::SymbolMatchers() const {
+  return {UnaryPrefixExprMatcher()};
+}
+
+void ForbidNegativeArrayDim::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
   // This only works for simple unary expressions. They can't be nested inside
   // other expressions. This avoids false positives of the form:
   // logic l [10+(-5):0], logic l[-(-5):0]
@@ -65,9 +74,6 @@ void ForbidNegativeArrayDim::HandleSymbol(
     return;
   }
 
-  verible::matcher::BoundSymbolManager manager;
-  if (!UnaryPrefixExprMatcher().Matches(symbol, &manager)) return;
-
   // As we've previously ensured that this symbol is a kUnaryPrefixExpression
   // both its operator and operand are defined
   const verible::TokenInfo *u_operator =
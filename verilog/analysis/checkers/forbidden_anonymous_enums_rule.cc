@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/forbidden_anonymous_enums_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -23,6 +24,7 @@
 #include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -31,6 +33,7 @@ namespace analysis {
 
 using verible::LintRuleStatus;
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register the lint rule
@@ -55,16 +58,19 @@ static const Matcher &EnumMatcher() {
   return matcher;
 }
 
-void ForbiddenAnonymousEnumsRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (EnumMatcher().Matches(symbol, &manager)) {
-    // Check if it is preceded by a typedef
-    if (!context.DirectParentsAre({NodeEnum::kDataTypePrimitive,
-                                   NodeEnum::kDataType,
-                                   NodeEnum::kTypeDeclaration})) {
-      violations_.insert(LintViolation(symbol, kMessage, context));
-    }
+std::vector<Matcher> ForbiddenAnonymousEnumsRule::SymbolMatchers() const {
+  return {EnumMatcher()};
+}
+
+void ForbiddenAnonymousEnumsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  // Check if it is preceded by a typedef
+  if (!context.DirectParentsAre({NodeEnum::kDataTypePrimitive,
+                                 NodeEnum::kDataType,
+                                 NodeEnum::kTypeDeclaration})) {
+    violations_.insert(LintViolation(symbol, kMessage, context));
   }
 }
 
@@ -14,7 +14,9 @@
 
 #include "verilog/analysis/checkers/forbidden_anonymous_structs_unions_rule.h"
 
+#include <cstddef>
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -24,6 +26,7 @@
 #include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -32,6 +35,7 @@ namespace analysis {
 
 using verible::LintRuleStatus;
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -89,12 +93,22 @@ bool ForbiddenAnonymousStructsUnionsRule::IsRuleMet(
          (allow_anonymous_nested_type_ && NestedInStructOrUnion(context));
 }
 
-void ForbiddenAnonymousStructsUnionsRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (StructMatcher().Matches(symbol, &manager) && !IsRuleMet(context)) {
+// Indices of the matchers in SymbolMatchers().
+enum { kStructMatcher, kUnionMatcher };
+
+std::vector<Matcher> ForbiddenAnonymousStructsUnionsRule::SymbolMatchers()
+    const {
+  return {StructMatcher(), UnionMatcher()};
+}
+
+void ForbiddenAnonymousStructsUnionsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  if (IsRuleMet(context)) return;
+  if (matcher_index == kStructMatcher) {
     violations_.insert(LintViolation(symbol, kMessageStruct, context));
-  } else if (UnionMatcher().Matches(symbol, &manager) && !IsRuleMet(context)) {
+  } else if (matcher_index == kUnionMatcher) {
     violations_.insert(LintViolation(symbol, kMessageUnion, context));
   }
 }
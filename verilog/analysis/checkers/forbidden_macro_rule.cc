@@ -17,6 +17,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/citation.h"
@@ -31,12 +32,14 @@
 #include "verilog/CST/verilog_matchers.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
+#include "verilog/parser/verilog_token_enum.h"
 
 namespace verilog {
 namespace analysis {
 
 using verible::GetStyleGuideCitation;
 using verible::container::FindWithDefault;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register ForbiddenMacroRule
@@ -68,16 +71,19 @@ const std::map<std::string, std::string>
   return *invalid_symbols;
 }
 
-void ForbiddenMacroRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (MacroCallMatcher().Matches(symbol, &manager)) {
-    if (const auto *leaf = manager.GetAs<verible::SyntaxTreeLeaf>("name")) {
-      const auto &imm = InvalidMacrosMap();
-      if (imm.find(std::string(leaf->get().text())) != imm.end()) {
-        violations_.insert(
-            verible::LintViolation(leaf->get(), FormatReason(*leaf), context));
-      }
+std::vector<Matcher> ForbiddenMacroRule::SymbolMatchers() const {
+  return {MacroCallMatcher()};
+}
+
+void ForbiddenMacroRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  if (const auto *leaf = bound.GetAs<verible::SyntaxTreeLeaf>("name")) {
+    const auto &imm = InvalidMacrosMap();
+    if (imm.find(std::string(leaf->get().text())) != imm.end()) {
+      violations_.insert(
+          verible::LintViolation(leaf->get(), FormatReason(*leaf), context));
     }
   }
 }
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <vector>
+
 #include "verilog/analysis/checkers/generate_label_prefix_rule.h"
 
 #include "absl/strings/match.h"
@@ -24,12 +26,14 @@
 #include "verilog/CST/identifier.h"
 #include "verilog/CST/seq_block.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -57,34 +61,37 @@ static const Matcher &BlockMatcher() {
   return matcher;
 }
 
-void GenerateLabelPrefixRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (BlockMatcher().Matches(symbol, &manager)) {
-    // Exclude case generate statements, as kGenerateBlock is generated for
-    // each 'case' item too.
-    if (context.IsInside(NodeEnum::kGenerateCaseItemList)) {
-      return;
-    }
+std::vector<Matcher> GenerateLabelPrefixRule::SymbolMatchers() const {
+  return {BlockMatcher()};
+}
 
-    for (const auto &child : SymbolCastToNode(symbol).children()) {
-      const verible::TokenInfo *label = nullptr;
-      switch (NodeEnum(SymbolCastToNode(*child).Tag().tag)) {
-        case NodeEnum::kBegin:
-          label = GetBeginLabelTokenInfo(*child);
-          break;
-        case NodeEnum::kEnd:
-          label = GetEndLabelTokenInfo(*child);
-          break;
-        default:
-          continue;
-      }
+void GenerateLabelPrefixRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  // Exclude case generate statements, as kGenerateBlock is generated for
+  // each 'case' item too.
+  if (context.IsInside(NodeEnum::kGenerateCaseItemList)) {
+    return;
+  }
+
+  for (const auto &child : SymbolCastToNode(symbol).children()) {
+    const verible::TokenInfo *label = nullptr;
+    switch (NodeEnum(SymbolCastToNode(*child).Tag().tag)) {
+      case NodeEnum::kBegin:
+        label = GetBeginLabelTokenInfo(*child);
+        break;
+      case NodeEnum::kEnd:
+        label = GetEndLabelTokenInfo(*child);
+        break;
+      default:
+        continue;
+    }
 
-      if (label != nullptr) {
-        if (!(absl::StartsWith(label->text(), "g_") ||
-              absl::StartsWith(label->text(), "gen_"))) {
-          violations_.insert(verible::LintViolation(*label, kMessage, context));
-        }
+    if (label != nullptr) {
+      if (!(absl::StartsWith(label->text(), "g_") ||
+            absl::StartsWith(label->text(), "gen_"))) {
+        violations_.insert(verible::LintViolation(*label, kMessage, context));
       }
     }
   }
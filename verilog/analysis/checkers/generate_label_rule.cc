@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/generate_label_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -24,12 +25,14 @@
 #include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -60,12 +63,15 @@ static const Matcher &BlockMatcher() {
   return matcher;
 }
 
-void GenerateLabelRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (BlockMatcher().Matches(symbol, &manager)) {
-    violations_.insert(verible::LintViolation(symbol, kMessage, context));
-  }
+std::vector<Matcher> GenerateLabelRule::SymbolMatchers() const {
+  return {BlockMatcher()};
+}
+
+void GenerateLabelRule::HandleMatch(size_t matcher_index,
+                                    const verible::Symbol &symbol,
+                                    const BoundSymbolManager &bound,
+                                    const verible::SyntaxTreeContext &context) {
+  violations_.insert(verible::LintViolation(symbol, kMessage, context));
 }
 
 verible::LintRuleStatus GenerateLabelRule::Report() const {
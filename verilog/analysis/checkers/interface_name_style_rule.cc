@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/interface_name_style_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -27,6 +28,7 @@
 #include "verilog/CST/module.h"
 #include "verilog/CST/type.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
@@ -37,6 +39,7 @@ VERILOG_REGISTER_LINT_RULE(InterfaceNameStyleRule);
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 static constexpr absl::string_view kMessage =
@@ -59,19 +62,22 @@ static const Matcher& InterfaceMatcher() {
   return matcher;
 }
 
-void InterfaceNameStyleRule::HandleSymbol(const verible::Symbol& symbol,
-                                          const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
+std::vector<Matcher> InterfaceNameStyleRule::SymbolMatchers() const {
+  return {InterfaceMatcher()};
+}
+
+void InterfaceNameStyleRule::HandleMatch(size_t matcher_index,
+                                         const verible::Symbol& symbol,
+                                         const BoundSymbolManager& bound,
+                                         const SyntaxTreeContext& context) {
   absl::string_view name;
   const verible::TokenInfo* identifier_token;
-  if (InterfaceMatcher().Matches(symbol, &manager)) {
-    identifier_token = GetInterfaceNameToken(symbol);
-    name = identifier_token->text();
+  identifier_token = GetInterfaceNameToken(symbol);
+  name = identifier_token->text();
 
-    if (!verible::IsLowerSnakeCaseWithDigits(name) ||
-        !absl::EndsWith(name, "_if")) {
-      violations_.insert(LintViolation(*identifier_token, kMessage, context));
-    }
+  if (!verible::IsLowerSnakeCaseWithDigits(name) ||
+      !absl::EndsWith(name, "_if")) {
+    violations_.insert(LintViolation(*identifier_token, kMessage, context));
   }
 }
 
@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_LEGACY_GENVAR_DECLARATION_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_LEGACY_GENVAR_DECLARATION_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -40,6 +41,8 @@ class LegacyGenvarDeclarationRule : public verible::SyntaxTreeLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   std::set<verible::LintViolation> violations_;
 };
@@ -17,14 +17,15 @@
 #include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/strings/comment_utils.h"
-#include "common/strings/utf8.h"
 #include "common/text/config_utils.h"
 #include "common/text/constants.h"
 #include "common/text/text_structure.h"
@@ -163,10 +164,17 @@ static bool AllowLongLineException(TokenSequence::const_iterator token_begin,
 }
 
 void LineLengthRule::Lint(const TextStructureView& text_structure,
-                          absl::string_view) {
+                          absl::string_view filename) {
+  LintScannedLines(text_structure, filename,
+                   verible::ScanLines(text_structure.Contents()));
+}
+
+void LineLengthRule::LintScannedLines(
+    const TextStructureView& text_structure, absl::string_view,
+    const std::vector<verible::LineScan>& line_scans) {
   size_t lineno = 0;
   for (const auto& line : text_structure.Lines()) {
-    const int observed_line_length = verible::utf8_len(line);
+    const int observed_line_length = line_scans[lineno].utf8_length;
     if (observed_line_length > line_length_limit_) {
       const auto token_range = text_structure.TokenRangeOnLine(lineno);
       // Recall that token_range is *unfiltered* and may contain non-essential
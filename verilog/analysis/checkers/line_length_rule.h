@@ -15,11 +15,14 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_LINE_LENGTH_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_LINE_LENGTH_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/text_structure_lint_rule.h"
 #include "common/text/text_structure.h"
@@ -51,8 +54,13 @@ class LineLengthRule : public verible::TextStructureLintRule {
 
   void Lint(const verible::TextStructureView&, absl::string_view) final;
 
+  void LintScannedLines(const verible::TextStructureView&, absl::string_view,
+                        const std::vector<verible::LineScan>&) final;
+
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   int line_length_limit_ = kDefaultLineLength;
 
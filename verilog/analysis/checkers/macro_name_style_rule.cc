@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/macro_name_style_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -54,6 +55,10 @@ const LintRuleDescriptor &MacroNameStyleRule::GetDescriptor() {
   return d;
 }
 
+std::vector<int> MacroNameStyleRule::InterestedTokenEnums() const {
+  return {PP_define, PP_Identifier, MacroArg, PP_define_body};
+}
+
 void MacroNameStyleRule::HandleToken(const TokenInfo &token) {
   const auto token_enum = static_cast<verilog_tokentype>(token.token_enum());
   const absl::string_view text(token.text());
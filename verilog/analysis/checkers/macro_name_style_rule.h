@@ -15,8 +15,10 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_MACRO_NAME_STYLE_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_MACRO_NAME_STYLE_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/token_stream_lint_rule.h"
@@ -36,10 +38,14 @@ class MacroNameStyleRule : public verible::TokenStreamLintRule {
 
   MacroNameStyleRule() = default;
 
+  std::vector<int> InterestedTokenEnums() const final;
+
   void HandleToken(const verible::TokenInfo &token) final;
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // States of the internal token-based analysis.
   enum class State {
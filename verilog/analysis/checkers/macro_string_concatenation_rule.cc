@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/macro_string_concatenation_rule.h"
 
 #include <cstddef>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/text/token_info.h"
@@ -23,6 +24,7 @@
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_lexer.h"
 #include "verilog/parser/verilog_token_classifications.h"
+#include "verilog/parser/verilog_token_enum.h"
 
 namespace verilog {
 namespace analysis {
@@ -47,6 +49,10 @@ const LintRuleDescriptor &MacroStringConcatenationRule::GetDescriptor() {
   return d;
 }
 
+std::vector<int> MacroStringConcatenationRule::InterestedTokenEnums() const {
+  return {PP_define_body};
+}
+
 void MacroStringConcatenationRule::HandleToken(const TokenInfo &token) {
   const auto token_enum = static_cast<verilog_tokentype>(token.token_enum());
   const absl::string_view text(token.text());
@@ -15,8 +15,10 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_MACRO_STRING_CONCATENATION_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_MACRO_STRING_CONCATENATION_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "common/analysis/token_stream_lint_rule.h"
 #include "common/text/token_info.h"
@@ -35,10 +37,14 @@ class MacroStringConcatenationRule : public verible::TokenStreamLintRule {
 
   MacroStringConcatenationRule() = default;
 
+  std::vector<int> InterestedTokenEnums() const final;
+
   void HandleToken(const verible::TokenInfo &token) final;
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // States of the internal token-based analysis.
   enum class State {
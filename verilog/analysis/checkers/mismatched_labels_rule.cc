@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/mismatched_labels_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -28,12 +29,14 @@
 #include "verilog/CST/identifier.h"
 #include "verilog/CST/seq_block.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -59,34 +62,36 @@ static const Matcher &BeginMatcher() {
   return matcher;
 }
 
-void MismatchedLabelsRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
+std::vector<Matcher> MismatchedLabelsRule::SymbolMatchers() const {
+  return {BeginMatcher()};
+}
 
-  if (BeginMatcher().Matches(symbol, &manager)) {
-    const auto &matchingEnd = GetMatchingEnd(symbol, context);
+void MismatchedLabelsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  const auto &matchingEnd = GetMatchingEnd(symbol, context);
 
-    const auto *begin_label = GetBeginLabelTokenInfo(symbol);
-    const auto *end_label = GetEndLabelTokenInfo(*matchingEnd);
+  const auto *begin_label = GetBeginLabelTokenInfo(symbol);
+  const auto *end_label = GetEndLabelTokenInfo(*matchingEnd);
 
-    // Don't check anything if there is no end label
-    if (end_label == nullptr) {
-      return;
-    }
+  // Don't check anything if there is no end label
+  if (end_label == nullptr) {
+    return;
+  }
 
-    // Error if there is no begin label
-    if (begin_label == nullptr) {
-      violations_.insert(
-          verible::LintViolation(symbol, kMessageMissing, context));
+  // Error if there is no begin label
+  if (begin_label == nullptr) {
+    violations_.insert(
+        verible::LintViolation(symbol, kMessageMissing, context));
 
-      return;
-    }
+    return;
+  }
 
-    // Finally compare the two labels
-    if (begin_label->text() != end_label->text()) {
-      violations_.insert(
-          verible::LintViolation(*end_label, kMessageMismatch, context));
-    }
+  // Finally compare the two labels
+  if (begin_label->text() != end_label->text()) {
+    violations_.insert(
+        verible::LintViolation(*end_label, kMessageMismatch, context));
   }
 }
 
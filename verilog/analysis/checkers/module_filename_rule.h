@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_MODULE_FILENAME_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_MODULE_FILENAME_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -41,6 +42,8 @@ class ModuleFilenameRule : public verible::TextStructureLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Ok to treat dashes as underscores.
   bool allow_dash_for_underscore_ = false;
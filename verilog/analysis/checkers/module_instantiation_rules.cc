@@ -18,6 +18,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -41,6 +42,7 @@ namespace verilog {
 namespace analysis {
 
 using verible::down_cast;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the linter rule
@@ -112,8 +114,14 @@ static bool IsAnyPort(const verible::Symbol *symbol) {
 // ModuleParameterRule Implementation
 //
 
-void ModuleParameterRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
+std::vector<Matcher> ModuleParameterRule::SymbolMatchers() const {
+  return {ParamsMatcher()};
+}
+
+void ModuleParameterRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
   static constexpr absl::string_view kMessage =
       "Pass named parameters for parameterized module instantiations with "
       "more than one parameter";
@@ -123,21 +131,18 @@ void ModuleParameterRule::HandleSymbol(
   // inside module definitions.  Anywhere outside of a module can be skipped.
   if (!ContextIsInsideModule(context)) return;
 
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamsMatcher().Matches(symbol, &manager)) {
-    if (const auto *list = manager.GetAs<verible::SyntaxTreeNode>("list")) {
-      const auto &children = list->children();
-      auto parameter_count = std::count_if(
-          children.begin(), children.end(),
-          [](const verible::SymbolPtr &n) { return n ? !IsComma(*n) : false; });
-
-      // One positional parameter is permitted, but any more require all
-      // parameters to be named.
-      if (parameter_count > 1) {  // Determine the spanning location
-        const auto *leaf_ptr = verible::GetLeftmostLeaf(*list);
-        const verible::TokenInfo token = ABSL_DIE_IF_NULL(leaf_ptr)->get();
-        violations_.insert(verible::LintViolation(token, kMessage, context));
-      }
+  if (const auto *list = bound.GetAs<verible::SyntaxTreeNode>("list")) {
+    const auto &children = list->children();
+    auto parameter_count = std::count_if(
+        children.begin(), children.end(),
+        [](const verible::SymbolPtr &n) { return n ? !IsComma(*n) : false; });
+
+    // One positional parameter is permitted, but any more require all
+    // parameters to be named.
+    if (parameter_count > 1) {  // Determine the spanning location
+      const auto *leaf_ptr = verible::GetLeftmostLeaf(*list);
+      const verible::TokenInfo token = ABSL_DIE_IF_NULL(leaf_ptr)->get();
+      violations_.insert(verible::LintViolation(token, kMessage, context));
     }
   }
 }
@@ -150,26 +155,28 @@ verible::LintRuleStatus ModuleParameterRule::Report() const {
 // ModulePortRule Implementation
 //
 
-void ModulePortRule::HandleSymbol(const verible::Symbol &symbol,
-                                  const verible::SyntaxTreeContext &context) {
+std::vector<Matcher> ModulePortRule::SymbolMatchers() const {
+  return {InstanceMatcher()};
+}
+
+void ModulePortRule::HandleMatch(size_t matcher_index,
+                                 const verible::Symbol &symbol,
+                                 const BoundSymbolManager &bound,
+                                 const verible::SyntaxTreeContext &context) {
   static constexpr absl::string_view kMessage =
       "Use named ports for module instantiation with "
       "more than one port";
 
-  verible::matcher::BoundSymbolManager manager;
-
-  if (InstanceMatcher().Matches(symbol, &manager)) {
-    if (const auto *port_list_node =
-            manager.GetAs<verible::SyntaxTreeNode>("list")) {
-      // Don't know how to handle unexpected non-portlist, so proceed
-      if (!port_list_node->MatchesTag(NodeEnum::kPortActualList)) return;
+  if (const auto *port_list_node =
+          bound.GetAs<verible::SyntaxTreeNode>("list")) {
+    // Don't know how to handle unexpected non-portlist, so proceed
+    if (!port_list_node->MatchesTag(NodeEnum::kPortActualList)) return;
 
-      if (!IsPortListCompliant(*port_list_node)) {
-        // Determine the leftmost location
-        const auto *leaf_ptr = verible::GetLeftmostLeaf(*port_list_node);
-        const verible::TokenInfo token = ABSL_DIE_IF_NULL(leaf_ptr)->get();
-        violations_.insert(verible::LintViolation(token, kMessage, context));
-      }
+    if (!IsPortListCompliant(*port_list_node)) {
+      // Determine the leftmost location
+      const auto *leaf_ptr = verible::GetLeftmostLeaf(*port_list_node);
+      const verible::TokenInfo token = ABSL_DIE_IF_NULL(leaf_ptr)->get();
+      violations_.insert(verible::LintViolation(token, kMessage, context));
     }
   }
 }
@@ -17,6 +17,7 @@
 #include <set>
 
 #include "absl/strings/string_view.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/text/token_info.h"
 #include "verilog/analysis/descriptions.h"
@@ -47,11 +48,14 @@ const LintRuleDescriptor &NoTabsRule::GetDescriptor() {
 }
 
 void NoTabsRule::HandleLine(absl::string_view line) {
-  // Finds first tab in each line, if there is one.
-  // This reports only the first violation on each line.
-  const auto tab_pos = line.find('\t');
-  if (tab_pos != absl::string_view::npos) {
-    TokenInfo token(TK_SPACE, line.substr(tab_pos, 1));
+  HandleScannedLine(line, verible::ScanLine(line));
+}
+
+void NoTabsRule::HandleScannedLine(absl::string_view line,
+                                   const verible::LineScan &scan) {
+  // Reports only the first tab in each line, if there is one.
+  if (scan.first_tab != absl::string_view::npos) {
+    TokenInfo token(TK_SPACE, line.substr(scan.first_tab, 1));
     violations_.insert(LintViolation(token, kMessage));
   }
 }
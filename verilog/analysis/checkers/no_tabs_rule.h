@@ -21,6 +21,7 @@
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_lint_rule.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "verilog/analysis/descriptions.h"
 
@@ -38,8 +39,13 @@ class NoTabsRule : public verible::LineLintRule {
 
   void HandleLine(absl::string_view line) final;
 
+  void HandleScannedLine(absl::string_view line,
+                         const verible::LineScan &scan) final;
+
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Collection of found violations.
   std::set<verible::LintViolation> violations_;
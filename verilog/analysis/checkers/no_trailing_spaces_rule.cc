@@ -14,14 +14,12 @@
 
 #include "verilog/analysis/checkers/no_trailing_spaces_rule.h"
 
-#include <algorithm>
-#include <cctype>
-#include <iterator>
+#include <cstddef>
 #include <set>
 #include <string>
 
 #include "absl/strings/string_view.h"
-#include "absl/strings/strip.h"
+#include "common/analysis/line_scanner.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/text/token_info.h"
 #include "verilog/analysis/descriptions.h"
@@ -51,24 +49,20 @@ const LintRuleDescriptor &NoTrailingSpacesRule::GetDescriptor() {
 }
 
 void NoTrailingSpacesRule::HandleLine(absl::string_view line) {
-  // Lines may end with \n or \r\n. '\n' is already excluded.
-  // Exclude '\r'
-  absl::ConsumeSuffix(&line, "\r");
-  // Now any line endings (either \n or \r\n) are excluded.
-  // Searches each line in reverse for spaces.
-  const auto rbegin = line.crbegin();
-  const auto rend = line.crend();
-  if (rbegin != rend) {
-    const auto reverse_iter =
-        std::find_if(rbegin, rend, [](char c) { return !std::isspace(c); });
-    const int trailing = std::distance(rbegin, reverse_iter);
-    if (trailing != 0) {
-      const int column = line.length() - trailing;
-      const TokenInfo token(TK_SPACE, line.substr(column));
+  HandleScannedLine(line, verible::ScanLine(line));
+}
+
+void NoTrailingSpacesRule::HandleScannedLine(absl::string_view line,
+                                             const verible::LineScan &scan) {
+  // Lines may end with \n or \r\n. '\n' is already excluded, and the scan
+  // excludes '\r' from the trailing spaces.
+  if (scan.HasTrailingSpace()) {
+    const size_t trailing = scan.ContentLength() - scan.trailing_space_begin;
+    const TokenInfo token(TK_SPACE,
+                          line.substr(scan.trailing_space_begin, trailing));
 
-      violations_.insert(LintViolation(
-          token, kMessage, {AutoFix("Remove trailing space", {token, ""})}));
-    }
+    violations_.insert(LintViolation(
+        token, kMessage, {AutoFix("Remove trailing space", {token, ""})}));
   }
 }
 
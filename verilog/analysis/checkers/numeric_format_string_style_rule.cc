@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <set>
+#include <vector>
 
 #include "absl/strings/ascii.h"
 #include "absl/strings/string_view.h"
@@ -81,6 +82,10 @@ void NumericFormatStringStyleRule::CheckAndReportViolation(
   }
 }
 
+std::vector<int> NumericFormatStringStyleRule::InterestedTokenEnums() const {
+  return {TK_StringLiteral, MacroArg, PP_define_body};
+}
+
 void NumericFormatStringStyleRule::HandleToken(const TokenInfo &token) {
   const auto token_enum = static_cast<verilog_tokentype>(token.token_enum());
   const absl::string_view text(token.text());
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/token_stream_lint_rule.h"
@@ -38,10 +39,14 @@ class NumericFormatStringStyleRule : public verible::TokenStreamLintRule {
 
   NumericFormatStringStyleRule() = default;
 
+  std::vector<int> InterestedTokenEnums() const final;
+
   void HandleToken(const verible::TokenInfo &token) final;
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   void CheckAndReportViolation(const verible::TokenInfo &token, size_t position,
                                size_t length,
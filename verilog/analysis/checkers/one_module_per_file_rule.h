@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_ONE_MODULE_PER_FILE_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_ONE_MODULE_PER_FILE_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -40,6 +41,8 @@ class OneModulePerFileRule : public verible::TextStructureLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Collection of found violations.
   std::set<verible::LintViolation> violations_;
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/packed_dimensions_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -28,6 +29,7 @@
 #include "verilog/CST/dimensions.h"
 #include "verilog/CST/expression.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -36,6 +38,7 @@ namespace analysis {
 
 using verible::LintRuleStatus;
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(PackedDimensionsRule);
@@ -60,29 +63,32 @@ static const Matcher &DimensionRangeMatcher() {
   return matcher;
 }
 
-void PackedDimensionsRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
+std::vector<Matcher> PackedDimensionsRule::SymbolMatchers() const {
+  return {DimensionRangeMatcher()};
+}
+
+void PackedDimensionsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
   if (!ContextIsInsidePackedDimensions(context)) return;
 
-  verible::matcher::BoundSymbolManager manager;
-  if (DimensionRangeMatcher().Matches(symbol, &manager)) {
-    // Check whether or not bounds are numeric constants, including 0.
-    // If one can conclude that left < right, then record as violation.
-
-    const auto &left = *ABSL_DIE_IF_NULL(GetDimensionRangeLeftBound(symbol));
-    const auto &right = *ABSL_DIE_IF_NULL(GetDimensionRangeRightBound(symbol));
-    int left_value, right_value;
-    const bool left_is_constant = ConstantIntegerValue(left, &left_value);
-    const bool right_is_constant = ConstantIntegerValue(right, &right_value);
-    const bool left_is_zero = left_is_constant && (left_value == 0);
-    const bool right_is_zero = right_is_constant && (right_value == 0);
-
-    if ((left_is_zero && !right_is_zero) ||
-        (left_is_constant && right_is_constant && left_value < right_value)) {
-      const verible::TokenInfo token(TK_OTHER,
-                                     verible::StringSpanOfSymbol(left, right));
-      violations_.insert(LintViolation(token, kMessage, context));
-    }
+  // Check whether or not bounds are numeric constants, including 0.
+  // If one can conclude that left < right, then record as violation.
+
+  const auto &left = *ABSL_DIE_IF_NULL(GetDimensionRangeLeftBound(symbol));
+  const auto &right = *ABSL_DIE_IF_NULL(GetDimensionRangeRightBound(symbol));
+  int left_value, right_value;
+  const bool left_is_constant = ConstantIntegerValue(left, &left_value);
+  const bool right_is_constant = ConstantIntegerValue(right, &right_value);
+  const bool left_is_zero = left_is_constant && (left_value == 0);
+  const bool right_is_zero = right_is_constant && (right_value == 0);
+
+  if ((left_is_zero && !right_is_zero) ||
+      (left_is_constant && right_is_constant && left_value < right_value)) {
+    const verible::TokenInfo token(TK_OTHER,
+                                   verible::StringSpanOfSymbol(left, right));
+    violations_.insert(LintViolation(token, kMessage, context));
   }
 }
 
@@ -32,6 +32,7 @@
 #include "common/text/token_info.h"
 #include "verilog/CST/parameters.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -42,6 +43,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using Matcher = verible::matcher::Matcher;
 
 // Register ParameterNameStyleRule.
@@ -85,35 +87,37 @@ std::string ParameterNameStyleRule::ViolationMsg(absl::string_view symbol_type,
                       bit_list);
 }
 
-void ParameterNameStyleRule::HandleSymbol(const verible::Symbol &symbol,
-                                          const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamDeclMatcher().Matches(symbol, &manager)) {
-    if (IsParamTypeDeclaration(symbol)) return;
-
-    const auto param_decl_token = GetParamKeyword(symbol);
-
-    auto identifiers = GetAllParameterNameTokens(symbol);
-
-    for (const auto *id : identifiers) {
-      const auto param_name = id->text();
-      uint32_t observed_style = 0;
-      if (verible::IsUpperCamelCaseWithDigits(param_name)) {
-        observed_style |= kUpperCamelCase;
-      }
-      if (verible::IsNameAllCapsUnderscoresDigits(param_name)) {
-        observed_style |= kAllCaps;
-      }
-      if (param_decl_token == TK_localparam && localparam_allowed_style_ &&
-          (observed_style & localparam_allowed_style_) == 0) {
-        violations_.insert(LintViolation(
-            *id, ViolationMsg("localparam", localparam_allowed_style_),
-            context));
-      } else if (param_decl_token == TK_parameter && parameter_allowed_style_ &&
-                 (observed_style & parameter_allowed_style_) == 0) {
-        violations_.insert(LintViolation(
-            *id, ViolationMsg("parameter", parameter_allowed_style_), context));
-      }
+std::vector<Matcher> ParameterNameStyleRule::SymbolMatchers() const {
+  return {ParamDeclMatcher()};
+}
+
+void ParameterNameStyleRule::HandleMatch(size_t matcher_index,
+                                         const verible::Symbol &symbol,
+                                         const BoundSymbolManager &bound,
+                                         const SyntaxTreeContext &context) {
+  if (IsParamTypeDeclaration(symbol)) return;
+
+  const auto param_decl_token = GetParamKeyword(symbol);
+
+  auto identifiers = GetAllParameterNameTokens(symbol);
+
+  for (const auto *id : identifiers) {
+    const auto param_name = id->text();
+    uint32_t observed_style = 0;
+    if (verible::IsUpperCamelCaseWithDigits(param_name)) {
+      observed_style |= kUpperCamelCase;
+    }
+    if (verible::IsNameAllCapsUnderscoresDigits(param_name)) {
+      observed_style |= kAllCaps;
+    }
+    if (param_decl_token == TK_localparam && localparam_allowed_style_ &&
+        (observed_style & localparam_allowed_style_) == 0) {
+      violations_.insert(LintViolation(
+          *id, ViolationMsg("localparam", localparam_allowed_style_), context));
+    } else if (param_decl_token == TK_parameter && parameter_allowed_style_ &&
+               (observed_style & parameter_allowed_style_) == 0) {
+      violations_.insert(LintViolation(
+          *id, ViolationMsg("parameter", parameter_allowed_style_), context));
     }
   }
 }
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/parameter_type_name_style_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
@@ -27,6 +28,7 @@
 #include "common/text/token_info.h"
 #include "verilog/CST/parameters.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -37,6 +39,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register ParameterTypeNameStyleRule.
@@ -62,20 +65,23 @@ static const Matcher& ParamDeclMatcher() {
   return matcher;
 }
 
-void ParameterTypeNameStyleRule::HandleSymbol(
-    const verible::Symbol& symbol, const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamDeclMatcher().Matches(symbol, &manager)) {
-    const verible::TokenInfo* param_name_token = nullptr;
-    if (!IsParamTypeDeclaration(symbol)) return;
+std::vector<Matcher> ParameterTypeNameStyleRule::SymbolMatchers() const {
+  return {ParamDeclMatcher()};
+}
+
+void ParameterTypeNameStyleRule::HandleMatch(size_t matcher_index,
+                                             const verible::Symbol& symbol,
+                                             const BoundSymbolManager& bound,
+                                             const SyntaxTreeContext& context) {
+  const verible::TokenInfo* param_name_token = nullptr;
+  if (!IsParamTypeDeclaration(symbol)) return;
 
-    param_name_token = GetSymbolIdentifierFromParamDeclaration(symbol);
-    const auto param_name = param_name_token->text();
+  param_name_token = GetSymbolIdentifierFromParamDeclaration(symbol);
+  const auto param_name = param_name_token->text();
 
-    if (!verible::IsLowerSnakeCaseWithDigits(param_name) ||
-        !absl::EndsWith(param_name, "_t")) {
-      violations_.insert(LintViolation(*param_name_token, kMessage, context));
-    }
+  if (!verible::IsLowerSnakeCaseWithDigits(param_name) ||
+      !absl::EndsWith(param_name, "_t")) {
+    violations_.insert(LintViolation(*param_name_token, kMessage, context));
   }
 }
 
@@ -16,6 +16,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -29,10 +30,12 @@
 #include "verilog/CST/verilog_matchers.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
+#include "verilog/parser/verilog_token_enum.h"
 
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(PlusargAssignmentRule);
@@ -57,15 +60,18 @@ static const Matcher &IdMatcher() {
   return matcher;
 }
 
-void PlusargAssignmentRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (IdMatcher().Matches(symbol, &manager)) {
-    if (const auto *leaf = manager.GetAs<verible::SyntaxTreeLeaf>("name")) {
-      if (kForbiddenFunctionName == leaf->get().text()) {
-        violations_.insert(
-            verible::LintViolation(leaf->get(), FormatReason(), context));
-      }
+std::vector<Matcher> PlusargAssignmentRule::SymbolMatchers() const {
+  return {IdMatcher()};
+}
+
+void PlusargAssignmentRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  if (const auto *leaf = bound.GetAs<verible::SyntaxTreeLeaf>("name")) {
+    if (kForbiddenFunctionName == leaf->get().text()) {
+      violations_.insert(
+          verible::LintViolation(leaf->get(), FormatReason(), context));
     }
   }
 }
@@ -32,6 +32,7 @@
 #include "verilog/CST/identifier.h"
 #include "verilog/CST/port.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -44,6 +45,7 @@ using verible::LintViolation;
 using verible::Symbol;
 using verible::SyntaxTreeContext;
 using verible::TokenInfo;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register PortNameSuffixRule.
@@ -99,30 +101,32 @@ bool PortNameSuffixRule::IsSuffixCorrect(absl::string_view suffix,
   return suffixes.at(direction).count(suffix) == 1;
 }
 
-void PortNameSuffixRule::HandleSymbol(const Symbol &symbol,
-                                      const SyntaxTreeContext &context) {
+std::vector<Matcher> PortNameSuffixRule::SymbolMatchers() const {
+  return {PortMatcher()};
+}
+
+void PortNameSuffixRule::HandleMatch(size_t matcher_index, const Symbol &symbol,
+                                     const BoundSymbolManager &bound,
+                                     const SyntaxTreeContext &context) {
   constexpr absl::string_view implicit_direction = "input";
-  verible::matcher::BoundSymbolManager manager;
-  if (PortMatcher().Matches(symbol, &manager)) {
-    const auto *identifier_leaf = GetIdentifierFromPortDeclaration(symbol);
-    const auto *direction_leaf = GetDirectionFromPortDeclaration(symbol);
-    const auto token = identifier_leaf->get();
-    const auto direction =
-        direction_leaf ? direction_leaf->get().text() : implicit_direction;
-    const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
-
-    // Check if there is any suffix
-    std::vector<std::string> name_parts =
-        absl::StrSplit(name, '_', absl::SkipEmpty());
-
-    if (name_parts.size() < 2) {
-      // No suffix at all
-      Violation(direction, token, context);
-    }
-
-    if (!IsSuffixCorrect(name_parts.back(), direction)) {
-      Violation(direction, token, context);
-    }
+  const auto *identifier_leaf = GetIdentifierFromPortDeclaration(symbol);
+  const auto *direction_leaf = GetDirectionFromPortDeclaration(symbol);
+  const auto token = identifier_leaf->get();
+  const auto direction =
+      direction_leaf ? direction_leaf->get().text() : implicit_direction;
+  const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
+
+  // Check if there is any suffix
+  std::vector<std::string> name_parts =
+      absl::StrSplit(name, '_', absl::SkipEmpty());
+
+  if (name_parts.size() < 2) {
+    // No suffix at all
+    Violation(direction, token, context);
+  }
+
+  if (!IsSuffixCorrect(name_parts.back(), direction)) {
+    Violation(direction, token, context);
   }
 }
 
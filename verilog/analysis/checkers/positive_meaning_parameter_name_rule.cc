@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/positive_meaning_parameter_name_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -28,6 +29,7 @@
 #include "common/text/token_info.h"
 #include "verilog/CST/parameters.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -38,6 +40,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register PositiveMeaningParameterNameRule.
@@ -62,20 +65,22 @@ static const Matcher &ParamDeclMatcher() {
   return matcher;
 }
 
-void PositiveMeaningParameterNameRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamDeclMatcher().Matches(symbol, &manager)) {
-    if (IsParamTypeDeclaration(symbol)) return;
+std::vector<Matcher> PositiveMeaningParameterNameRule::SymbolMatchers() const {
+  return {ParamDeclMatcher()};
+}
+
+void PositiveMeaningParameterNameRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
+  if (IsParamTypeDeclaration(symbol)) return;
 
-    auto identifiers = GetAllParameterNameTokens(symbol);
-    for (const auto &id : identifiers) {
-      const auto param_name = id->text();
+  auto identifiers = GetAllParameterNameTokens(symbol);
+  for (const auto &id : identifiers) {
+    const auto param_name = id->text();
 
-      if (absl::StartsWithIgnoreCase(param_name, "disable")) {
-        violations_.insert(LintViolation(
-            *id, absl::StrCat(kMessage, "  (got: ", param_name, ")"), context));
-      }
+    if (absl::StartsWithIgnoreCase(param_name, "disable")) {
+      violations_.insert(LintViolation(
+          *id, absl::StrCat(kMessage, "  (got: ", param_name, ")"), context));
     }
   }
 }
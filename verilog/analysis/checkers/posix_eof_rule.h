@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_POSIX_EOF_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_POSIX_EOF_RULE_H_
 
+#include <cstddef>
 #include <set>
 #include <string>
 
@@ -47,6 +48,8 @@ class PosixEOFRule : public verible::TextStructureLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   // Collection of found violations.
   std::set<verible::LintViolation> violations_;
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/proper_parameter_declaration_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -25,6 +26,7 @@
 #include "verilog/CST/context_functions.h"
 #include "verilog/CST/parameters.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 #include "verilog/parser/verilog_token_enum.h"
@@ -35,6 +37,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register ProperParameterDeclarationRule
@@ -65,26 +68,28 @@ static const Matcher &ParamDeclMatcher() {
 }
 
 // TODO(kathuriac): Also check the 'interface' and 'program' constructs.
-void ProperParameterDeclarationRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (ParamDeclMatcher().Matches(symbol, &manager)) {
-    const auto param_decl_token = GetParamKeyword(symbol);
-    if (param_decl_token == TK_parameter) {
-      // Check if the context is inside a class or module, and a
-      // kFormalParameterList.
-      if (ContextIsInsideClass(context) &&
-          !ContextIsInsideFormalParameterList(context)) {
-        violations_.insert(LintViolation(symbol, kParameterMessage, context));
-      } else if (ContextIsInsideModule(context) &&
-                 !ContextIsInsideFormalParameterList(context)) {
-        violations_.insert(LintViolation(symbol, kParameterMessage, context));
-      }
-    } else if (param_decl_token == TK_localparam) {
-      // If the context is not inside a class or module, report violation.
-      if (!ContextIsInsideClass(context) && !ContextIsInsideModule(context)) {
-        violations_.insert(LintViolation(symbol, kLocalParamMessage, context));
-      }
+std::vector<Matcher> ProperParameterDeclarationRule::SymbolMatchers() const {
+  return {ParamDeclMatcher()};
+}
+
+void ProperParameterDeclarationRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
+  const auto param_decl_token = GetParamKeyword(symbol);
+  if (param_decl_token == TK_parameter) {
+    // Check if the context is inside a class or module, and a
+    // kFormalParameterList.
+    if (ContextIsInsideClass(context) &&
+        !ContextIsInsideFormalParameterList(context)) {
+      violations_.insert(LintViolation(symbol, kParameterMessage, context));
+    } else if (ContextIsInsideModule(context) &&
+               !ContextIsInsideFormalParameterList(context)) {
+      violations_.insert(LintViolation(symbol, kParameterMessage, context));
+    }
+  } else if (param_decl_token == TK_localparam) {
+    // If the context is not inside a class or module, report violation.
+    if (!ContextIsInsideClass(context) && !ContextIsInsideModule(context)) {
+      violations_.insert(LintViolation(symbol, kLocalParamMessage, context));
     }
   }
 }
@@ -14,7 +14,9 @@
 
 #include "verilog/analysis/checkers/signal_name_style_rule.h"
 
+#include <cstddef>
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -31,6 +33,7 @@
 #include "verilog/CST/net.h"
 #include "verilog/CST/port.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -42,6 +45,7 @@ VERILOG_REGISTER_LINT_RULE(SignalNameStyleRule);
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 static constexpr absl::string_view kMessage =
@@ -74,17 +78,25 @@ static const Matcher &DataMatcher() {
   return matcher;
 }
 
-void SignalNameStyleRule::HandleSymbol(const verible::Symbol &symbol,
-                                       const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (PortMatcher().Matches(symbol, &manager)) {
+// Indices of the matchers in SymbolMatchers().
+enum { kPortMatcher, kNetMatcher, kDataMatcher };
+
+std::vector<Matcher> SignalNameStyleRule::SymbolMatchers() const {
+  return {PortMatcher(), NetMatcher(), DataMatcher()};
+}
+
+void SignalNameStyleRule::HandleMatch(size_t matcher_index,
+                                      const verible::Symbol &symbol,
+                                      const BoundSymbolManager &bound,
+                                      const SyntaxTreeContext &context) {
+  if (matcher_index == kPortMatcher) {
     const auto *identifier_leaf = GetIdentifierFromPortDeclaration(symbol);
     const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
     if (!verible::IsLowerSnakeCaseWithDigits(name)) {
       violations_.insert(
           LintViolation(identifier_leaf->get(), kMessage, context));
     }
-  } else if (NetMatcher().Matches(symbol, &manager)) {
+  } else if (matcher_index == kNetMatcher) {
     const auto identifier_leaves = GetIdentifiersFromNetDeclaration(symbol);
     for (const auto *leaf : identifier_leaves) {
       const auto name = leaf->text();
@@ -92,7 +104,7 @@ void SignalNameStyleRule::HandleSymbol(const verible::Symbol &symbol,
         violations_.insert(LintViolation(*leaf, kMessage, context));
       }
     }
-  } else if (DataMatcher().Matches(symbol, &manager)) {
+  } else if (matcher_index == kDataMatcher) {
     const auto identifier_leaves = GetIdentifiersFromDataDeclaration(symbol);
     for (const auto *leaf : identifier_leaves) {
       const auto name = leaf->text();
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -32,6 +33,7 @@
 #include "common/util/logging.h"
 #include "verilog/CST/type.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
@@ -42,6 +44,7 @@ VERILOG_REGISTER_LINT_RULE(StructUnionNameStyleRule);
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 static constexpr absl::string_view kMessageStruct = "Struct names";
@@ -66,57 +69,58 @@ static const Matcher& TypedefMatcher() {
   return matcher;
 }
 
-void StructUnionNameStyleRule::HandleSymbol(const verible::Symbol& symbol,
-                                            const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (TypedefMatcher().Matches(symbol, &manager)) {
-    // TODO: This can be changed to checking type of child (by index) when we
-    // have consistent shape for all kTypeDeclaration nodes.
-    const bool is_struct = !FindAllStructTypes(symbol).empty();
-    if (!is_struct && FindAllUnionTypes(symbol).empty()) return;
-    const absl::string_view msg = is_struct ? kMessageStruct : kMessageUnion;
+std::vector<Matcher> StructUnionNameStyleRule::SymbolMatchers() const {
+  return {TypedefMatcher()};
+}
 
-    const auto* identifier_leaf = GetIdentifierFromTypeDeclaration(symbol);
-    const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
+void StructUnionNameStyleRule::HandleMatch(size_t matcher_index,
+                                           const verible::Symbol& symbol,
+                                           const BoundSymbolManager& bound,
+                                           const SyntaxTreeContext& context) {
+  // TODO: This can be changed to checking type of child (by index) when we
+  // have consistent shape for all kTypeDeclaration nodes.
+  const bool is_struct = !FindAllStructTypes(symbol).empty();
+  if (!is_struct && FindAllUnionTypes(symbol).empty()) return;
+  const absl::string_view msg = is_struct ? kMessageStruct : kMessageUnion;
+
+  const auto* identifier_leaf = GetIdentifierFromTypeDeclaration(symbol);
+  const auto name = ABSL_DIE_IF_NULL(identifier_leaf)->get().text();
+
+  if (!absl::EndsWith(name, "_t")) {
+    violations_.insert(LintViolation(
+        *identifier_leaf, absl::StrCat(msg, " have to end with _t"), context));
+    return;
+  }
+  if (name[0] == '_') {
+    violations_.insert(LintViolation(
+        *identifier_leaf, absl::StrCat(msg, " can't start with _"), context));
+    return;
+  }
 
-    if (!absl::EndsWith(name, "_t")) {
-      violations_.insert(
-          LintViolation(*identifier_leaf,
-                        absl::StrCat(msg, " have to end with _t"), context));
-      return;
+  for (const auto& ns : absl::StrSplit(name, '_')) {
+    if (std::all_of(ns.begin(), ns.end(), [](char c) {
+          return absl::ascii_islower(c) || absl::ascii_isdigit(c);
+        })) {
+      continue;
     }
-    if (name[0] == '_') {
+    if (!absl::ascii_isdigit(*ns.begin())) {
       violations_.insert(LintViolation(
-          *identifier_leaf, absl::StrCat(msg, " can't start with _"), context));
+          *identifier_leaf,
+          "Section with unit names need to start with digit", context));
       return;
     }
-
-    for (const auto& ns : absl::StrSplit(name, '_')) {
-      if (std::all_of(ns.begin(), ns.end(), [](char c) {
-            return absl::ascii_islower(c) || absl::ascii_isdigit(c);
-          })) {
-        continue;
-      }
-      if (!absl::ascii_isdigit(*ns.begin())) {
-        violations_.insert(LintViolation(
-            *identifier_leaf,
-            "Section with unit names need to start with digit", context));
-        return;
-      }
-      if (exceptions_.find(std::string(ns)) != exceptions_.end()) {
-        continue;  // number + unit exception found
-      }
-      const auto& alpha =
-          std::find_if(ns.begin(), ns.end(), absl::ascii_isalpha);
-      const auto ns_substr = std::string(alpha, ns.end());
-      if (exceptions_.find(ns_substr) == exceptions_.end()) {
-        violations_.insert(
-            LintViolation(*identifier_leaf,
-                          "found digit followed by unit that is "
-                          "not configured as an allowed exception",
-                          context));
-        return;
-      }
+    if (exceptions_.find(std::string(ns)) != exceptions_.end()) {
+      continue;  // number + unit exception found
+    }
+    const auto& alpha = std::find_if(ns.begin(), ns.end(), absl::ascii_isalpha);
+    const auto ns_substr = std::string(alpha, ns.end());
+    if (exceptions_.find(ns_substr) == exceptions_.end()) {
+      violations_.insert(
+          LintViolation(*identifier_leaf,
+                        "found digit followed by unit that is "
+                        "not configured as an allowed exception",
+                        context));
+      return;
     }
   }
 }
@@ -15,6 +15,7 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_CHECKERS_SUGGEST_PARENTHESES_RULE_H_
 #define VERIBLE_VERILOG_ANALYSIS_CHECKERS_SUGGEST_PARENTHESES_RULE_H_
 
+#include <cstddef>
 #include <set>
 
 #include "common/analysis/syntax_tree_lint_rule.h"
@@ -39,6 +40,8 @@ class SuggestParenthesesRule : public verible::SyntaxTreeLintRule {
 
   verible::LintRuleStatus Report() const final;
 
+  size_t ViolationCount() const final { return violations_.size(); }
+
  private:
   std::set<verible::LintViolation> violations_;
 };
@@ -14,11 +14,14 @@
 
 #include "verilog/analysis/checkers/suspicious_semicolon_rule.h"
 
+#include <vector>
+
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/matcher/bound_symbol_manager.h"
 #include "common/analysis/matcher/matcher.h"
 #include "common/text/concrete_syntax_tree.h"
+#include "common/text/symbol.h"
 #include "common/text/syntax_tree_context.h"
 #include "common/text/tree_utils.h"
 #include "verilog/CST/verilog_matchers.h"
@@ -29,6 +32,7 @@
 namespace verilog {
 namespace analysis {
 
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(SuspiciousSemicolon);
@@ -51,12 +55,14 @@ static const Matcher &NullStatementMatcher() {
   return matcher;
 }
 
-void SuspiciousSemicolon::HandleNode(
-    const verible::SyntaxTreeNode &node,
-    const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (!NullStatementMatcher().Matches(node, &manager)) return;
+std::vector<Matcher> SuspiciousSemicolon::SymbolMatchers() const {
+  return {NullStatementMatcher()};
+}
 
+void SuspiciousSemicolon::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
   // Waive @(posedge clk);
   // But catch always_ff @(posedge clk);
   const bool parent_is_proc_timing_ctrl_statement =
@@ -75,9 +81,9 @@ void SuspiciousSemicolon::HandleNode(
   }
 
   violations_.insert(verible::LintViolation(
-      node, kMessage, context,
+      symbol, kMessage, context,
       {verible::AutoFix("Remove ';'",
-                        {verible::StringSpanOfSymbol(node), ""})}));
+                        {verible::StringSpanOfSymbol(symbol), ""})}));
 }
 
 verible::LintRuleStatus SuspiciousSemicolon::Report() const {
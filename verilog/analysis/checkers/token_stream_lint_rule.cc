@@ -34,6 +34,7 @@ namespace analysis {
 using verible::LintRuleStatus;
 using verible::LintViolation;
 using verible::SyntaxTreeContext;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register TokenStreamLintRule
@@ -60,12 +61,14 @@ static const Matcher &StringLiteralMatcher() {
   return matcher;
 }
 
-void TokenStreamLintRule::HandleSymbol(const verible::Symbol &symbol,
-                                       const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (!StringLiteralMatcher().Matches(symbol, &manager)) {
-    return;
-  }
+std::vector<Matcher> TokenStreamLintRule::SymbolMatchers() const {
+  return {StringLiteralMatcher()};
+}
+
+void TokenStreamLintRule::HandleMatch(size_t matcher_index,
+                                      const verible::Symbol &symbol,
+                                      const BoundSymbolManager &bound,
+                                      const SyntaxTreeContext &context) {
   const auto &string_node = SymbolCastToNode(symbol);
   const auto &node_children = string_node.children();
   const auto &literal = std::find_if(node_children.begin(), node_children.end(),
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/numeric/int128.h"
 #include "absl/strings/numbers.h"
@@ -34,6 +35,7 @@
 #include "common/text/token_info.h"
 #include "verilog/CST/numbers.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -46,6 +48,7 @@ using verible::LintViolation;
 using verible::SyntaxTreeContext;
 using verible::SyntaxTreeLeaf;
 using verible::SyntaxTreeNode;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(TruncatedNumericLiteralRule);
@@ -147,12 +150,15 @@ static size_t GetBitWidthOfNumber(const BasedNumber &n, bool *is_lower_bound) {
   return 0;  // not reached.
 }
 
-void TruncatedNumericLiteralRule::HandleSymbol(
-    const verible::Symbol &symbol, const SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (!NumberMatcher().Matches(symbol, &manager)) return;
-  const auto *width_leaf = manager.GetAs<SyntaxTreeLeaf>("width");
-  const auto *literal_node = manager.GetAs<SyntaxTreeNode>("literal");
+std::vector<Matcher> TruncatedNumericLiteralRule::SymbolMatchers() const {
+  return {NumberMatcher()};
+}
+
+void TruncatedNumericLiteralRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound, const SyntaxTreeContext &context) {
+  const auto *width_leaf = bound.GetAs<SyntaxTreeLeaf>("width");
+  const auto *literal_node = bound.GetAs<SyntaxTreeNode>("literal");
   if (!width_leaf || !literal_node) return;
 
   const auto width_text = width_leaf->get().text();
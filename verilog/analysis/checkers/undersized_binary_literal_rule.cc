@@ -34,6 +34,7 @@
 #include "common/util/logging.h"
 #include "verilog/CST/numbers.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -47,6 +48,7 @@ using verible::LintViolation;
 using verible::SyntaxTreeContext;
 using verible::SyntaxTreeLeaf;
 using verible::SyntaxTreeNode;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register UndersizedBinaryLiteralRule
@@ -84,12 +86,15 @@ static const Matcher& NumberMatcher() {
   return matcher;
 }
 
-void UndersizedBinaryLiteralRule::HandleSymbol(
-    const verible::Symbol& symbol, const SyntaxTreeContext& context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (!NumberMatcher().Matches(symbol, &manager)) return;
-  const auto* width_leaf = manager.GetAs<SyntaxTreeLeaf>("width");
-  const auto* literal_node = manager.GetAs<SyntaxTreeNode>("literal");
+std::vector<Matcher> UndersizedBinaryLiteralRule::SymbolMatchers() const {
+  return {NumberMatcher()};
+}
+
+void UndersizedBinaryLiteralRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol& symbol,
+    const BoundSymbolManager& bound, const SyntaxTreeContext& context) {
+  const auto* width_leaf = bound.GetAs<SyntaxTreeLeaf>("width");
+  const auto* literal_node = bound.GetAs<SyntaxTreeNode>("literal");
   if (!width_leaf || !literal_node) return;
 
   const auto width_text = width_leaf->get().text();
@@ -15,6 +15,7 @@
 #include "verilog/analysis/checkers/unpacked_dimensions_rule.h"
 
 #include <set>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -27,6 +28,7 @@
 #include "verilog/CST/dimensions.h"
 #include "verilog/CST/expression.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -35,6 +37,7 @@ namespace analysis {
 
 using verible::LintRuleStatus;
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 VERILOG_REGISTER_LINT_RULE(UnpackedDimensionsRule);
@@ -67,35 +70,39 @@ static const Matcher &DimensionRangeMatcher() {
   return matcher;
 }
 
-void UnpackedDimensionsRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
+std::vector<Matcher> UnpackedDimensionsRule::SymbolMatchers() const {
+  return {DimensionRangeMatcher()};
+}
+
+void UnpackedDimensionsRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
   if (!ContextIsInsideUnpackedDimensions(context) ||
       context.IsInside(NodeEnum::kGateInstance)) {
     return;
   }
-  verible::matcher::BoundSymbolManager manager;
-  if (DimensionRangeMatcher().Matches(symbol, &manager)) {
-    // Check whether or not bounds are numeric constants, including 0.
-    // If one can conclude that left > right, then record as violation.
-
-    const auto &left = *ABSL_DIE_IF_NULL(GetDimensionRangeLeftBound(symbol));
-    const auto &right = *ABSL_DIE_IF_NULL(GetDimensionRangeRightBound(symbol));
-    int left_value, right_value;
-    const bool left_is_constant = ConstantIntegerValue(left, &left_value);
-    const bool right_is_constant = ConstantIntegerValue(right, &right_value);
-    const bool left_is_zero = left_is_constant && (left_value == 0);
-    const bool right_is_zero = right_is_constant && (right_value == 0);
-
-    const verible::TokenInfo token(TK_OTHER,
-                                   verible::StringSpanOfSymbol(left, right));
-    if (left_is_zero) {
-      violations_.insert(LintViolation(token, kMessageScalarInOrder, context));
-    } else if (right_is_zero) {
-      violations_.insert(LintViolation(token, kMessageScalarReversed, context));
-    } else if (left_is_constant && right_is_constant &&
-               left_value > right_value) {
-      violations_.insert(LintViolation(token, kMessageReorder, context));
-    }
+
+  // Check whether or not bounds are numeric constants, including 0.
+  // If one can conclude that left > right, then record as violation.
+
+  const auto &left = *ABSL_DIE_IF_NULL(GetDimensionRangeLeftBound(symbol));
+  const auto &right = *ABSL_DIE_IF_NULL(GetDimensionRangeRightBound(symbol));
+  int left_value, right_value;
+  const bool left_is_constant = ConstantIntegerValue(left, &left_value);
+  const bool right_is_constant = ConstantIntegerValue(right, &right_value);
+  const bool left_is_zero = left_is_constant && (left_value == 0);
+  const bool right_is_zero = right_is_constant && (right_value == 0);
+
+  const verible::TokenInfo token(TK_OTHER,
+                                 verible::StringSpanOfSymbol(left, right));
+  if (left_is_zero) {
+    violations_.insert(LintViolation(token, kMessageScalarInOrder, context));
+  } else if (right_is_zero) {
+    violations_.insert(LintViolation(token, kMessageScalarReversed, context));
+  } else if (left_is_constant && right_is_constant &&
+             left_value > right_value) {
+    violations_.insert(LintViolation(token, kMessageReorder, context));
   }
 }
 
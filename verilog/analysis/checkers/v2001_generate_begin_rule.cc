@@ -16,6 +16,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -27,6 +28,7 @@
 #include "common/text/syntax_tree_context.h"
 #include "common/text/tree_utils.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -34,6 +36,7 @@ namespace verilog {
 namespace analysis {
 
 using verible::LintViolation;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register the lint rule
@@ -59,14 +62,17 @@ static const Matcher &GenerateRegionMatcher() {
   return matcher;
 }
 
-void V2001GenerateBeginRule::HandleSymbol(
-    const verible::Symbol &symbol, const verible::SyntaxTreeContext &context) {
-  verible::matcher::BoundSymbolManager manager;
-  if (GenerateRegionMatcher().Matches(symbol, &manager)) {
-    if (const auto *block = manager.GetAs<verible::SyntaxTreeNode>("block")) {
-      violations_.insert(LintViolation(verible::GetLeftmostLeaf(*block)->get(),
-                                       kMessage, context));
-    }
+std::vector<Matcher> V2001GenerateBeginRule::SymbolMatchers() const {
+  return {GenerateRegionMatcher()};
+}
+
+void V2001GenerateBeginRule::HandleMatch(
+    size_t matcher_index, const verible::Symbol &symbol,
+    const BoundSymbolManager &bound,
+    const verible::SyntaxTreeContext &context) {
+  if (const auto *block = bound.GetAs<verible::SyntaxTreeNode>("block")) {
+    violations_.insert(LintViolation(verible::GetLeftmostLeaf(*block)->get(),
+                                     kMessage, context));
   }
 }
 
@@ -14,8 +14,10 @@
 
 #include "verilog/analysis/checkers/void_cast_rule.h"
 
+#include <cstddef>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "common/analysis/lint_rule_status.h"
@@ -30,6 +32,7 @@
 #include "common/text/tree_utils.h"
 #include "common/util/logging.h"
 #include "verilog/CST/verilog_matchers.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/descriptions.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
@@ -41,6 +44,7 @@ using verible::LintViolation;
 using verible::SyntaxTreeContext;
 using verible::SyntaxTreeLeaf;
 using verible::SyntaxTreeNode;
+using verible::matcher::BoundSymbolManager;
 using verible::matcher::Matcher;
 
 // Register VoidCastRule
@@ -94,26 +98,30 @@ static const Matcher &RandomizeMatcher() {
   return matcher;
 }
 
-void VoidCastRule::HandleSymbol(const verible::Symbol &symbol,
-                                const SyntaxTreeContext &context) {
-  // Check for forbidden function names
-  verible::matcher::BoundSymbolManager manager;
-  if (FunctionMatcher().Matches(symbol, &manager)) {
-    if (const auto *function_id =
-            manager.GetAs<verible::SyntaxTreeLeaf>("id")) {
+// Indices of the matchers in SymbolMatchers().
+enum { kFunctionMatcher, kRandomizeMatcher };
+
+std::vector<Matcher> VoidCastRule::SymbolMatchers() const {
+  return {FunctionMatcher(), RandomizeMatcher()};
+}
+
+void VoidCastRule::HandleMatch(size_t matcher_index,
+                               const verible::Symbol &symbol,
+                               const BoundSymbolManager &bound,
+                               const SyntaxTreeContext &context) {
+  if (matcher_index == kFunctionMatcher) {
+    // Check for forbidden function names
+    if (const auto *function_id = bound.GetAs<verible::SyntaxTreeLeaf>("id")) {
       const auto &bfs = ForbiddenFunctionsSet();
       if (bfs.find(std::string(function_id->get().text())) != bfs.end()) {
         violations_.insert(LintViolation(function_id->get(),
                                          FormatReason(*function_id), context));
       }
     }
-  }
-
-  // Check for forbidden calls to randomize
-  manager.Clear();
-  if (RandomizeMatcher().Matches(symbol, &manager)) {
+  } else if (matcher_index == kRandomizeMatcher) {
+    // Check for forbidden calls to randomize
     if (const auto *randomize_node =
-            manager.GetAs<verible::SyntaxTreeNode>("id")) {
+            bound.GetAs<verible::SyntaxTreeNode>("id")) {
       const auto *leaf_ptr = verible::GetLeftmostLeaf(*randomize_node);
       const verible::TokenInfo token = ABSL_DIE_IF_NULL(leaf_ptr)->get();
       violations_.insert(LintViolation(
@@ -0,0 +1,300 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/analysis/lint_result_cache.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "common/analysis/lint_rule_status.h"
+#include "common/text/token_info.h"
+#include "common/util/file_util.h"
+#include "common/util/sha256.h"
+#include "common/util/status_macros.h"
+#include "verilog/analysis/descriptions.h"
+#include "verilog/analysis/lint_rule_registry.h"
+#include "verilog/analysis/verilog_linter_configuration.h"
+
+namespace verilog {
+
+using verible::AutoFix;
+using verible::LintRuleStatus;
+using verible::LintViolation;
+using verible::ReplacementEdit;
+using verible::TokenInfo;
+
+// Identifies the format of cache entries; change when it changes.
+static constexpr absl::string_view kEntryHeader = "verible-lint-result 1\n";
+
+namespace {
+
+// Serializes numbers and strings, such that they can be read back
+// unambiguously: numbers are followed by a space, strings are prefixed by
+// their length.
+class EntryWriter {
+ public:
+  void PutNumber(size_t n) { absl::StrAppend(&text_, n, " "); }
+
+  void PutString(absl::string_view s) {
+    absl::StrAppend(&text_, s.size(), ":", s);
+  }
+
+  // Writes the location of 'fragment' in 'contents'. Returns false if it is
+  // not within 'contents'.
+  bool PutFragment(absl::string_view fragment, absl::string_view contents) {
+    const std::less_equal<const char *> le;
+    if (!le(contents.begin(), fragment.begin()) ||
+        !le(fragment.end(), contents.end())) {
+      return false;
+    }
+    PutNumber(std::distance(contents.begin(), fragment.begin()));
+    PutNumber(fragment.size());
+    return true;
+  }
+
+  const std::string &text() const { return text_; }
+
+ private:
+  std::string text_;
+};
+
+// Reads what EntryWriter wrote. Every getter returns false on malformed
+// input.
+class EntryReader {
+ public:
+  explicit EntryReader(absl::string_view text) : text_(text) {}
+
+  bool GetNumber(size_t *n) {
+    const size_t end = text_.find(' ');
+    if (end == absl::string_view::npos) return false;
+    if (!absl::SimpleAtoi(text_.substr(0, end), n)) return false;
+    text_.remove_prefix(end + 1);
+    return true;
+  }
+
+  bool GetString(absl::string_view *s) {
+    const size_t colon = text_.find(':');
+    size_t size;
+    if (colon == absl::string_view::npos ||
+        !absl::SimpleAtoi(text_.substr(0, colon), &size) ||
+        size > text_.size() - colon - 1) {
+      return false;
+    }
+    *s = text_.substr(colon + 1, size);
+    text_.remove_prefix(colon + 1 + size);
+    return true;
+  }
+
+  // Reads a location written by PutFragment(), as a substring of 'contents'.
+  bool GetFragment(absl::string_view contents, absl::string_view *fragment) {
+    size_t offset, size;
+    if (!GetNumber(&offset) || !GetNumber(&size)) return false;
+    if (offset > contents.size() || size > contents.size() - offset) {
+      return false;
+    }
+    *fragment = contents.substr(offset, size);
+    return true;
+  }
+
+  bool AtEnd() const { return text_.empty(); }
+
+ private:
+  absl::string_view text_;
+};
+
+bool WriteStatuses(const std::vector<LintRuleStatus> &statuses,
+                   absl::string_view contents, EntryWriter *writer) {
+  writer->PutNumber(statuses.size());
+  for (const LintRuleStatus &status : statuses) {
+    writer->PutString(status.lint_rule_name);
+    writer->PutString(status.url);
+    writer->PutNumber(status.violations.size());
+    for (const LintViolation &violation : status.violations) {
+      writer->PutNumber(violation.token.token_enum());
+      if (!writer->PutFragment(violation.token.text(), contents)) return false;
+      writer->PutString(violation.reason);
+      writer->PutNumber(violation.autofixes.size());
+      for (const AutoFix &autofix : violation.autofixes) {
+        writer->PutString(autofix.Description());
+        writer->PutNumber(autofix.Edits().size());
+        for (const ReplacementEdit &edit : autofix.Edits()) {
+          if (!writer->PutFragment(edit.fragment, contents)) return false;
+          writer->PutString(edit.replacement);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool ReadStatuses(EntryReader *reader, absl::string_view contents,
+                  std::vector<LintRuleStatus> *statuses) {
+  // Rule names of the statuses must outlive them, so use the registered ones.
+  const std::set<analysis::LintRuleId> rule_names =
+      analysis::GetAllRegisteredLintRuleNames();
+  size_t num_statuses;
+  if (!reader->GetNumber(&num_statuses)) return false;
+  for (size_t i = 0; i < num_statuses; ++i) {
+    absl::string_view name, url;
+    size_t num_violations;
+    if (!reader->GetString(&name) || !reader->GetString(&url) ||
+        !reader->GetNumber(&num_violations)) {
+      return false;
+    }
+    const auto registered_name = rule_names.find(name);
+    if (registered_name == rule_names.end()) return false;
+
+    std::set<LintViolation> violations;
+    for (size_t j = 0; j < num_violations; ++j) {
+      size_t token_enum, num_autofixes;
+      absl::string_view token_text, reason;
+      if (!reader->GetNumber(&token_enum) ||
+          !reader->GetFragment(contents, &token_text) ||
+          !reader->GetString(&reason) || !reader->GetNumber(&num_autofixes)) {
+        return false;
+      }
+      std::vector<AutoFix> autofixes;
+      for (size_t k = 0; k < num_autofixes; ++k) {
+        absl::string_view description;
+        size_t num_edits;
+        if (!reader->GetString(&description) ||
+            !reader->GetNumber(&num_edits)) {
+          return false;
+        }
+        std::set<ReplacementEdit> edits;
+        for (size_t l = 0; l < num_edits; ++l) {
+          absl::string_view fragment, replacement;
+          if (!reader->GetFragment(contents, &fragment) ||
+              !reader->GetString(&replacement)) {
+            return false;
+          }
+          edits.emplace(fragment, std::string(replacement));
+        }
+        AutoFix autofix(description, {});
+        if (!autofix.AddEdits(edits)) return false;
+        autofixes.push_back(std::move(autofix));
+      }
+      violations.emplace(TokenInfo(static_cast<int>(token_enum), token_text),
+                         reason, autofixes);
+    }
+    statuses->emplace_back(violations, *registered_name, std::string(url));
+  }
+  return true;
+}
+
+}  // namespace
+
+LintResultCache::LintResultCache(absl::string_view directory,
+                                 absl::string_view version)
+    : directory_(directory), version_(version) {}
+
+std::string LintResultCache::Key(absl::string_view filename,
+                                 absl::string_view contents,
+                                 const LinterConfiguration &config) const {
+  // Length prefixes keep the parts from running into each other.
+  EntryWriter key;
+  key.PutString(kEntryHeader);
+  key.PutString(version_);
+  key.PutString(filename);
+  key.PutString(contents);
+  key.PutString(config.ActiveRuleBundle().UnparseConfiguration('\n'));
+  key.PutNumber(config.max_violations_per_file);
+  key.PutNumber(config.lines_to_lint.size());
+  for (const auto &lines : config.lines_to_lint) {
+    key.PutNumber(lines.first);
+    key.PutNumber(lines.second);
+  }
+  for (absl::string_view waiver_file :
+       absl::StrSplit(config.external_waivers, ',', absl::SkipEmpty())) {
+    key.PutString(waiver_file);
+    const auto waivers = ConfigFileCache::Global().GetContent(waiver_file);
+    if (waivers.ok()) {
+      key.PutNumber(1);
+      key.PutString(**waivers);
+    } else {
+      key.PutNumber(0);  // Unreadable files are ignored by the linter.
+    }
+  }
+  return verible::Sha256Hex(key.text());
+}
+
+std::string LintResultCache::EntryPath(absl::string_view key) const {
+  return verible::file::JoinPath(directory_, absl::StrCat(key, ".lint"));
+}
+
+absl::StatusOr<std::vector<LintRuleStatus>> LintResultCache::Lookup(
+    absl::string_view key, absl::string_view contents) const {
+  const std::string path = EntryPath(key);
+  absl::StatusOr<std::string> entry = verible::file::GetContentAsString(path);
+  if (!entry.ok()) {
+    return absl::NotFoundError(absl::StrCat("No lint result for ", key));
+  }
+
+  absl::string_view text = *entry;
+  std::vector<LintRuleStatus> statuses;
+  if (absl::ConsumePrefix(&text, kEntryHeader)) {
+    EntryReader reader(text);
+    if (ReadStatuses(&reader, contents, &statuses) && reader.AtEnd()) {
+      return statuses;
+    }
+  }
+  return absl::NotFoundError(absl::StrCat("Unusable lint result in ", path));
+}
+
+absl::Status LintResultCache::Store(
+    absl::string_view key, absl::string_view contents,
+    const std::vector<LintRuleStatus> &statuses) const {
+  EntryWriter writer;
+  if (!WriteStatuses(statuses, contents, &writer)) {
+    return absl::FailedPreconditionError(
+        "Lint findings are not located in the linted text.");
+  }
+  RETURN_IF_ERROR(verible::file::CreateDir(directory_));
+
+  // Write under a name no other writer uses, then move it into place
+  // atomically, so that readers never see a partial entry.
+  const std::string path = EntryPath(key);
+  const std::string temp_path = absl::StrCat(
+      path, ".", std::hash<std::thread::id>()(std::this_thread::get_id()),
+      "-", absl::ToUnixNanos(absl::Now()), ".tmp");
+  RETURN_IF_ERROR(verible::file::SetContents(
+      temp_path, absl::StrCat(kEntryHeader, writer.text())));
+  std::error_code error;
+  std::filesystem::rename(temp_path, path, error);
+  if (error) {
+    std::filesystem::remove(temp_path, error);
+    return absl::UnavailableError(
+        absl::StrCat("Can't store lint result in ", path));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace verilog
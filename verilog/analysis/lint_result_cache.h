@@ -0,0 +1,77 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_VERILOG_ANALYSIS_LINT_RESULT_CACHE_H_
+#define VERIBLE_VERILOG_ANALYSIS_LINT_RESULT_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "common/analysis/lint_rule_status.h"
+#include "verilog/analysis/verilog_linter_configuration.h"
+
+namespace verilog {
+
+// LintResultCache keeps the lint findings of files in a directory, so that
+// files that did not change don't need to be lexed, parsed and linted again,
+// e.g. in incremental CI runs.
+//
+// Entries are keyed by the SHA-256 of everything the findings depend on: the
+// file name and contents, the active rules with their configuration, the
+// violation limit, the lines to lint, the external waiver files and the
+// version of the linter.
+//
+// Lookups and stores may happen concurrently, from several threads or
+// processes: entries are written to a temporary file first, which is then
+// renamed into place.
+class LintResultCache {
+ public:
+  // 'directory' is created when the first entry is stored.
+  // 'version' identifies the linter build, so that findings of other
+  // versions, with possibly different rules, are not reused.
+  LintResultCache(absl::string_view directory, absl::string_view version);
+
+  const std::string& directory() const { return directory_; }
+
+  // Returns the key of linting 'contents' of 'filename' with 'config'.
+  std::string Key(absl::string_view filename, absl::string_view contents,
+                  const LinterConfiguration& config) const;
+
+  // Returns the findings stored under 'key'. Their locations point into
+  // 'contents', which must be the contents the key was made from, and must
+  // outlive the findings. Returns a NotFound error if there is no usable
+  // entry.
+  absl::StatusOr<std::vector<verible::LintRuleStatus>> Lookup(
+      absl::string_view key, absl::string_view contents) const;
+
+  // Stores 'statuses' under 'key'. Fails without storing anything if a
+  // finding does not point into 'contents', the text that was linted.
+  absl::Status Store(
+      absl::string_view key, absl::string_view contents,
+      const std::vector<verible::LintRuleStatus>& statuses) const;
+
+ private:
+  // Returns the path of the entry of 'key'.
+  std::string EntryPath(absl::string_view key) const;
+
+  const std::string directory_;
+  const std::string version_;
+};
+
+}  // namespace verilog
+
+#endif  // VERIBLE_VERILOG_ANALYSIS_LINT_RESULT_CACHE_H_
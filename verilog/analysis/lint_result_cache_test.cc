@@ -0,0 +1,189 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/analysis/lint_result_cache.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "common/analysis/line_lint_rule.h"
+#include "common/analysis/lint_rule_status.h"
+#include "common/text/token_info.h"
+#include "common/util/file_util.h"
+#include "gtest/gtest.h"
+#include "verilog/analysis/descriptions.h"
+#include "verilog/analysis/lint_rule_registry.h"
+#include "verilog/analysis/verilog_linter_configuration.h"
+
+namespace verilog {
+namespace {
+
+using verible::AutoFix;
+using verible::LintRuleStatus;
+using verible::LintViolation;
+using verible::ReplacementEdit;
+using verible::TokenInfo;
+
+// Fake rule, so that there is a registered rule name to cache findings of.
+class CacheTestRule : public verible::LineLintRule {
+ public:
+  using rule_type = verible::LineLintRule;
+  static const analysis::LintRuleDescriptor &GetDescriptor() {
+    static const analysis::LintRuleDescriptor d{
+        .name = "cache-test-rule",
+        .desc = "CacheTestRule",
+    };
+    return d;
+  }
+  void HandleLine(absl::string_view) final {}
+  LintRuleStatus Report() const final { return LintRuleStatus(); }
+};
+
+VERILOG_REGISTER_LINT_RULE(CacheTestRule);
+
+class LintResultCacheTest : public testing::Test {
+ protected:
+  LintResultCacheTest()
+      : directory_(verible::file::JoinPath(
+            testing::TempDir(),
+            verible::file::testing::RandomFileBasename("lint-result-cache"))),
+        cache_(directory_, "test-version") {
+    config_.TurnOn("cache-test-rule");
+  }
+
+  // Returns findings of the fake rule on 'contents'.
+  static std::vector<LintRuleStatus> MakeStatuses(absl::string_view contents) {
+    const TokenInfo tab(7, contents.substr(4, 1));
+    const TokenInfo name(9, contents.substr(6, 3));
+    const std::set<LintViolation> violations{
+        LintViolation(tab, "tab found",
+                      {AutoFix("Replace tab", {ReplacementEdit(tab, "  ")})}),
+        LintViolation(name, "bad name"),
+    };
+    return {LintRuleStatus(violations, CacheTestRule::GetDescriptor().name,
+                           "https://example.com/style#names")};
+  }
+
+  const std::string directory_;
+  const LintResultCache cache_;
+  LinterConfiguration config_;
+};
+
+TEST_F(LintResultCacheTest, MissWithoutEntry) {
+  const std::string key = cache_.Key("a.sv", "module m;", config_);
+  EXPECT_EQ(cache_.Lookup(key, "module m;").status().code(),
+            absl::StatusCode::kNotFound);
+}
+
+TEST_F(LintResultCacheTest, StoreAndLookup) {
+  const std::string original = "wire\t x_y;\n";
+  const std::string key = cache_.Key("a.sv", original, config_);
+  ASSERT_TRUE(cache_.Store(key, original, MakeStatuses(original)).ok());
+
+  // The findings point into the given copy of the contents.
+  const std::string contents = original;
+  const absl::StatusOr<std::vector<LintRuleStatus>> found =
+      cache_.Lookup(key, contents);
+  ASSERT_TRUE(found.ok()) << found.status();
+  ASSERT_EQ(found->size(), 1);
+  const LintRuleStatus &status = (*found)[0];
+  EXPECT_EQ(status.lint_rule_name, "cache-test-rule");
+  EXPECT_EQ(status.url, "https://example.com/style#names");
+  ASSERT_EQ(status.violations.size(), 2);
+
+  auto violation = status.violations.begin();
+  EXPECT_EQ(violation->token.token_enum(), 7);
+  EXPECT_EQ(violation->token.text().data(), contents.data() + 4);
+  EXPECT_EQ(violation->token.text(), "\t");
+  EXPECT_EQ(violation->reason, "tab found");
+  ASSERT_EQ(violation->autofixes.size(), 1);
+  EXPECT_EQ(violation->autofixes[0].Description(), "Replace tab");
+  EXPECT_EQ(violation->autofixes[0].Apply(contents), "wire   x_y;\n");
+
+  ++violation;
+  EXPECT_EQ(violation->token.token_enum(), 9);
+  EXPECT_EQ(violation->token.text().data(), contents.data() + 6);
+  EXPECT_EQ(violation->reason, "bad name");
+  EXPECT_TRUE(violation->autofixes.empty());
+}
+
+TEST_F(LintResultCacheTest, StoreNoFindings) {
+  const std::string key = cache_.Key("a.sv", "", config_);
+  ASSERT_TRUE(cache_.Store(key, "", {}).ok());
+  const auto found = cache_.Lookup(key, "");
+  ASSERT_TRUE(found.ok()) << found.status();
+  EXPECT_TRUE(found->empty());
+}
+
+TEST_F(LintResultCacheTest, KeyDependsOnInputs) {
+  const std::string key = cache_.Key("a.sv", "module m;", config_);
+  EXPECT_EQ(key, cache_.Key("a.sv", "module m;", config_));
+  EXPECT_NE(key, cache_.Key("b.sv", "module m;", config_));
+  EXPECT_NE(key, cache_.Key("a.sv", "module n;", config_));
+
+  LinterConfiguration other_config;
+  EXPECT_NE(key, cache_.Key("a.sv", "module m;", other_config));
+
+  const LintResultCache other_version(directory_, "other-version");
+  EXPECT_NE(key, other_version.Key("a.sv", "module m;", config_));
+
+  LinterConfiguration with_limit = config_;
+  with_limit.max_violations_per_file = 10;
+  EXPECT_NE(key, cache_.Key("a.sv", "module m;", with_limit));
+
+  LinterConfiguration with_lines = config_;
+  with_lines.lines_to_lint.Add({3, 5});
+  EXPECT_NE(key, cache_.Key("a.sv", "module m;", with_lines));
+
+  LinterConfiguration with_waivers = config_;
+  with_waivers.external_waivers =
+      verible::file::JoinPath(testing::TempDir(), "no-such-waiver-file");
+  EXPECT_NE(key, cache_.Key("a.sv", "module m;", with_waivers));
+}
+
+TEST_F(LintResultCacheTest, RejectsFindingsOutsideContents) {
+  const std::string contents = "wire\t x_y;\n";
+  const std::string elsewhere = contents;
+  const std::string key = cache_.Key("a.sv", contents, config_);
+  EXPECT_FALSE(cache_.Store(key, contents, MakeStatuses(elsewhere)).ok());
+  EXPECT_FALSE(cache_.Lookup(key, contents).ok());
+}
+
+TEST_F(LintResultCacheTest, RejectsCorruptEntries) {
+  const std::string contents = "wire\t x_y;\n";
+  const std::string key = cache_.Key("a.sv", contents, config_);
+  ASSERT_TRUE(cache_.Store(key, contents, MakeStatuses(contents)).ok());
+  const std::string path =
+      verible::file::JoinPath(directory_, absl::StrCat(key, ".lint"));
+  const auto entry = verible::file::GetContentAsString(path);
+  ASSERT_TRUE(entry.ok());
+
+  // Truncated.
+  ASSERT_TRUE(verible::file::SetContents(
+                  path, entry->substr(0, entry->size() / 2))
+                  .ok());
+  EXPECT_FALSE(cache_.Lookup(key, contents).ok());
+
+  // Findings beyond the end of the contents.
+  ASSERT_TRUE(verible::file::SetContents(path, *entry).ok());
+  EXPECT_FALSE(cache_.Lookup(key, "wire").ok());
+}
+
+}  // namespace
+}  // namespace verilog
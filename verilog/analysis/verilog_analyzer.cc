@@ -17,28 +17,42 @@
 
 #include "verilog/analysis/verilog_analyzer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "common/analysis/file_analyzer.h"
 #include "common/lexer/token_stream_adapter.h"
 #include "common/strings/comment_utils.h"
+#include "common/strings/mem_block.h"
 #include "common/text/concrete_syntax_leaf.h"
 #include "common/text/concrete_syntax_tree.h"
 #include "common/text/symbol.h"
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
 #include "common/text/token_stream_view.h"
+#include "common/text/tree_utils.h"
 #include "common/text/visitors.h"
 #include "common/util/container_util.h"
 #include "common/util/logging.h"
 #include "common/util/status_macros.h"
+#include "common/util/thread_pool.h"
+#include "verilog/CST/verilog_nonterminals.h"
 #include "verilog/analysis/verilog_excerpt_parse.h"
+#include "verilog/analysis/verilog_lexed_text.h"
 #include "verilog/parser/verilog_lexer.h"
 #include "verilog/parser/verilog_lexical_context.h"
 #include "verilog/parser/verilog_parser.h"
@@ -54,9 +68,14 @@ using verible::container::InsertKeyOrDie;
 
 absl::Status VerilogAnalyzer::Tokenize() {
   if (!tokenized_) {
-    VerilogLexer lexer{Data().Contents()};
     tokenized_ = true;
-    lex_status_ = FileAnalyzer::Tokenize(&lexer);
+    if (lexed_) {
+      lex_status_ = FileAnalyzer::Tokenize(lexed_->tokens(), lexed_->status());
+      lexed_.reset();  // Not needed anymore, we have our own copy now.
+    } else {
+      VerilogLexer lexer{Data().Contents()};
+      lex_status_ = FileAnalyzer::Tokenize(&lexer);
+    }
   }
   return lex_status_;
 }
@@ -127,9 +146,24 @@ static absl::string_view FailingTokenKeywordToParsingMode(
 std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticMode(
     const std::shared_ptr<verible::MemBlock>& text, absl::string_view name,
     const VerilogPreprocess::Config& preprocess_config) {
+  return AnalyzeAutomaticModeWith(
+      std::make_unique<VerilogAnalyzer>(text, name, preprocess_config), name,
+      preprocess_config);
+}
+
+std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticMode(
+    const std::shared_ptr<const VerilogLexedText>& lexed,
+    absl::string_view name,
+    const VerilogPreprocess::Config& preprocess_config) {
+  return AnalyzeAutomaticModeWith(
+      std::make_unique<VerilogAnalyzer>(lexed, name, preprocess_config), name,
+      preprocess_config);
+}
+
+std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticModeWith(
+    std::unique_ptr<VerilogAnalyzer> analyzer, absl::string_view name,
+    const VerilogPreprocess::Config& preprocess_config) {
   VLOG(2) << __FUNCTION__;
-  auto analyzer =
-      std::make_unique<VerilogAnalyzer>(text, name, preprocess_config);
   if (analyzer == nullptr) return analyzer;
   const absl::string_view text_base = analyzer->Data().Contents();
   // If there is any lexical error, stop right away.
@@ -142,8 +176,8 @@ std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticMode(
     // Slightly inefficient to lex text all over again, but this is
     // acceptable for an exceptional code path (also see: #1519)
     VLOG(1) << "Analyzing using parse mode directive: " << parse_mode;
-    auto mode_analyzer = AnalyzeVerilogWithMode(text->AsStringView(), name,
-                                                parse_mode, preprocess_config);
+    auto mode_analyzer = AnalyzeVerilogWithMode(text_base, name, parse_mode,
+                                                preprocess_config);
     if (mode_analyzer != nullptr) return mode_analyzer;
     // Silently ignore any unknown parsing modes.
   }
@@ -165,7 +199,7 @@ std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticMode(
       VLOG(1) << "Retrying parsing in mode: \"" << retry_parse_mode << "\".";
       if (!retry_parse_mode.empty()) {
         auto retry_analyzer = AnalyzeVerilogWithMode(
-            text->AsStringView(), name, retry_parse_mode, preprocess_config);
+            text_base, name, retry_parse_mode, preprocess_config);
         const absl::string_view retry_text_base =
             retry_analyzer->Data().Contents();
         VLOG(1) << "Retrying to parse:\n" << retry_text_base;
@@ -206,29 +240,326 @@ std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::AnalyzeAutomaticMode(
                               name, preprocess_config);
 }
 
+// Preprocessing configurations attempted by
+// AnalyzeAutomaticPreprocessFallback(), in order of preference.
+static constexpr VerilogPreprocess::Config kPreprocessFallbackConfigs[] = {
+    {.filter_branches = false, .expand_macros = false},
+    {.filter_branches = true, .expand_macros = false},
+    {.filter_branches = false, .expand_macros = true},
+    {.filter_branches = true, .expand_macros = true},
+};
+static constexpr size_t kNumPreprocessFallbacks =
+    sizeof(kPreprocessFallbackConfigs) / sizeof(kPreprocessFallbackConfigs[0]);
+
+static bool IsAcceptableFallback(const VerilogAnalyzer* analyzer) {
+  return analyzer && analyzer->LexStatus().ok() && analyzer->ParseStatus().ok();
+}
+
+// Analyzes the first preprocess variant, and only if it is not acceptable, all
+// fallback variants concurrently. Returns the first acceptable one in order of
+// preference; if there is none, the last one.
+static std::unique_ptr<VerilogAnalyzer> AnalyzeSpeculativePreprocessFallback(
+    const std::shared_ptr<const VerilogLexedText>& lexed,
+    absl::string_view name) {
+  // Variants might still be running after we return, so they share
+  // ownership of everything they need.
+  struct SpeculationState {
+    std::shared_ptr<const VerilogLexedText> lexed;
+    std::string name;
+    // Index of the best acceptable variant found so far. Variants with a
+    // higher index are not needed anymore.
+    std::atomic<size_t> best_accepted{kNumPreprocessFallbacks};
+  };
+  auto state = std::make_shared<SpeculationState>();
+  state->lexed = lexed;
+  state->name = std::string(name);
+
+  const auto analyze_variant =
+      [state](size_t variant) -> std::unique_ptr<VerilogAnalyzer> {
+    if (state->best_accepted.load() < variant) return nullptr;  // cancelled
+    auto analyzer = VerilogAnalyzer::AnalyzeAutomaticMode(
+        state->lexed, state->name, kPreprocessFallbackConfigs[variant]);
+    if (IsAcceptableFallback(analyzer.get())) {
+      size_t best = state->best_accepted.load();
+      while (variant < best &&
+             !state->best_accepted.compare_exchange_weak(best, variant)) {
+      }
+    }
+    return analyzer;
+  };
+
+  // The first variant is acceptable for most files; only speculate on the
+  // fallbacks once it is not.
+  std::unique_ptr<VerilogAnalyzer> analyzer = analyze_variant(0);
+  if (IsAcceptableFallback(analyzer.get())) return analyzer;
+
+  // The next variant is analyzed in the calling thread, the others in a
+  // pool. The pool is shared by all callers and never destroyed, so that
+  // no-longer needed variants can finish without blocking anyone.
+  static verible::ThreadPool* const pool =
+      new verible::ThreadPool(kNumPreprocessFallbacks - 2);
+  std::vector<std::future<std::unique_ptr<VerilogAnalyzer>>> fallbacks;
+  for (size_t variant = 2; variant < kNumPreprocessFallbacks; ++variant) {
+    fallbacks.push_back(pool->ExecAsync<std::unique_ptr<VerilogAnalyzer>>(
+        [analyze_variant, variant]() { return analyze_variant(variant); }));
+  }
+
+  VLOG(1) << "Using speculative preprocess fallbacks";
+  analyzer = analyze_variant(1);
+  for (auto& fallback : fallbacks) {
+    if (IsAcceptableFallback(analyzer.get())) break;
+    VLOG(1) << "Using next speculative preprocess fallback";
+    analyzer = fallback.get();
+  }
+  return analyzer;
+}
+
 std::unique_ptr<VerilogAnalyzer>
 VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(absl::string_view text,
-                                                    absl::string_view name) {
+                                                    absl::string_view name,
+                                                    bool speculative) {
+  // All variants start out with the same tokens; only lex once.
+  return AnalyzeAutomaticPreprocessFallback(VerilogLexedText::Lex(text), name,
+                                            speculative);
+}
+
+std::unique_ptr<VerilogAnalyzer>
+VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
+    const std::shared_ptr<const VerilogLexedText>& lexed,
+    absl::string_view name, bool speculative) {
+  if (speculative) return AnalyzeSpeculativePreprocessFallback(lexed, name);
+
   std::unique_ptr<verilog::VerilogAnalyzer> parser;
-  for (bool preprocess_expand_macros : {false, true}) {
-    bool expand_macro_status = false;
-    for (bool preprocess_filter_branches : {false, true}) {
-      parser = verilog::VerilogAnalyzer::AnalyzeAutomaticMode(
-          text, name,
-          {.filter_branches = preprocess_filter_branches,
-           .expand_macros = preprocess_expand_macros});
-      if (parser && parser->LexStatus().ok() && parser->ParseStatus().ok()) {
-        expand_macro_status = true;
-        break;
-      }
-      VLOG(1) << "Retry parsing with filter branches enabled";
-    }
-    if (expand_macro_status) break;
-    VLOG(1) << "Retry parsing with macro expanding enabled";
+  for (const VerilogPreprocess::Config& config : kPreprocessFallbackConfigs) {
+    parser =
+        verilog::VerilogAnalyzer::AnalyzeAutomaticMode(lexed, name, config);
+    if (IsAcceptableFallback(parser.get())) break;
+    VLOG(1) << "Retry parsing with next preprocess fallback";
   }
   return parser;
 }
 
+// Returns "token" with its text moved from "old_base" to "new_base", in which
+// the text after "old_edit_end" is shifted by "shift" bytes.
+static TokenInfo RebaseAroundEdit(const TokenInfo& token,
+                                  absl::string_view old_base,
+                                  absl::string_view new_base,
+                                  size_t old_edit_end, int64_t shift) {
+  const size_t left = token.left(old_base);
+  const size_t new_left = left < old_edit_end ? left : left + shift;
+  return TokenInfo(token.token_enum(),
+                   new_base.substr(new_left, token.text().length()));
+}
+
+// Returns a copy of the syntax tree "symbol" with all leaves rebased with
+// RebaseAroundEdit().
+static verible::SymbolPtr CopyRebasedTree(const verible::Symbol* symbol,
+                                          absl::string_view old_base,
+                                          absl::string_view new_base,
+                                          size_t old_edit_end, int64_t shift) {
+  if (symbol == nullptr) return nullptr;
+  if (symbol->Kind() == verible::SymbolKind::kLeaf) {
+    return std::make_unique<verible::SyntaxTreeLeaf>(
+        RebaseAroundEdit(verible::SymbolCastToLeaf(*symbol).get(), old_base,
+                         new_base, old_edit_end, shift));
+  }
+  const verible::SyntaxTreeNode& node = verible::SymbolCastToNode(*symbol);
+  auto copy = std::make_unique<verible::SyntaxTreeNode>(node.Tag().tag);
+  for (const verible::SymbolPtr& child : node.children()) {
+    copy->AppendChild(
+        CopyRebasedTree(child.get(), old_base, new_base, old_edit_end, shift));
+  }
+  return copy;
+}
+
+// Returns the node if "symbol" is a description list, nullptr otherwise.
+static const verible::SyntaxTreeNode* AsDescriptionList(
+    const verible::Symbol* symbol) {
+  if (symbol == nullptr || symbol->Kind() != verible::SymbolKind::kNode) {
+    return nullptr;
+  }
+  const verible::SyntaxTreeNode& node = verible::SymbolCastToNode(*symbol);
+  return node.MatchesTag(NodeEnum::kDescriptionList) ? &node : nullptr;
+}
+
+std::unique_ptr<VerilogAnalyzer> VerilogAnalyzer::ReparseIncrementally(
+    const VerilogAnalyzer& previous,
+    const std::shared_ptr<const VerilogLexedText>& lexed,
+    absl::string_view name, size_t unchanged_prefix, size_t unchanged_suffix) {
+  const verible::TextStructureView& previous_data = previous.Data();
+  const absl::string_view old_text = previous_data.Contents();
+  const absl::string_view new_text = lexed->Contents();
+  const VerilogPreprocess::Config& config = previous.preprocess_config_;
+  // Preprocessing or a parse mode directive can make the meaning of a
+  // construct depend on the rest of the file; as does `begin_keywords.
+  if (!lexed->status().ok() || !previous.LexStatus().ok() ||
+      !previous.ParseStatus().ok() || config.filter_branches ||
+      config.include_files || config.expand_macros ||
+      !ScanParsingModeDirective(previous_data.TokenStream()).empty() ||
+      absl::StrContains(new_text, "`begin_keywords")) {
+    return nullptr;
+  }
+  const size_t unchanged = unchanged_prefix + unchanged_suffix;
+  if (unchanged > old_text.length() || unchanged > new_text.length()) {
+    return nullptr;
+  }
+  const verible::SyntaxTreeNode* descriptions =
+      AsDescriptionList(previous_data.SyntaxTree().get());
+  if (descriptions == nullptr) return nullptr;
+
+  // Find the top-level construct that starts before the changed region.
+  const size_t old_edit_end = old_text.length() - unchanged_suffix;
+  size_t item_index = descriptions->size();
+  absl::string_view item_span;
+  for (size_t i = 0; i < descriptions->size(); ++i) {
+    if ((*descriptions)[i] == nullptr) continue;
+    const absl::string_view span =
+        verible::StringSpanOfSymbol(*(*descriptions)[i]);
+    if (span.empty()) continue;
+    if (static_cast<size_t>(span.begin() - old_text.begin()) >=
+        unchanged_prefix) {
+      break;
+    }
+    item_index = i;
+    item_span = span;
+  }
+  if (item_index == descriptions->size()) return nullptr;
+
+  // The changed region has to be strictly inside of that construct, and the
+  // construct surrounded by whitespace, so that no token can join or extend
+  // across its boundaries.
+  const size_t item_left = item_span.begin() - old_text.begin();
+  const size_t item_right = item_left + item_span.length();
+  if (item_right <= old_edit_end) return nullptr;
+  if (item_left > 0 && !absl::ascii_isspace(old_text[item_left - 1])) {
+    return nullptr;
+  }
+  if (item_right < old_text.length() && old_text[item_right] != '\n' &&
+      old_text[item_right] != '\r') {
+    return nullptr;
+  }
+  const int64_t shift = static_cast<int64_t>(new_text.length()) -
+                        static_cast<int64_t>(old_text.length());
+  const size_t new_item_right = item_right + shift;
+  const absl::string_view new_item_text =
+      new_text.substr(item_left, new_item_right - item_left);
+
+  // The already lexed tokens of the changed construct; a token extending
+  // beyond it, e.g. an unterminated comment, has changed the rest of the file.
+  const TokenSequence& new_tokens = lexed->tokens();
+  const auto new_token_starting_at = [&](size_t offset) {
+    return std::partition_point(new_tokens.begin(), new_tokens.end(),
+                                [&](const TokenInfo& token) {
+                                  return static_cast<size_t>(token.left(
+                                             new_text)) < offset;
+                                });
+  };
+  const auto new_item_begin = new_token_starting_at(item_left);
+  const auto new_item_end = new_token_starting_at(new_item_right);
+  if (new_item_begin == new_item_end ||
+      static_cast<size_t>(new_item_begin->left(new_text)) != item_left ||
+      static_cast<size_t>(std::prev(new_item_end)->right(new_text)) !=
+          new_item_right) {
+    return nullptr;
+  }
+
+  // Re-parse the changed construct on its own. It has to stay a single
+  // construct; if it has been split, merged or broken, give up.
+  auto item_analyzer =
+      std::make_unique<VerilogAnalyzer>(new_item_text, name, config);
+  const absl::string_view item_contents = item_analyzer->Data().Contents();
+  TokenSequence item_tokens(new_item_begin, new_item_end);
+  for (TokenInfo& token : item_tokens) {
+    token.RebaseStringView(item_contents.substr(
+        token.left(new_text) - item_left, token.text().length()));
+  }
+  item_tokens.push_back(TokenInfo::EOFToken(item_contents));
+  item_analyzer->tokenized_ = true;
+  item_analyzer->lex_status_ = item_analyzer->FileAnalyzer::Tokenize(
+      std::move(item_tokens), absl::OkStatus());
+  if (!item_analyzer->Analyze().ok()) return nullptr;
+  verible::SymbolPtr& item_tree =
+      item_analyzer->MutableData().MutableSyntaxTree();
+  const verible::SyntaxTreeNode* item_list = AsDescriptionList(item_tree.get());
+  if (item_list == nullptr || item_list->size() != 1 ||
+      item_list->front() == nullptr) {
+    return nullptr;
+  }
+  verible::SymbolPtr item =
+      std::move(verible::SymbolCastToNode(*item_tree).front());
+  item_tree = std::move(item);
+  // The end-of-file token is not spliced into the result.
+  verible::TokenStreamView& item_view =
+      item_analyzer->MutableData().MutableTokenStreamView();
+  if (!item_view.empty() && item_view.back()->isEOF()) item_view.pop_back();
+
+  // Everything outside of the construct: the previous tokens and syntax
+  // tree, rebased to the new text, with a placeholder for the construct.
+  const TokenSequence& old_tokens = previous_data.TokenStream();
+  const auto token_starting_at = [&](size_t offset) {
+    return std::partition_point(old_tokens.begin(), old_tokens.end(),
+                                [&](const TokenInfo& token) {
+                                  return static_cast<size_t>(token.left(
+                                             old_text)) < offset;
+                                });
+  };
+  const auto item_begin = token_starting_at(item_left);
+  const auto item_end = token_starting_at(item_right);
+  TokenSequence tokens;
+  tokens.reserve(old_tokens.size() - (item_end - item_begin) + 1);
+  for (auto it = old_tokens.begin(); it != item_begin; ++it) {
+    tokens.push_back(
+        RebaseAroundEdit(*it, old_text, new_text, old_edit_end, shift));
+  }
+  const TokenInfo placeholder(TK_OTHER, new_item_text);
+  tokens.push_back(placeholder);
+  for (auto it = item_end; it != old_tokens.end(); ++it) {
+    tokens.push_back(
+        RebaseAroundEdit(*it, old_text, new_text, old_edit_end, shift));
+  }
+
+  auto analyzer =
+      std::make_unique<VerilogAnalyzer>(lexed->text(), name, config);
+  analyzer->tokenized_ = true;
+  analyzer->lex_status_ =
+      analyzer->FileAnalyzer::Tokenize(std::move(tokens), absl::OkStatus());
+  analyzer->FilterTokensForSyntaxTree();
+
+  auto root = std::make_unique<verible::SyntaxTreeNode>(
+      descriptions->Tag().tag);
+  for (size_t i = 0; i < descriptions->size(); ++i) {
+    if (i == item_index) {
+      root->AppendChild(std::make_unique<verible::SyntaxTreeLeaf>(placeholder));
+    } else {
+      root->AppendChild(CopyRebasedTree((*descriptions)[i].get(), old_text,
+                                        new_text, old_edit_end, shift));
+    }
+  }
+  verible::SymbolPtr* const expansion_point = &(*root)[item_index];
+  analyzer->MutableData().MutableSyntaxTree() = std::move(root);
+
+  // Splice the re-parsed construct into the placeholder.
+  analyzer->max_used_stack_size_ = std::max(
+      previous.max_used_stack_size_, item_analyzer->max_used_stack_size_);
+  verible::TextStructureView::NodeExpansionMap expansions;
+  verible::TextStructureView::DeferredExpansion& expansion =
+      expansions[item_left];
+  expansion.expansion_point = expansion_point;
+  expansion.subanalysis = item_analyzer->ReleaseTextStructure();
+  analyzer->MutableData().ExpandSubtrees(&expansions);
+
+  // The preprocessor data covers the whole file.
+  verible::InitTokenStreamView(
+      analyzer->Data().TokenStream(),
+      &analyzer->MutableData().MutableTokenStreamView());
+  analyzer->FilterTokensForSyntaxTree();
+  if (!analyzer->Preprocess().ok()) return nullptr;
+  analyzer->parse_status_ = absl::OkStatus();
+  VLOG(1) << "Incrementally re-parsed " << new_item_text.length() << " of "
+          << new_text.length() << " bytes.";
+  return analyzer;
+}
+
 void VerilogAnalyzer::FilterTokensForSyntaxTree() {
   MutableData().FilterTokens(&VerilogLexer::KeepSyntaxTreeTokens);
 }
@@ -238,6 +569,39 @@ void VerilogAnalyzer::ContextualizeTokens() {
   context.TransformVerilogSymbols(MutableData().MakeTokenStreamReferenceView());
 }
 
+absl::Status VerilogAnalyzer::Preprocess() {
+  VerilogPreprocess preprocessor(preprocess_config_);
+  preprocessor_data_ = preprocessor.ScanStream(Data().GetTokenStreamView());
+  if (!preprocessor_data_.errors.empty()) {
+    for (const auto& error : preprocessor_data_.errors) {
+      rejected_tokens_.push_back(verible::RejectedToken{
+          error.token_info, verible::AnalysisPhase::kPreprocessPhase,
+          error.error_message});
+    }
+    parse_status_ = absl::InvalidArgumentError("Preprocessor error.");
+    return parse_status_;
+  }
+
+  for (const auto& warning : preprocessor_data_.warnings) {
+    const verible::RejectedToken warn_token{
+        warning.token_info, verible::AnalysisPhase::kPreprocessPhase,
+        warning.error_message, verible::ErrorSeverity::kWarning};
+    if (preprocess_config_.filter_branches) {
+      // Only if we properly filter out branches, warning about double
+      // defined macros make sense. So in this case, include them in the
+      // rejected tokens output.
+      rejected_tokens_.push_back(warn_token);
+    } else {
+      // Otherwise, merely make this a log message.
+      LOG(INFO) << LinterTokenErrorMessage(warn_token, false);
+    }
+  }
+  MutableData().MutableTokenStreamView() =
+      preprocessor_data_.preprocessed_token_stream;  // copy
+  // TODO(fangism): could we just move, swap, or directly reference?
+  return absl::OkStatus();
+}
+
 // Analyzes Verilog code: lexer, filter, parser.
 // Result of parsing is stored in syntax_tree_ (if passed)
 // or rejected_token_ (if failed).
@@ -253,37 +617,7 @@ absl::Status VerilogAnalyzer::Analyze() {
 
   // pseudo-preprocess token stream.
   //   Not all analyses will want to preprocess.
-  {
-    VerilogPreprocess preprocessor(preprocess_config_);
-    preprocessor_data_ = preprocessor.ScanStream(Data().GetTokenStreamView());
-    if (!preprocessor_data_.errors.empty()) {
-      for (const auto& error : preprocessor_data_.errors) {
-        rejected_tokens_.push_back(verible::RejectedToken{
-            error.token_info, verible::AnalysisPhase::kPreprocessPhase,
-            error.error_message});
-      }
-      parse_status_ = absl::InvalidArgumentError("Preprocessor error.");
-      return parse_status_;
-    }
-
-    for (const auto& warning : preprocessor_data_.warnings) {
-      const verible::RejectedToken warn_token{
-          warning.token_info, verible::AnalysisPhase::kPreprocessPhase,
-          warning.error_message, verible::ErrorSeverity::kWarning};
-      if (preprocess_config_.filter_branches) {
-        // Only if we properly filter out branches, warning about double
-        // defined macros make sense. So in this case, include them in the
-        // rejected tokens output.
-        rejected_tokens_.push_back(warn_token);
-      } else {
-        // Otherwise, merely make this a log message.
-        LOG(INFO) << LinterTokenErrorMessage(warn_token, false);
-      }
-    }
-    MutableData().MutableTokenStreamView() =
-        preprocessor_data_.preprocessed_token_stream;  // copy
-    // TODO(fangism): could we just move, swap, or directly reference?
-  }
+  RETURN_IF_ERROR(Preprocess());
 
   auto generator = MakeTokenViewer(Data().GetTokenStreamView());
   VerilogParser parser(&generator, filename_);
@@ -26,6 +26,7 @@
 #include "common/analysis/file_analyzer.h"
 #include "common/strings/mem_block.h"
 #include "common/text/token_stream_view.h"
+#include "verilog/analysis/verilog_lexed_text.h"
 #include "verilog/preprocessor/verilog_preprocess.h"
 
 namespace verilog {
@@ -39,6 +40,15 @@ class VerilogAnalyzer : public verible::FileAnalyzer {
       : verible::FileAnalyzer(std::move(text), name),
         preprocess_config_(preprocess_config) {}
 
+  // Analyzer of text that has already been lexed, e.g. incrementally.
+  // Tokenize() takes the tokens from "lexed" instead of running the lexer.
+  VerilogAnalyzer(std::shared_ptr<const VerilogLexedText> lexed,
+                  absl::string_view name,
+                  const VerilogPreprocess::Config &preprocess_config)
+      : verible::FileAnalyzer(lexed->text(), name),
+        preprocess_config_(preprocess_config),
+        lexed_(std::move(lexed)) {}
+
   // Legacy constructor.
   VerilogAnalyzer(absl::string_view text, absl::string_view name,
                   const VerilogPreprocess::Config &preprocess_config)
@@ -81,12 +91,48 @@ class VerilogAnalyzer : public verible::FileAnalyzer {
       absl::string_view text, absl::string_view name,
       const VerilogPreprocess::Config &preprocess_config);
 
+  static std::unique_ptr<VerilogAnalyzer> AnalyzeAutomaticMode(
+      const std::shared_ptr<const VerilogLexedText> &lexed,
+      absl::string_view name,
+      const VerilogPreprocess::Config &preprocess_config);
+
   // Automatically analyze with correct parsing mode like AnalyzeAutomaticMode()
   // but attempt first with preprocessor disabled to get as complete as
   // possible parse tree; if this yields to syntax errors, fall back to
   // enabling preprocess branches.
+  //
+  // If "speculative" is true and the first variant is not acceptable, the
+  // fallback variants are analyzed concurrently instead of one after another.
+  // The result is the same as in the sequential case, but the latency for
+  // files that need a fallback is that of the first variant plus the slowest
+  // fallback needed, instead of the sum of all of them. Files that need no
+  // fallback cost no extra work. Variants that can't be chosen anymore are
+  // cancelled if they have not started yet.
   static std::unique_ptr<VerilogAnalyzer> AnalyzeAutomaticPreprocessFallback(
-      absl::string_view text, absl::string_view name);
+      absl::string_view text, absl::string_view name,
+      bool speculative = false);
+
+  // Same, for text that has already been lexed, e.g. incrementally with
+  // VerilogLexedText::Relex().
+  static std::unique_ptr<VerilogAnalyzer> AnalyzeAutomaticPreprocessFallback(
+      const std::shared_ptr<const VerilogLexedText> &lexed,
+      absl::string_view name, bool speculative = false);
+
+  // Analyze the "lexed" text, which is the text of the successfully analyzed
+  // "previous" with a changed region: the first "unchanged_prefix" and the
+  // last "unchanged_suffix" bytes of both texts are the same.
+  // If the change is inside of a single top-level construct (module, class,
+  // package, function...), only that construct is re-parsed from its tokens
+  // in "lexed" and spliced into a copy of the previous syntax tree, so the
+  // parse time does not depend on the size of the file. Typically, "lexed"
+  // comes from VerilogLexedText::Relex(), so lexing doesn't either.
+  // Returns nullptr if the change can't be handled that way, e.g. because it
+  // spans multiple constructs or the previous analysis used preprocessing; the
+  // caller is then expected to fall back to a full analysis.
+  static std::unique_ptr<VerilogAnalyzer> ReparseIncrementally(
+      const VerilogAnalyzer &previous,
+      const std::shared_ptr<const VerilogLexedText> &lexed,
+      absl::string_view name, size_t unchanged_prefix, size_t unchanged_suffix);
 
   const VerilogPreprocessData &PreprocessorData() const {
     return preprocessor_data_;
@@ -111,11 +157,21 @@ class VerilogAnalyzer : public verible::FileAnalyzer {
   static constexpr absl::string_view kParseDirectiveName = "verilog_syntax:";
 
  private:
+  // Implementation of AnalyzeAutomaticMode() with the given, not yet
+  // tokenized "analyzer".
+  static std::unique_ptr<VerilogAnalyzer> AnalyzeAutomaticModeWith(
+      std::unique_ptr<VerilogAnalyzer> analyzer, absl::string_view name,
+      const VerilogPreprocess::Config &preprocess_config);
+
   // Attempt to parse all macro arguments as expressions.  Where parsing as an
   // expession succeeds, substitute the leaf with a node with the expression's
   // syntax tree.  If parsing fails, leave the MacroArg token unexpanded.
   void ExpandMacroCallArgExpressions();
 
+  // Run the preprocessor on the filtered token stream view and replace the
+  // view with the preprocessed one. Sets parse_status_ on error.
+  absl::Status Preprocess();
+
   // Information about parser internals.
 
   // True if input text has already been lexed.
@@ -128,6 +184,9 @@ class VerilogAnalyzer : public verible::FileAnalyzer {
   const VerilogPreprocess::Config preprocess_config_;
   VerilogPreprocessData preprocessor_data_;
 
+  // If set, tokens to use instead of lexing; released after Tokenize().
+  std::shared_ptr<const VerilogLexedText> lexed_;
+
   // Status of lexing.
   absl::Status lex_status_;
 
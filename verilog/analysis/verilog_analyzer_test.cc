@@ -14,6 +14,8 @@
 
 #include "verilog/analysis/verilog_analyzer.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -22,6 +24,7 @@
 #include "absl/base/casts.h"
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "common/analysis/file_analyzer.h"
@@ -34,12 +37,14 @@
 #include "common/text/token_info.h"
 #include "common/text/token_info_test_util.h"
 #include "common/text/token_stream_view.h"
+#include "common/text/tree_compare.h"
 #include "common/text/tree_utils.h"
 #include "common/util/casts.h"
 #include "common/util/logging.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "verilog/analysis/verilog_excerpt_parse.h"
+#include "verilog/analysis/verilog_lexed_text.h"
 #include "verilog/parser/verilog_token_enum.h"
 
 #undef EXPECT_OK
@@ -545,6 +550,43 @@ endmodule
   }
 }
 
+TEST(AnalyzeVerilogAutomaticMode, SpeculativeFallbackSameAsSequential) {
+  constexpr absl::string_view test_cases[] = {
+      // Succeeds right away.
+      "module foo;\nendmodule\n",
+      // Needs branch filtering.
+      R"(
+module foo();
+  always @(*) begin
+    if (a) bar();
+`ifdef SOME_MACRO
+    else if (b) baz();
+`endif
+    else qux();
+  end
+endmodule
+)",
+      // Fails in every variant.
+      "module foo(;\nendmodule\n",
+  };
+  for (const absl::string_view code : test_cases) {
+    const auto sequential =
+        VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(code, "<file>");
+    const auto speculative =
+        VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(code, "<file>",
+                                                            true);
+    ASSERT_NE(speculative, nullptr);
+    EXPECT_EQ(speculative->LexStatus().ok(), sequential->LexStatus().ok());
+    EXPECT_EQ(speculative->ParseStatus().ok(), sequential->ParseStatus().ok())
+        << "code was:\n"
+        << code;
+    EXPECT_EQ(speculative->Data().TokenStream().size(),
+              sequential->Data().TokenStream().size());
+    EXPECT_EQ(speculative->GetRejectedTokens().size(),
+              sequential->GetRejectedTokens().size());
+  }
+}
+
 // Tests that automatic mode parsing can detect that some first failing
 // keywords will trigger (successful) re-parsing as a library map.
 TEST(AnalyzeVerilogAutomaticMode, InferredLibraryMapMode) {
@@ -852,6 +894,141 @@ TEST(VerilogAnalyzerExpandsMacroArgsTest, MultipleMacroCalls) {
   }
 }
 
+// Edit "before" by replacing "length" bytes at "pos" with "replacement" and
+// re-parse it incrementally. If that succeeds, expect the same result as
+// from a full analysis.
+std::unique_ptr<VerilogAnalyzer> ReparseEdited(absl::string_view before,
+                                               size_t pos, size_t length,
+                                               absl::string_view replacement) {
+  const auto previous = VerilogAnalyzer::AnalyzeAutomaticMode(
+      before, "<file>", kDefaultPreprocess);
+  EXPECT_OK(previous->ParseStatus());
+  const std::string after = absl::StrCat(before.substr(0, pos), replacement,
+                                         before.substr(pos + length));
+  const size_t unchanged_suffix = before.length() - pos - length;
+  const auto lexed = VerilogLexedText::Relex(*VerilogLexedText::Lex(before),
+                                             after, pos, unchanged_suffix);
+  auto reparsed = VerilogAnalyzer::ReparseIncrementally(
+      *previous, lexed, "<file>", pos, unchanged_suffix);
+  if (reparsed == nullptr) return reparsed;
+
+  const auto full = VerilogAnalyzer::AnalyzeAutomaticMode(after, "<file>",
+                                                         kDefaultPreprocess);
+  EXPECT_OK(full->ParseStatus());
+  EXPECT_OK(reparsed->ParseStatus());
+  EXPECT_OK(reparsed->Data().InternalConsistencyCheck());
+  const absl::string_view full_base = full->Data().Contents();
+  const absl::string_view reparsed_base = reparsed->Data().Contents();
+  const auto same_token = [&](const TokenInfo& full_token,
+                              const TokenInfo& reparsed_token) {
+    return full_token.token_enum() == reparsed_token.token_enum() &&
+           full_token.left(full_base) == reparsed_token.left(reparsed_base) &&
+           full_token.text() == reparsed_token.text();
+  };
+  EXPECT_TRUE(verible::EqualTrees(full->SyntaxTree().get(),
+                                  reparsed->SyntaxTree().get(), same_token))
+      << "code was:\n"
+      << after;
+  const auto& full_tokens = full->Data().TokenStream();
+  const auto& reparsed_tokens = reparsed->Data().TokenStream();
+  EXPECT_EQ(full_tokens.size(), reparsed_tokens.size());
+  for (size_t i = 0; i < std::min(full_tokens.size(), reparsed_tokens.size());
+       ++i) {
+    EXPECT_TRUE(same_token(full_tokens[i], reparsed_tokens[i]))
+        << "token #" << i;
+  }
+  EXPECT_EQ(full->Data().GetTokenStreamView().size(),
+            reparsed->Data().GetTokenStreamView().size());
+  return reparsed;
+}
+
+constexpr absl::string_view kIncrementalSample =
+    "// header\n"
+    "package p;\n"
+    "  localparam int N = 4;\n"
+    "endpackage\n"
+    "\n"
+    "module m(input wire clk);\n"
+    "  wire [p::N-1:0] w;\n"
+    "  always @(posedge clk) w <= `INC(w);\n"
+    "endmodule\n"
+    "\n"
+    "class c;\n"
+    "  function int f();\n"
+    "    return 1;\n"
+    "  endfunction\n"
+    "endclass\n"
+    "\n"
+    "function automatic int g();\n"
+    "  return 2;\n"
+    "endfunction\n";
+
+TEST(ReparseIncrementallyTest, EditInsideConstruct) {
+  struct Edit {
+    absl::string_view anchor;  // replaced text, must be unique.
+    absl::string_view replacement;
+  };
+  constexpr Edit kEdits[] = {
+      {"N = 4", "N = 42"},
+      {"wire [p::N-1:0] w;", "wire [p::N-1:0] w, v;\n  assign v = w;"},
+      {"`INC(w)", "`INC(w + 1)"},  // Macro arguments are expanded.
+      {"return 1;", "return 1 + 2;"},
+      {"return 2;", ""},
+      {"m(input", "m2(input"},
+      {"endfunction\nendclass", "endfunction : f\nendclass"},
+  };
+  for (const Edit& edit : kEdits) {
+    const size_t pos = kIncrementalSample.find(edit.anchor);
+    ASSERT_NE(pos, absl::string_view::npos) << edit.anchor;
+    EXPECT_NE(ReparseEdited(kIncrementalSample, pos, edit.anchor.length(),
+                            edit.replacement),
+              nullptr)
+        << "replacing " << edit.anchor;
+  }
+}
+
+TEST(ReparseIncrementallyTest, NotPossible) {
+  struct Edit {
+    absl::string_view anchor;
+    absl::string_view replacement;
+  };
+  constexpr Edit kEdits[] = {
+      // Spans multiple constructs.
+      {"endpackage\n\nmodule", "endpackage\nmodule"},
+      // Outside of any construct.
+      {"// header", "// new header"},
+      // Starts a new construct.
+      {"  return 2;", "endfunction\nfunction void h();"},
+      // Syntax error.
+      {"return 1;", "return 1"},
+      // Comment not terminated within the construct.
+      {"return 1;", "/* return 1;"},
+  };
+  for (const Edit& edit : kEdits) {
+    const size_t pos = kIncrementalSample.find(edit.anchor);
+    ASSERT_NE(pos, absl::string_view::npos) << edit.anchor;
+    EXPECT_EQ(ReparseEdited(kIncrementalSample, pos, edit.anchor.length(),
+                            edit.replacement),
+              nullptr)
+        << "replacing " << edit.anchor;
+  }
+}
+
+TEST(ReparseIncrementallyTest, NotAfterPreprocessing) {
+  const auto previous = VerilogAnalyzer::AnalyzeAutomaticMode(
+      kIncrementalSample, "<file>",
+      VerilogPreprocess::Config{.filter_branches = true});
+  ASSERT_OK(previous->ParseStatus());
+  const size_t pos = kIncrementalSample.find("return 1");
+  const std::string after = absl::StrCat(kIncrementalSample.substr(0, pos),
+                                         "return 3",
+                                         kIncrementalSample.substr(pos + 8));
+  EXPECT_EQ(VerilogAnalyzer::ReparseIncrementally(
+                *previous, VerilogLexedText::Lex(after), "<file>", pos,
+                kIncrementalSample.length() - pos - 8),
+            nullptr);
+}
+
 // Helper class for testing internals.
 class VerilogAnalyzerInternalsTest : public testing::Test,
                                      public VerilogAnalyzer {
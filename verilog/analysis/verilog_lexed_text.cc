@@ -0,0 +1,166 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/analysis/verilog_lexed_text.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "common/strings/mem_block.h"
+#include "common/text/token_info.h"
+#include "common/util/logging.h"
+#include "verilog/parser/verilog_lexer.h"
+#include "verilog/parser/verilog_token_enum.h"
+
+namespace verilog {
+
+using verible::TokenInfo;
+using verible::TokenSequence;
+
+// Returns the index of the first token that starts at or after "offset".
+static size_t FirstTokenStartingAt(const TokenSequence &tokens,
+                                   absl::string_view base, size_t offset) {
+  return std::partition_point(tokens.begin(), tokens.end(),
+                              [base, offset](const TokenInfo &t) {
+                                return static_cast<size_t>(t.left(base)) <
+                                       offset;
+                              }) -
+         tokens.begin();
+}
+
+// Returns "token" pointing to the same text at "new_left" in "new_base".
+static TokenInfo RebaseToken(const TokenInfo &token, absl::string_view new_base,
+                             size_t new_left) {
+  return TokenInfo(token.token_enum(),
+                   new_base.substr(new_left, token.text().length()));
+}
+
+VerilogLexedText::VerilogLexedText(absl::string_view text)
+    : text_(std::make_shared<verible::StringMemBlock>(text)) {}
+
+std::shared_ptr<const VerilogLexedText> VerilogLexedText::Lex(
+    absl::string_view text) {
+  std::shared_ptr<VerilogLexedText> result(new VerilogLexedText(text));
+  result->LexFrom(0, nullptr, 0, 0);
+  return result;
+}
+
+std::shared_ptr<const VerilogLexedText> VerilogLexedText::Relex(
+    const VerilogLexedText &previous, absl::string_view new_text,
+    size_t unchanged_prefix, size_t unchanged_suffix) {
+  const absl::string_view previous_text = previous.Contents();
+  const size_t unchanged = unchanged_prefix + unchanged_suffix;
+  if (!previous.status_.ok() || unchanged > previous_text.length() ||
+      unchanged > new_text.length()) {
+    return Lex(new_text);
+  }
+
+  // Restart at the beginning of the last line that starts before the edit
+  // (strictly before: its newline token could grow, e.g. "\r" + "\n"), and
+  // at which the lexer was in its initial state.
+  const TokenSequence &previous_tokens = previous.tokens_;
+  size_t restart = FirstTokenStartingAt(previous_tokens, previous_text,
+                                        unchanged_prefix);
+  while (restart > 0 &&
+         !(previous.initial_state_before_[restart] &&
+           previous_tokens[restart - 1].token_enum() == TK_NEWLINE &&
+           static_cast<size_t>(previous_tokens[restart].left(previous_text)) <
+               unchanged_prefix)) {
+    --restart;
+  }
+
+  std::shared_ptr<VerilogLexedText> result(new VerilogLexedText(new_text));
+  const absl::string_view base = result->Contents();
+  result->tokens_.reserve(previous_tokens.size());
+  result->initial_state_before_.reserve(previous_tokens.size());
+  for (size_t i = 0; i < restart; ++i) {
+    const TokenInfo &token = previous_tokens[i];
+    result->tokens_.push_back(
+        RebaseToken(token, base, token.left(previous_text)));
+    result->initial_state_before_.push_back(previous.initial_state_before_[i]);
+  }
+  result->LexFrom(restart, &previous, previous_text.length() - unchanged_suffix,
+                  new_text.length() - unchanged_suffix);
+  VLOG(2) << "Relexed " << result->lexed_token_count_ << " of "
+          << result->tokens_.size() << " tokens.";
+  return result;
+}
+
+void VerilogLexedText::LexFrom(size_t restart_index,
+                               const VerilogLexedText *previous,
+                               size_t previous_edit_end, size_t new_edit_end) {
+  const absl::string_view text = Contents();
+  const size_t restart_offset =
+      restart_index == 0 ? 0 : tokens_.back().right(text);
+
+  const absl::string_view previous_text =
+      previous ? previous->Contents() : absl::string_view();
+  size_t previous_index =
+      previous ? FirstTokenStartingAt(previous->tokens_, previous_text,
+                                      previous_edit_end)
+               : 0;
+
+  VerilogLexer lexer(text.substr(restart_offset));
+  bool initial_state = true;
+  for (;;) {
+    const TokenInfo &token = lexer.DoNextToken();
+    tokens_.push_back(token);
+    initial_state_before_.push_back(initial_state);
+    ++lexed_token_count_;
+    if (lexer.TokenIsError(token)) {
+      status_ = absl::InvalidArgumentError("Lexical error.");
+      return;
+    }
+    if (token.isEOF()) {
+      // Same as MakeTokenSequence(): EOF points to the end of the text.
+      tokens_.back() = TokenInfo::EOFToken(text);
+      return;
+    }
+
+    initial_state = lexer.InInitialState();
+    if (previous == nullptr || !initial_state) continue;
+    const size_t offset = token.right(text);
+    if (offset < new_edit_end) continue;
+
+    // Past the edit, the texts are the same. If the previous lexer was in
+    // the same state at the same position, it produced the same tokens.
+    const size_t previous_offset = offset - new_edit_end + previous_edit_end;
+    const TokenSequence &previous_tokens = previous->tokens_;
+    while (previous_index < previous_tokens.size() &&
+           static_cast<size_t>(
+               previous_tokens[previous_index].left(previous_text)) <
+               previous_offset) {
+      ++previous_index;
+    }
+    if (previous_index >= previous_tokens.size() ||
+        static_cast<size_t>(previous_tokens[previous_index].left(
+            previous_text)) != previous_offset ||
+        !previous->initial_state_before_[previous_index]) {
+      continue;
+    }
+    for (size_t i = previous_index; i < previous_tokens.size(); ++i) {
+      const TokenInfo &reused = previous_tokens[i];
+      tokens_.push_back(RebaseToken(
+          reused, text,
+          reused.left(previous_text) - previous_edit_end + new_edit_end));
+      initial_state_before_.push_back(previous->initial_state_before_[i]);
+    }
+    return;
+  }
+}
+
+}  // namespace verilog
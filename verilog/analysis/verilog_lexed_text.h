@@ -0,0 +1,91 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_VERILOG_ANALYSIS_VERILOG_LEXED_TEXT_H_
+#define VERIBLE_VERILOG_ANALYSIS_VERILOG_LEXED_TEXT_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "common/strings/mem_block.h"
+#include "common/text/token_stream_view.h"
+
+namespace verilog {
+
+// VerilogLexedText is the raw lexer output of a text -- before any
+// contextualization by the analyzer -- together with the token boundaries at
+// which the lexer was in its initial state.
+//
+// This allows lexing a new version of the text incrementally: tokens before
+// the edited region are kept, lexing restarts at the beginning of a line
+// before the edit and stops as soon as the lexer is back in sync with the
+// previous token stream after the edit. The remaining tokens are reused with
+// their text rebased to the new content.
+class VerilogLexedText {
+ public:
+  // Lex "text" from scratch.
+  static std::shared_ptr<const VerilogLexedText> Lex(absl::string_view text);
+
+  // Lex "new_text", which is the text of "previous" with a changed region:
+  // the first "unchanged_prefix" and last "unchanged_suffix" bytes of both
+  // texts are the same.
+  // Falls back to lexing from scratch if the range is inconsistent with the
+  // texts or the previous text had a lexical error.
+  static std::shared_ptr<const VerilogLexedText> Relex(
+      const VerilogLexedText &previous, absl::string_view new_text,
+      size_t unchanged_prefix, size_t unchanged_suffix);
+
+  // The text owning the memory the tokens point into.
+  const std::shared_ptr<verible::MemBlock> &text() const { return text_; }
+  absl::string_view Contents() const { return text_->AsStringView(); }
+
+  // Tokens as returned by the lexer. Ends with an EOF token, unless there
+  // was a lexical error; then the last token is the offending one.
+  const verible::TokenSequence &tokens() const { return tokens_; }
+
+  // Status of lexing; not ok if there was a lexical error.
+  const absl::Status &status() const { return status_; }
+
+  // Number of tokens that have been produced by running the lexer, the
+  // others have been reused from a previous version.
+  size_t lexed_token_count() const { return lexed_token_count_; }
+
+ private:
+  explicit VerilogLexedText(absl::string_view text);
+
+  // Run lexer starting at token index "restart_index" with the tokens before
+  // already in place. Stops at the end of the text, at the first error or
+  // as soon as the stream is in sync again with "previous" (if given), which
+  // has been changed in the region "new_edit_end" (in this text) and
+  // "previous_edit_end".
+  void LexFrom(size_t restart_index, const VerilogLexedText *previous,
+               size_t previous_edit_end, size_t new_edit_end);
+
+  std::shared_ptr<verible::MemBlock> text_;
+  verible::TokenSequence tokens_;
+
+  // One element per token: true if the lexer was in its initial state before
+  // lexing that token.
+  std::vector<bool> initial_state_before_;
+
+  absl::Status status_;
+  size_t lexed_token_count_ = 0;
+};
+
+}  // namespace verilog
+
+#endif  // VERIBLE_VERILOG_ANALYSIS_VERILOG_LEXED_TEXT_H_
@@ -0,0 +1,133 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/analysis/verilog_lexed_text.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "common/text/token_info.h"
+#include "gtest/gtest.h"
+
+namespace verilog {
+namespace {
+
+// Relexing must result in exactly the same tokens as lexing from scratch.
+void ExpectSameAsFreshLex(const VerilogLexedText &relexed) {
+  const auto fresh = VerilogLexedText::Lex(relexed.Contents());
+  EXPECT_EQ(relexed.status().ok(), fresh->status().ok());
+  ASSERT_EQ(relexed.tokens().size(), fresh->tokens().size());
+  const absl::string_view relexed_base = relexed.Contents();
+  const absl::string_view fresh_base = fresh->Contents();
+  for (size_t i = 0; i < fresh->tokens().size(); ++i) {
+    const verible::TokenInfo &expected = fresh->tokens()[i];
+    const verible::TokenInfo &token = relexed.tokens()[i];
+    EXPECT_EQ(token.token_enum(), expected.token_enum()) << "token #" << i;
+    EXPECT_EQ(token.left(relexed_base), expected.left(fresh_base))
+        << "token #" << i;
+    EXPECT_EQ(token.text(), expected.text()) << "token #" << i;
+  }
+}
+
+// Replace "length" bytes at "pos" in "before" with "replacement", relex
+// incrementally and compare with lexing from scratch.
+std::shared_ptr<const VerilogLexedText> EditAndCheck(
+    absl::string_view before, size_t pos, size_t length,
+    absl::string_view replacement) {
+  const auto previous = VerilogLexedText::Lex(before);
+  const std::string after = absl::StrCat(before.substr(0, pos), replacement,
+                                         before.substr(pos + length));
+  const auto relexed = VerilogLexedText::Relex(
+      *previous, after, pos, before.length() - pos - length);
+  ExpectSameAsFreshLex(*relexed);
+  return relexed;
+}
+
+constexpr absl::string_view kSample =
+    "// header comment\n"
+    "`define FOO(a, b) \\\n"
+    "  (a + b)\n"
+    "module m(input wire clk);\n"
+    "  /* block\n"
+    "     comment */\n"
+    "  string s = \"a string\";\n"
+    "  initial $display(`FOO(1,\n"
+    "                    2));\n"
+    "  always @(posedge clk) begin\n"
+    "    x <= 8'hff;\n"
+    "  end\n"
+    "endmodule\n";
+
+TEST(VerilogLexedTextTest, LexEndsWithEOF) {
+  const auto lexed = VerilogLexedText::Lex(kSample);
+  EXPECT_TRUE(lexed->status().ok());
+  ASSERT_FALSE(lexed->tokens().empty());
+  EXPECT_TRUE(lexed->tokens().back().isEOF());
+  EXPECT_EQ(lexed->lexed_token_count(), lexed->tokens().size());
+}
+
+TEST(VerilogLexedTextTest, RelexNoChange) {
+  EditAndCheck(kSample, 0, 0, "");
+  EditAndCheck(kSample, kSample.length(), 0, "");
+}
+
+TEST(VerilogLexedTextTest, RelexEditsEverywhere) {
+  // Insert, delete and replace at every position; some of these edits
+  // open or close comments, strings, macro calls etc.
+  for (const absl::string_view replacement :
+       {"", "x", " ", "\n", "/*", "*/", "\"", "`FOO(", ")", "\\\n"}) {
+    for (size_t pos = 0; pos <= kSample.length(); ++pos) {
+      EditAndCheck(kSample, pos, 0, replacement);
+      if (pos < kSample.length()) EditAndCheck(kSample, pos, 1, replacement);
+    }
+  }
+}
+
+TEST(VerilogLexedTextTest, RelexOnlyAroundEdit) {
+  std::string text;
+  for (int i = 0; i < 1000; ++i) {
+    absl::StrAppend(&text, "module m", i, "; wire w", i, "; endmodule\n");
+  }
+  const size_t pos = text.length() / 2;
+  const auto relexed = EditAndCheck(text, pos, 0, "x");
+  EXPECT_LT(relexed->lexed_token_count(), 50u);
+  EXPECT_GT(relexed->tokens().size(), 10000u);
+}
+
+TEST(VerilogLexedTextTest, RelexInconsistentRangeLexesFromScratch) {
+  const auto previous = VerilogLexedText::Lex(kSample);
+  const auto relexed = VerilogLexedText::Relex(*previous, "module foo;",
+                                               kSample.length(), 0);
+  ExpectSameAsFreshLex(*relexed);
+  EXPECT_EQ(relexed->lexed_token_count(), relexed->tokens().size());
+}
+
+TEST(VerilogLexedTextTest, RelexLexicalError) {
+  // Backtick followed by space is a lexical error.
+  const auto relexed = EditAndCheck(kSample, 0, 0, "` ");
+  EXPECT_FALSE(relexed->status().ok());
+
+  // ... and fixing it again.
+  const auto previous = VerilogLexedText::Lex(absl::StrCat("` ", kSample));
+  const auto fixed =
+      VerilogLexedText::Relex(*previous, kSample, 0, kSample.length());
+  EXPECT_TRUE(fixed->status().ok());
+  ExpectSameAsFreshLex(*fixed);
+}
+
+}  // namespace
+}  // namespace verilog
@@ -14,9 +14,11 @@
 
 #include "verilog/analysis/verilog_linter.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <iomanip>
 #include <ios>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -32,6 +34,8 @@
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_lint_rule.h"
 #include "common/analysis/line_linter.h"
+#include "common/analysis/line_scanner.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/lint_waiver.h"
 #include "common/analysis/syntax_tree_lint_rule.h"
@@ -42,10 +46,15 @@
 #include "common/analysis/token_stream_linter.h"
 #include "common/strings/line_column_map.h"
 #include "common/text/concrete_syntax_tree.h"
+#include "common/strings/position.h"
+#include "common/text/symbol.h"
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
+#include "common/text/token_stream_view.h"
+#include "common/text/tree_utils.h"
 #include "common/util/file_util.h"
 #include "common/util/logging.h"
+#include "common/util/range.h"
 #include "common/util/status_macros.h"
 #include "verilog/analysis/default_rules.h"
 #include "verilog/analysis/lint_rule_registry.h"
@@ -72,27 +81,50 @@ ABSL_FLAG(verilog::RuleSet, ruleset, verilog::RuleSet::kDefault,
 ABSL_FLAG(std::string, waiver_files, "",
           "Path to waiver config files (comma-separated). "
           "Please refer to the README file for information about its format.");
+ABSL_FLAG(int, max_violations_per_file, 0,
+          "Stop linting a file once this many violations are found, and "
+          "report at most that many; 0 means no limit.");
 
 namespace verilog {
 
 using verible::LineColumnMap;
+using verible::LintProfile;
 using verible::LintRuleStatus;
 using verible::LintViolationWithStatus;
 using verible::LintWaiver;
 using verible::TextStructureView;
+using verible::LintTiming;
 using verible::TokenInfo;
 
+// Names of the phases in lint profiles.
+static constexpr absl::string_view kCachePhase = "lint-result-cache";
+static constexpr absl::string_view kParsePhase = "lex-and-parse";
+static constexpr absl::string_view kWaiverPhase = "waivers";
+static constexpr absl::string_view kTextStructurePhase = "text-structure";
+static constexpr absl::string_view kLinePhase = "line";
+static constexpr absl::string_view kTokenPhase = "token";
+// Line and token rules run in a single pass.
+static constexpr absl::string_view kLineAndTokenPhase = "line-and-token";
+static constexpr absl::string_view kSyntaxTreePhase = "syntax-tree";
+
+// With a violation limit, violations are counted after this many lines or
+// syntax tree symbols.
+static constexpr size_t kLinesPerViolationCount = 256;
+static constexpr int kSymbolsPerViolationCount = 1024;
+
 std::set<LintViolationWithStatus> GetSortedViolations(
     const std::vector<LintRuleStatus>& statuses) {
-  std::set<LintViolationWithStatus> violations;
-
+  // Building the set from a sorted range takes linear time, which is cheaper
+  // than inserting many violations one by one. The stable sort keeps the
+  // first of several violations at the same location, like insertion does.
+  std::vector<LintViolationWithStatus> sorted;
   for (const auto& status : statuses) {
     for (const auto& violation : status.violations) {
-      violations.insert(LintViolationWithStatus(&violation, &status));
+      sorted.emplace_back(&violation, &status);
     }
   }
-
-  return violations;
+  std::stable_sort(sorted.begin(), sorted.end());
+  return std::set<LintViolationWithStatus>(sorted.begin(), sorted.end());
 }
 
 // Return code useful to be used in main:
@@ -103,12 +135,56 @@ int LintOneFile(std::ostream* stream, absl::string_view filename,
                 const LinterConfiguration& config,
                 verible::ViolationHandler* violation_handler, bool check_syntax,
                 bool parse_fatal, bool lint_fatal, bool show_context) {
-  const absl::StatusOr<std::string> content_or =
+  const LintFileResult result =
+      AnalyzeAndLintFile(filename, config, check_syntax, parse_fatal);
+  return ReportLintFileResult(stream, filename, result, violation_handler,
+                              check_syntax, parse_fatal, lint_fatal,
+                              show_context);
+}
+
+// Returns true if syntax errors are to be reported for this analysis.
+static bool HasReportableSyntaxErrors(const VerilogAnalyzer& analyzer,
+                                      bool check_syntax) {
+  return check_syntax &&
+         (!analyzer.LexStatus().ok() || !analyzer.ParseStatus().ok());
+}
+
+LintFileResult AnalyzeAndLintFile(absl::string_view filename,
+                                  const LinterConfiguration& config,
+                                  bool check_syntax, bool parse_fatal,
+                                  bool profile, const LintResultCache* cache) {
+  LintFileResult result;
+  absl::StatusOr<std::string> content_or =
       verible::file::GetContentAsString(filename);
   if (!content_or.ok()) {
     LOG(ERROR) << "Can't read '" << filename
                << "': " << content_or.status().message();
-    return 2;
+    result.exit_status = 2;
+    return result;
+  }
+  auto contents = std::make_unique<const std::string>(*std::move(content_or));
+  if (profile) result.profile.AddFile();
+
+  // Files that were linted before with the same configuration need no
+  // analysis at all.
+  std::string cache_key;
+  LintTiming cache_timing;
+  if (cache != nullptr) {
+    bool cache_hit = false;
+    verible::TimeLintCall(profile ? &cache_timing : nullptr, [&]() {
+      cache_key = cache->Key(filename, *contents, config);
+      auto cached = cache->Lookup(cache_key, *contents);
+      if (cached.ok()) {
+        result.rule_statuses = *std::move(cached);
+        cache_hit = true;
+      }
+    });
+    if (cache_hit) {
+      // The findings point into the contents.
+      result.cached_contents = std::move(contents);
+      if (profile) result.profile.AddPhase(kCachePhase, cache_timing);
+      return result;
+    }
   }
 
   // Lex and parse the contents of the file.
@@ -118,36 +194,80 @@ int LintOneFile(std::ostream* stream, absl::string_view filename,
   // TODO(hzeller): this behavior could be configurable, but then again this
   //   is something the user is expecting to work as best as possible (which
   //   is also why we use automatic mode).
-  const auto analyzer = VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
-      *content_or, filename);
-  if (check_syntax) {
-    const auto lex_status = ABSL_DIE_IF_NULL(analyzer)->LexStatus();
-    const auto parse_status = analyzer->ParseStatus();
-    if (!lex_status.ok() || !parse_status.ok()) {
+  LintTiming parse_timing;
+  verible::TimeLintCall(profile ? &parse_timing : nullptr, [&]() {
+    result.analyzer = VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
+        *contents, filename);
+  });
+  if (profile) result.profile.AddPhase(kParsePhase, parse_timing);
+  if (HasReportableSyntaxErrors(*ABSL_DIE_IF_NULL(result.analyzer),
+                                check_syntax) &&
+      parse_fatal) {
+    // Syntax errors are reported later, no need to lint.
+    return result;
+  }
+  // With syntax-error recovery, one can still continue to analyze a
+  // partial syntax tree.
+
+  // Analyze the parsed structure for lint violations.
+  auto linter_result =
+      VerilogLintTextStructure(filename, config, result.analyzer->Data(),
+                               profile ? &result.profile : nullptr);
+  if (!linter_result.ok()) {
+    // Something went wrong with running the lint analysis itself.
+    LOG(ERROR) << "Fatal error: " << linter_result.status().message();
+    result.exit_status = 2;
+    return result;
+  }
+  result.rule_statuses = std::move(linter_result).value();
+
+  // Only findings of files without syntax errors are cached, so a cache hit
+  // never has syntax errors to report.
+  const VerilogAnalyzer& analyzer = *result.analyzer;
+  if (cache != nullptr && analyzer.LexStatus().ok() &&
+      analyzer.ParseStatus().ok() && analyzer.Data().Contents() == *contents) {
+    verible::TimeLintCall(profile ? &cache_timing : nullptr, [&]() {
+      const absl::Status status = cache->Store(
+          cache_key, analyzer.Data().Contents(), result.rule_statuses);
+      if (!status.ok()) {
+        VLOG(1) << "Lint result of " << filename
+                << " not cached: " << status.message();
+      }
+    });
+  }
+  if (profile && cache != nullptr) {
+    result.profile.AddPhase(kCachePhase, cache_timing);
+  }
+  return result;
+}
+
+int ReportLintFileResult(std::ostream* stream, absl::string_view filename,
+                         const LintFileResult& result,
+                         verible::ViolationHandler* violation_handler,
+                         bool check_syntax, bool parse_fatal, bool lint_fatal,
+                         bool show_context) {
+  if (result.exit_status != 0) return result.exit_status;
+
+  // Cached findings come without an analyzer, but also without syntax errors.
+  absl::string_view text_base;
+  if (result.analyzer == nullptr) {
+    text_base = *ABSL_DIE_IF_NULL(result.cached_contents);
+  } else {
+    const VerilogAnalyzer& analyzer = *result.analyzer;
+    if (HasReportableSyntaxErrors(analyzer, check_syntax)) {
       const std::vector<std::string> syntax_error_messages(
-          analyzer->LinterTokenErrorMessages(show_context));
+          analyzer.LinterTokenErrorMessages(show_context));
       for (const auto& message : syntax_error_messages) {
         *stream << message << std::endl;
       }
       if (parse_fatal) {
         return 1;
-        // With syntax-error recovery, one can still continue to analyze a
-        // partial syntax tree.
       }
     }
+    text_base = analyzer.Data().Contents();
   }
 
-  // Analyze the parsed structure for lint violations.
-  const auto& text_structure = analyzer->Data();
-  const auto linter_result =
-      VerilogLintTextStructure(filename, config, text_structure);
-  if (!linter_result.ok()) {
-    // Something went wrong with running the lint analysis itself.
-    LOG(ERROR) << "Fatal error: " << linter_result.status().message();
-    return 2;
-  }
-
-  const std::vector<LintRuleStatus>& linter_statuses = linter_result.value();
+  const std::vector<LintRuleStatus>& linter_statuses = result.rule_statuses;
 
   size_t total_violations = 0;
   for (const auto& rule_status : linter_statuses) {
@@ -159,8 +279,6 @@ int LintOneFile(std::ostream* stream, absl::string_view filename,
   } else {
     VLOG(1) << "Lint Violations (" << total_violations << "): " << std::endl;
 
-    absl::string_view text_base = text_structure.Contents();
-
     const std::set<LintViolationWithStatus> violations =
         GetSortedViolations(linter_statuses);
     violation_handler->HandleViolations(violations, text_base, filename);
@@ -190,6 +308,9 @@ absl::Status VerilogLinter::Configure(const LinterConfiguration& configuration,
       LOG(INFO) << "active rule: '" << name << '\'';
     }
   }
+  max_violations_ = configuration.max_violations_per_file;
+  lines_ = configuration.lines_to_lint;
+
   auto text_rules = configuration.CreateTextStructureRules();
   if (!text_rules.ok()) return text_rules.status();
   for (auto& rule : *text_rules) {
@@ -214,11 +335,12 @@ absl::Status VerilogLinter::Configure(const LinterConfiguration& configuration,
   absl::Status rc = absl::OkStatus();
   for (const auto& waiver_file :
        absl::StrSplit(configuration.external_waivers, ',', absl::SkipEmpty())) {
-    auto content_or = verible::file::GetContentAsString(waiver_file);
+    // Waiver files are shared by all lintees, so only read them once.
+    auto content_or = ConfigFileCache::Global().GetContent(waiver_file);
     if (!content_or.ok()) continue;  // Couldn't read lint file: ignore
     auto status = lint_waiver_.ApplyExternalWaivers(
         configuration.ActiveRuleIds(), lintee_filename, waiver_file,
-        *content_or);
+        **content_or);
     if (!status.ok()) {
       rc.Update(status);
     }
@@ -227,24 +349,140 @@ absl::Status VerilogLinter::Configure(const LinterConfiguration& configuration,
   return rc;
 }
 
+void VerilogLinter::EnableProfiling(LintProfile* profile) {
+  profile_ = profile;
+  line_linter_.EnableProfiling();
+  token_stream_linter_.EnableProfiling();
+  syntax_tree_linter_.EnableProfiling();
+  text_structure_linter_.EnableProfiling();
+}
+
+// Returns true if 'span' overlaps any of 'lines' (1-based) of 'text_base'.
+// Empty spans, and spans outside of 'text_base', are considered to overlap.
+static bool SpanTouchesLines(absl::string_view span,
+                             absl::string_view text_base,
+                             const LineColumnMap& line_map,
+                             const verible::LineNumberSet& lines) {
+  if (span.empty() || !verible::IsSubRange(span, text_base)) return true;
+  const int begin = std::distance(text_base.begin(), span.begin());
+  const int first_line = line_map.LineAtOffset(begin) + 1;
+  const int last_line = line_map.LineAtOffset(begin + span.size() - 1) + 1;
+  const auto iter = lines.LowerBound(first_line);
+  return iter != lines.end() && iter->first <= last_line;
+}
+
 void VerilogLinter::Lint(const TextStructureView& text_structure,
                          absl::string_view filename) {
-  // Collect all lint waivers in an initial pass.
-  lint_waiver_.ProcessTokenRangesByLine(text_structure);
+  // Phase timings, only measured when profiling.
+  LintTiming waiver_timing, text_structure_timing, line_and_token_timing,
+      syntax_tree_timing;
+  const auto timing = [this](LintTiming* t) {
+    return profile_ != nullptr ? t : nullptr;
+  };
 
-  // Analyze general text structure.
-  text_structure_linter_.Lint(text_structure, filename);
+  // Collect all lint waivers in an initial pass.
+  verible::TimeLintCall(timing(&waiver_timing), [&]() {
+    lint_waiver_.ProcessTokenRangesByLine(text_structure);
+  });
+
+  // With a violation limit, the analysis stops once it is reached. The rules
+  // count their violations cheaply, but only collecting the violations tells
+  // which are waived. Since the number of unwaived violations can only grow
+  // by as many violations as are found, they are only collected and counted
+  // again when that could reach the limit.
+  size_t found_at_last_count = 0;
+  size_t unwaived_at_last_count = 0;
+  const auto limit_reached = [&]() {
+    if (max_violations_ == 0) return false;
+    const size_t found = FoundViolations();
+    if (unwaived_at_last_count + (found - found_at_last_count) <
+        max_violations_) {
+      return false;
+    }
+    found_at_last_count = found;
+    unwaived_at_last_count = CountViolations(text_structure);
+    return unwaived_at_last_count >= max_violations_;
+  };
 
-  // Analyze lines of text.
-  line_linter_.Lint(text_structure.Lines());
+  // Byte-level facts about all lines, from one pass over the text, shared by
+  // the text structure and line rules.
+  const std::vector<verible::LineScan> line_scans =
+      verible::ScanLines(text_structure.Contents());
 
-  // Analyze token stream.
-  token_stream_linter_.Lint(text_structure.TokenStream());
+  // Analyze general text structure.
+  verible::TimeLintCall(timing(&text_structure_timing), [&]() {
+    text_structure_linter_.Lint(text_structure, filename, line_scans);
+  });
+  bool stopped = limit_reached();
+
+  // Analyze lines of text and the token stream together, in a single pass,
+  // timed as one phase. Each line is followed by the tokens that start on it.
+  if (!stopped) {
+    const auto &lines = text_structure.Lines();
+    CHECK_EQ(line_scans.size(), lines.size());
+    const verible::TokenSequence &tokens = text_structure.TokenStream();
+    // Tokens are in text order, so a single iterator walks them along with
+    // the lines: a token starts on line 'i' if it starts before line 'i + 1'.
+    // The last line gets all remaining tokens.
+    auto token_iter = tokens.begin();
+    const auto on_line = [&](size_t i) {
+      return token_iter != tokens.end() &&
+             (i + 1 == lines.size() ||
+              token_iter->text().data() < lines[i + 1].data());
+    };
+    verible::TimeLintCall(timing(&line_and_token_timing), [&]() {
+      for (size_t i = 0; i < lines.size() && !stopped; ++i) {
+        if (!lines_.empty() && !lines_.Contains(static_cast<int>(i) + 1)) {
+          // Neither this line nor the tokens that start on it are linted.
+          while (on_line(i)) ++token_iter;
+          continue;
+        }
+        line_linter_.HandleLine(lines[i], line_scans[i]);
+        for (; on_line(i); ++token_iter) {
+          token_stream_linter_.HandleToken(*token_iter);
+        }
+        if (max_violations_ > 0 && (i + 1) % kLinesPerViolationCount == 0) {
+          stopped = limit_reached();
+        }
+      }
+      if (!stopped) {
+        line_linter_.Finalize();
+        for (; token_iter != tokens.end(); ++token_iter) {
+          token_stream_linter_.HandleToken(*token_iter);
+        }
+        stopped = limit_reached();
+      }
+    });
+  }
 
   // Analyze syntax tree.
   const verible::ConcreteSyntaxTree& syntax_tree = text_structure.SyntaxTree();
-  if (syntax_tree != nullptr) {
-    syntax_tree_linter_.Lint(*syntax_tree);
+  if (!stopped && syntax_tree != nullptr) {
+    if (max_violations_ > 0) {
+      syntax_tree_linter_.StopWhen(limit_reached, kSymbolsPerViolationCount);
+    }
+    if (!lines_.empty()) {
+      // Subtrees that don't reach into the lines to lint are not visited;
+      // the ancestors of those that do still provide context to the rules.
+      syntax_tree_linter_.SkipSubtreesWhere([&](const verible::Symbol& symbol) {
+        return !SpanTouchesLines(verible::StringSpanOfSymbol(symbol),
+                                 text_structure.Contents(),
+                                 text_structure.GetLineColumnMap(), lines_);
+      });
+    }
+    verible::TimeLintCall(timing(&syntax_tree_timing), [&]() {
+      syntax_tree_linter_.Lint(*syntax_tree);
+    });
+    // Don't keep a reference to this call's locals.
+    syntax_tree_linter_.StopWhen(nullptr, 0);
+    syntax_tree_linter_.SkipSubtreesWhere(nullptr);
+  }
+
+  if (profile_ != nullptr) {
+    profile_->AddPhase(kWaiverPhase, waiver_timing);
+    profile_->AddPhase(kTextStructurePhase, text_structure_timing);
+    profile_->AddPhase(kLineAndTokenPhase, line_and_token_timing);
+    profile_->AddPhase(kSyntaxTreePhase, syntax_tree_timing);
   }
 }
 
@@ -275,18 +513,81 @@ static void AppendLintRuleStatuses(
   }
 }
 
+// Drops the violations that don't start on any of 'lines' (1-based).
+static void KeepViolationsOnLines(const verible::LineNumberSet& lines,
+                                  const LineColumnMap& line_map,
+                                  absl::string_view text_base,
+                                  std::vector<LintRuleStatus>* statuses) {
+  for (auto& status : *statuses) {
+    status.WaiveViolations([&](const verible::LintViolation& violation) {
+      const size_t offset = violation.token.left(text_base);
+      return !lines.Contains(line_map.LineAtOffset(offset) + 1);
+    });
+  }
+}
+
+// Accounts the rule 'timings' of one linter to 'profile', naming each rule
+// after the corresponding entry of 'statuses'.
+static void AddRuleTimings(const std::vector<LintRuleStatus>& statuses,
+                           const std::vector<LintTiming>& timings,
+                           absl::string_view phase, LintProfile* profile) {
+  CHECK_EQ(statuses.size(), timings.size());
+  for (size_t i = 0; i < statuses.size(); ++i) {
+    profile->AddRule(statuses[i].lint_rule_name, phase, timings[i]);
+  }
+}
+
+size_t VerilogLinter::CountViolations(
+    const verible::TextStructureView& text_structure) const {
+  std::vector<LintRuleStatus> statuses;
+  const verible::LintWaiver& waivers = lint_waiver_.GetLintWaiver();
+  const auto append = [&](const auto& linter) {
+    AppendLintRuleStatuses(linter.ReportStatus(), waivers,
+                           text_structure.GetLineColumnMap(),
+                           text_structure.Contents(), &statuses);
+  };
+  append(line_linter_);
+  append(text_structure_linter_);
+  append(token_stream_linter_);
+  append(syntax_tree_linter_);
+  if (!lines_.empty()) {
+    KeepViolationsOnLines(lines_, text_structure.GetLineColumnMap(),
+                          text_structure.Contents(), &statuses);
+  }
+  size_t count = 0;
+  for (const auto& status : statuses) count += status.violations.size();
+  return count;
+}
+
+size_t VerilogLinter::FoundViolations() const {
+  return line_linter_.ViolationCount() +
+         text_structure_linter_.ViolationCount() +
+         token_stream_linter_.ViolationCount() +
+         syntax_tree_linter_.ViolationCount();
+}
+
 std::vector<LintRuleStatus> VerilogLinter::ReportStatus(
     const LineColumnMap& line_map, absl::string_view text_base) {
   std::vector<LintRuleStatus> statuses;
   const verible::LintWaiver& waivers = lint_waiver_.GetLintWaiver();
-  AppendLintRuleStatuses(line_linter_.ReportStatus(), waivers, line_map,
-                         text_base, &statuses);
-  AppendLintRuleStatuses(text_structure_linter_.ReportStatus(), waivers,
-                         line_map, text_base, &statuses);
-  AppendLintRuleStatuses(token_stream_linter_.ReportStatus(), waivers, line_map,
-                         text_base, &statuses);
-  AppendLintRuleStatuses(syntax_tree_linter_.ReportStatus(), waivers, line_map,
-                         text_base, &statuses);
+  const auto append = [&](const auto& linter, absl::string_view phase) {
+    const std::vector<LintRuleStatus> linter_statuses = linter.ReportStatus();
+    AppendLintRuleStatuses(linter_statuses, waivers, line_map, text_base,
+                           &statuses);
+    if (profile_ != nullptr) {
+      AddRuleTimings(linter_statuses, linter.RuleTimings(), phase, profile_);
+    }
+  };
+  append(line_linter_, kLinePhase);
+  append(text_structure_linter_, kTextStructurePhase);
+  append(token_stream_linter_, kTokenPhase);
+  append(syntax_tree_linter_, kSyntaxTreePhase);
+  if (!lines_.empty()) {
+    KeepViolationsOnLines(lines_, line_map, text_base, &statuses);
+  }
+  if (max_violations_ > 0) {
+    verible::KeepFirstViolations(max_violations_, &statuses);
+  }
   return statuses;
 }
 
@@ -301,6 +602,8 @@ absl::StatusOr<LinterConfiguration> LinterConfigurationFromFlags(
       .rules_config_search = absl::GetFlag(FLAGS_rules_config_search),
       .linting_start_file = std::string(linting_start_file),
       .waiver_files = absl::GetFlag(FLAGS_waiver_files),
+      .max_violations_per_file = static_cast<size_t>(
+          std::max(0, absl::GetFlag(FLAGS_max_violations_per_file))),
   };
 
   RETURN_IF_ERROR(config.ConfigureFromOptions(options));
@@ -310,12 +613,13 @@ absl::StatusOr<LinterConfiguration> LinterConfigurationFromFlags(
 
 absl::StatusOr<std::vector<LintRuleStatus>> VerilogLintTextStructure(
     absl::string_view filename, const LinterConfiguration& config,
-    const TextStructureView& text_structure) {
+    const TextStructureView& text_structure, LintProfile* profile) {
   // Create the linter, add rules, and run it.
   VerilogLinter linter;
   if (absl::Status status = linter.Configure(config, filename); !status.ok()) {
     return status;
   }
+  if (profile != nullptr) linter.EnableProfiling(profile);
 
   linter.Lint(text_structure, filename);
 
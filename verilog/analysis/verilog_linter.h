@@ -15,7 +15,9 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_VERILOG_LINTER_H_
 #define VERIBLE_VERILOG_ANALYSIS_VERILOG_LINTER_H_
 
+#include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -25,6 +27,7 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "common/analysis/line_linter.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/lint_rule_status.h"
 #include "common/analysis/lint_waiver.h"
 #include "common/analysis/syntax_tree_linter.h"
@@ -32,8 +35,11 @@
 #include "common/analysis/token_stream_linter.h"
 #include "common/analysis/violation_handler.h"
 #include "common/strings/line_column_map.h"
+#include "common/strings/position.h"
 #include "common/text/text_structure.h"
+#include "verilog/analysis/lint_result_cache.h"
 #include "verilog/analysis/lint_rule_registry.h"
+#include "verilog/analysis/verilog_analyzer.h"
 #include "verilog/analysis/verilog_linter_configuration.h"
 
 // Flag is declared for testing purposes (used e.g. in
@@ -69,6 +75,50 @@ int LintOneFile(std::ostream* stream, absl::string_view filename,
                 verible::ViolationHandler* violation_handler, bool check_syntax,
                 bool parse_fatal, bool lint_fatal, bool show_context = false);
 
+// Intermediate result of LintOneFile(): everything that is computed for a
+// file before anything is reported.
+struct LintFileResult {
+  // Non-zero if the file could not be processed at all (see LintOneFile()
+  // for the meaning of the exit codes). Nothing is left to report then.
+  int exit_status = 0;
+
+  // Owns the file contents the lint violations point into.
+  // Null if the lint findings were found in the lint result cache.
+  std::unique_ptr<VerilogAnalyzer> analyzer;
+
+  // Owns the file contents instead of 'analyzer' if the lint findings were
+  // found in the lint result cache.
+  std::unique_ptr<const std::string> cached_contents;
+
+  // Lint findings; empty if linting was skipped due to syntax errors.
+  std::vector<verible::LintRuleStatus> rule_statuses;
+
+  // Time spent per phase and per rule; only filled in when profiling.
+  verible::LintProfile profile;
+};
+
+// First half of LintOneFile(): reads, lexes, parses and lints 'filename',
+// but does not report anything. Independent files can be processed
+// concurrently, as there is no shared mutable state.
+// If 'profile' is true, the time spent in lexing and parsing, in each linter
+// phase and in each rule is recorded in the result's profile.
+// If 'cache' is not null, findings of files that were linted before with the
+// same contents and configuration are taken from it, skipping all analysis.
+// Findings of files without syntax errors are stored in it.
+LintFileResult AnalyzeAndLintFile(absl::string_view filename,
+                                  const LinterConfiguration& config,
+                                  bool check_syntax, bool parse_fatal,
+                                  bool profile = false,
+                                  const LintResultCache* cache = nullptr);
+
+// Second half of LintOneFile(): prints syntax errors to 'stream' and passes
+// lint violations to 'violation_handler'. Returns the exit code.
+int ReportLintFileResult(std::ostream* stream, absl::string_view filename,
+                         const LintFileResult& result,
+                         verible::ViolationHandler* violation_handler,
+                         bool check_syntax, bool parse_fatal, bool lint_fatal,
+                         bool show_context = false);
+
 // VerilogLinter analyzes a TextStructureView of Verilog source code.
 // This uses syntax-tree based analyses and lexical token-stream analyses.
 class VerilogLinter {
@@ -79,14 +129,22 @@ class VerilogLinter {
   absl::Status Configure(const LinterConfiguration& configuration,
                          absl::string_view lintee_filename);
 
-  // Analyzes text structure.
+  // Analyzes text structure. Line and token stream rules share a single pass
+  // over the text. With a violation limit, the analysis stops early once
+  // that many violations are found.
   void Lint(const verible::TextStructureView& text_structure,
             absl::string_view filename);
 
-  // Reports lint findings.
+  // Reports lint findings, at most the first ones up to the violation limit.
+  // When profiling, also accounts the time spent in each rule to the profile.
   std::vector<verible::LintRuleStatus> ReportStatus(
       const verible::LineColumnMap&, absl::string_view text_base);
 
+  // Measures the time spent in each linter phase and each rule, and
+  // accumulates it into 'profile', which must outlive this linter.
+  // Call before Lint().
+  void EnableProfiling(verible::LintProfile* profile);
+
  private:
   // Line based linter.
   verible::LineLinter line_linter_;
@@ -102,6 +160,23 @@ class VerilogLinter {
 
   // Tracks the set of waived lines per rule.
   verible::LintWaiverBuilder lint_waiver_;
+
+  // Returns the number of violations found so far that are not waived.
+  size_t CountViolations(
+      const verible::TextStructureView& text_structure) const;
+
+  // Returns the number of violations found so far, including waived ones.
+  // Unlike CountViolations(), this doesn't collect the violations.
+  size_t FoundViolations() const;
+
+  // If not null, receives the timings of the linter phases and rules.
+  verible::LintProfile* profile_ = nullptr;
+
+  // Stop linting once this many violations are found; 0 means no limit.
+  size_t max_violations_ = 0;
+
+  // Only lint these lines (1-based); empty means all lines.
+  verible::LineNumberSet lines_;
 };
 
 // Creates a linter configuration from global flags.
@@ -127,12 +202,14 @@ absl::Status AppendLinterConfigurationFromFile(
 //   filename: (optional) name of input file, that can appear in logs.
 //   text_structure: contains the syntax tree that will be lint-analyzed.
 //   show_context: print additional line with vulnerable code
+//   profile: (optional) accumulates the time spent per linter phase and rule.
 //
 // Returns:
 //   Vector of LintRuleStatuses on success, otherwise error code.
 absl::StatusOr<std::vector<verible::LintRuleStatus>> VerilogLintTextStructure(
     absl::string_view filename, const LinterConfiguration& config,
-    const verible::TextStructureView& text_structure);
+    const verible::TextStructureView& text_structure,
+    verible::LintProfile* profile = nullptr);
 
 // Prints the rule, description and default_enabled.
 absl::Status PrintRuleInfo(std::ostream*,
@@ -15,16 +15,21 @@
 #include "verilog/analysis/verilog_linter_configuration.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
@@ -248,6 +253,16 @@ std::set<analysis::LintRuleId> LinterConfiguration::ActiveRuleIds() const {
   return result;
 }
 
+RuleBundle LinterConfiguration::ActiveRuleBundle() const {
+  RuleBundle result;
+  for (const auto &rule_pair : configuration_) {
+    if (rule_pair.second.enabled) {
+      result.rules.insert(rule_pair);
+    }
+  }
+  return result;
+}
+
 // Iterates through all rules that are mentioned and enabled
 // in the "config" map. Constructs instances using the
 // "factory"-function, and configures them if a configuration string is
@@ -306,27 +321,134 @@ bool LinterConfiguration::operator==(const LinterConfiguration &config) const {
   return ActiveRuleIds() == config.ActiveRuleIds();
 }
 
+ConfigFileCache &ConfigFileCache::Global() {
+  static auto *const cache = new ConfigFileCache();  // never freed
+  return *cache;
+}
+
+absl::StatusOr<ConfigFileCache::Entry *> ConfigFileCache::LookupLocked(
+    absl::string_view filename) {
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::path path = fs::absolute(fs::path(std::string(filename)), ec);
+  if (ec) path = std::string(filename);
+  const std::string key = path.lexically_normal().string();
+
+  // A file that can't be stat'ed is re-read on every lookup, which also
+  // produces the appropriate error status if it doesn't exist.
+  // The size catches rewrites within the resolution of the modification time.
+  const fs::file_time_type mtime = fs::last_write_time(key, ec);
+  std::error_code size_ec;
+  const std::uintmax_t size = fs::file_size(key, size_ec);
+  auto found = entries_.find(key);
+  if (!ec && !size_ec && found != entries_.end() &&
+      found->second.mtime == mtime && found->second.size == size) {
+    return &found->second;
+  }
+
+  absl::StatusOr<std::string> content_or =
+      verible::file::GetContentAsString(filename);
+  if (!content_or.ok()) {
+    if (found != entries_.end()) entries_.erase(found);
+    return content_or.status();
+  }
+  Entry entry{mtime, size,
+              std::make_shared<const std::string>(*std::move(content_or)),
+              std::nullopt};
+  auto [iter, unused] = entries_.insert_or_assign(key, std::move(entry));
+  return &iter->second;
+}
+
+absl::StatusOr<std::shared_ptr<const std::string>> ConfigFileCache::GetContent(
+    absl::string_view filename) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  absl::StatusOr<Entry *> entry_or = LookupLocked(filename);
+  if (!entry_or.ok()) return entry_or.status();
+  return (*entry_or)->content;
+}
+
+absl::StatusOr<RuleBundle> ConfigFileCache::GetRuleBundle(
+    absl::string_view filename, std::string *error) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  absl::StatusOr<Entry *> entry_or = LookupLocked(filename);
+  if (!entry_or.ok()) return entry_or.status();
+  Entry &entry = **entry_or;
+  if (!entry.rule_bundle.has_value()) {
+    entry.rule_bundle.emplace();
+    entry.rule_bundle->ParseConfiguration(*entry.content, '\n', error);
+  }
+  return *entry.rule_bundle;
+}
+
+absl::StatusOr<std::string> ConfigFileCache::UpwardFileSearch(
+    absl::string_view start, absl::string_view filename) {
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::path probe_dir = fs::absolute(fs::path(std::string(start)), ec);
+  if (ec) {
+    // Let the uncached search produce the error status.
+    std::string result;
+    RETURN_IF_ERROR(verible::file::UpwardFileSearch(start, filename, &result));
+    return result;
+  }
+  probe_dir = probe_dir.lexically_normal();
+  if (!fs::is_directory(probe_dir, ec)) probe_dir = probe_dir.parent_path();
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  std::string result;
+  std::vector<std::string> searched_dirs;
+  for (;;) {
+    auto known = searches_.find({std::string(filename), probe_dir.string()});
+    if (known != searches_.end()) {
+      result = known->second;
+      if (result.empty() || verible::file::FileExists(result).ok()) break;
+      // Removed since; search everything again.
+      searches_.clear();
+      result.clear();
+      continue;
+    }
+    searched_dirs.push_back(probe_dir.string());
+    const std::string candidate = (probe_dir / std::string(filename)).string();
+    if (verible::file::FileExists(candidate).ok()) {
+      result = candidate;
+      break;
+    }
+    const fs::path one_up = probe_dir.parent_path();
+    if (one_up == probe_dir) break;
+    probe_dir = one_up;
+  }
+  for (std::string &dir : searched_dirs) {
+    searches_.insert_or_assign({std::string(filename), std::move(dir)}, result);
+  }
+  if (result.empty()) {
+    return absl::NotFoundError(absl::StrCat("UpwardFileSearch: starting from '",
+                                            start, "', no file '", filename,
+                                            "' found'"));
+  }
+  return result;
+}
+
+void ConfigFileCache::Clear() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  searches_.clear();
+}
+
 absl::Status LinterConfiguration::AppendFromFile(
     absl::string_view config_filename) {
   // Read local configuration file
-  std::string content;
-
-  absl::StatusOr<std::string> config_or =
-      verible::file::GetContentAsString(config_filename);
-  if (config_or.ok()) {
-    RuleBundle local_rules_bundle;
-    std::string error;
-    local_rules_bundle.ParseConfiguration(*config_or, '\n', &error);
-    // Log warnings and errors
-    if (!error.empty()) {
-      std::cerr << "Using a partial version from " << config_filename
-                << ". Found the following issues: " << error;
-    }
-    UseRuleBundle(local_rules_bundle);
-    return absl::OkStatus();
+  std::string error;
+  absl::StatusOr<RuleBundle> bundle_or =
+      ConfigFileCache::Global().GetRuleBundle(config_filename, &error);
+  if (!bundle_or.ok()) return bundle_or.status();
+
+  // Log warnings and errors
+  if (!error.empty()) {
+    std::cerr << "Using a partial version from " << config_filename
+              << ". Found the following issues: " << error;
   }
-
-  return config_or.status();
+  UseRuleBundle(*bundle_or);
+  return absl::OkStatus();
 }
 
 absl::Status LinterConfiguration::ConfigureFromOptions(
@@ -347,15 +469,15 @@ absl::Status LinterConfiguration::ConfigureFromOptions(
     // Search upward if search is enabled and no configuration file is
     // specified
     static constexpr absl::string_view linter_config = ".rules.verible_lint";
-    std::string resolved_config_file;
-    if (verible::file::UpwardFileSearch(options.linting_start_file,
-                                        linter_config, &resolved_config_file)
-            .ok()) {
+    if (const absl::StatusOr<std::string> resolved_config_file =
+            ConfigFileCache::Global().UpwardFileSearch(
+                options.linting_start_file, linter_config);
+        resolved_config_file.ok()) {
       const absl::Status config_read_status =
-          AppendFromFile(resolved_config_file);
+          AppendFromFile(*resolved_config_file);
 
       if (!config_read_status.ok()) {
-        std::cerr << resolved_config_file
+        std::cerr << *resolved_config_file
                   << ": Unable to read rules configuration file "
                   << config_read_status << std::endl;
       }
@@ -368,6 +490,8 @@ absl::Status LinterConfiguration::ConfigureFromOptions(
   // Apply external waivers
   external_waivers = std::string(options.waiver_files);
 
+  max_violations_per_file = options.max_violations_per_file;
+
   return absl::OkStatus();
 }
 
@@ -15,11 +15,18 @@
 #ifndef VERIBLE_VERILOG_ANALYSIS_VERILOG_LINTER_CONFIGURATION_H_
 #define VERIBLE_VERILOG_ANALYSIS_VERILOG_LINTER_CONFIGURATION_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -28,6 +35,7 @@
 #include "common/analysis/syntax_tree_lint_rule.h"
 #include "common/analysis/text_structure_lint_rule.h"
 #include "common/analysis/token_stream_lint_rule.h"
+#include "common/strings/position.h"
 #include "verilog/analysis/lint_rule_registry.h"
 
 namespace verilog {
@@ -159,6 +167,71 @@ struct LinterOptions {
   std::string linting_start_file;
   // Path to the external waivers configuration file
   std::string waiver_files;
+  // Stop linting a file once this many violations are found; 0 means no
+  // limit.
+  size_t max_violations_per_file = 0;
+};
+
+// ConfigFileCache keeps the contents of linter configuration and waiver files,
+// so that files shared by all lintees of one run (or by all buffers of a
+// language server session) are only read and parsed once per process.
+// Entries are keyed by absolute path, and are re-read when the modification
+// time or the size of the file changes.
+// It also remembers upward searches for configuration files per directory.
+// This is thread-safe.
+//
+// Usage:
+//   auto bundle_or = ConfigFileCache::Global().GetRuleBundle(path, &error);
+class ConfigFileCache {
+ public:
+  ConfigFileCache() = default;
+
+  ConfigFileCache(const ConfigFileCache &) = delete;
+  ConfigFileCache &operator=(const ConfigFileCache &) = delete;
+
+  // The process-wide cache.
+  static ConfigFileCache &Global();
+
+  // Returns the content of 'filename'.
+  absl::StatusOr<std::shared_ptr<const std::string>> GetContent(
+      absl::string_view filename);
+
+  // Returns the rules configured in 'filename', parsed with newline
+  // separators. Issues found while parsing are reported in 'error' only the
+  // first time the file content is parsed, and leave a partial bundle.
+  absl::StatusOr<RuleBundle> GetRuleBundle(absl::string_view filename,
+                                           std::string *error);
+
+  // Returns the path of the first file named 'filename' in 'start' or its
+  // parent directories, like verible::file::UpwardFileSearch().
+  // The result is remembered for every directory on the way up, so that
+  // searches for lintees in the same or nearby directories don't walk up
+  // again. A file found before is checked to still exist, but one created
+  // later in a directory that was already searched is only found after
+  // Clear().
+  absl::StatusOr<std::string> UpwardFileSearch(absl::string_view start,
+                                               absl::string_view filename);
+
+  // Forgets all entries and searches.
+  void Clear();
+
+ private:
+  struct Entry {
+    std::filesystem::file_time_type mtime;
+    std::uintmax_t size;
+    std::shared_ptr<const std::string> content;
+    // Parsed lazily, as not every file is a rules configuration.
+    std::optional<RuleBundle> rule_bundle;
+  };
+
+  // Returns the up-to-date entry for 'filename', reading the file if needed.
+  // Requires mutex_ to be held.
+  absl::StatusOr<Entry *> LookupLocked(absl::string_view filename);
+
+  std::mutex mutex_;
+  std::map<std::string, Entry, std::less<>> entries_;
+  // Search results keyed by filename and directory; empty if not found.
+  std::map<std::pair<std::string, std::string>, std::string> searches_;
 };
 
 // LinterConfiguration is used for tracking enabled lint rules
@@ -212,6 +285,10 @@ class LinterConfiguration {
   // Return the keys of enabled lint rules, sorted.
   std::set<analysis::LintRuleId> ActiveRuleIds() const;
 
+  // Returns the enabled lint rules with their configuration. Configurations
+  // that behave the same have the same unparsed bundle.
+  RuleBundle ActiveRuleBundle() const;
+
   // Creates instances of every enabled syntax tree rule
   absl::StatusOr<std::vector<std::unique_ptr<verible::SyntaxTreeLintRule>>>
   CreateSyntaxTreeRules() const;
@@ -231,12 +308,22 @@ class LinterConfiguration {
   // Path to external lint waivers configuration file
   std::string external_waivers;
 
+  // If not 0, linting a file stops once this many violations that are not
+  // waived are found, and at most this many are reported.
+  size_t max_violations_per_file = 0;
+
+  // If not empty, only these lines (1-based) are linted: syntax subtrees and
+  // lines that are entirely outside of them are skipped, and only violations
+  // that start on them are reported.
+  verible::LineNumberSet lines_to_lint;
+
   // Returns true if configurations are equivalent.
   bool operator==(const LinterConfiguration &) const;
 
   bool operator!=(const LinterConfiguration &r) const { return !(*this == r); }
 
-  // Appends linter rules configuration from a file
+  // Appends linter rules configuration from a file.
+  // The file is read through ConfigFileCache::Global().
   absl::Status AppendFromFile(absl::string_view filename);
 
   // Generates configuration forn LinterOptions
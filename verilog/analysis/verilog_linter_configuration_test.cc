@@ -14,6 +14,9 @@
 
 #include "verilog/analysis/verilog_linter_configuration.h"
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iosfwd>
 #include <map>
 #include <string>
@@ -35,6 +38,7 @@
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
 #include "common/text/tree_builder_test_util.h"
+#include "common/util/file_util.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "verilog/analysis/default_rules.h"
@@ -374,6 +378,17 @@ TEST(LinterConfigurationTest, ComparisonSameDifferentElement) {
   EXPECT_EQ(config1, config2);
 }
 
+TEST(LinterConfigurationTest, ActiveRuleBundle) {
+  LinterConfiguration config;
+  EXPECT_TRUE(config.ActiveRuleBundle().rules.empty());
+  const RuleBundle bundle = {
+      {{"rule-x", {true, "length:80"}}, {"rule-y", {false, ""}}}};
+  config.UseRuleBundle(bundle);
+  config.TurnOn("rule-z");
+  EXPECT_EQ(config.ActiveRuleBundle().UnparseConfiguration(','),
+            "rule-z,rule-x=length:80");
+}
+
 TEST(LinterConfigurationTest, StreamOperator) {
   LinterConfiguration config;
   {
@@ -910,6 +925,145 @@ TEST(ConfigureFromOptionsTest, RulesSelective) {
 
   EXPECT_THAT(config.ActiveRuleIds(), SizeIs(expected_size));
 }
+
+TEST(ConfigureFromOptionsTest, LoadFromFile) {
+  const auto rule_name = analysis::RegisteredSyntaxTreeRulesNames()[0];
+  const verible::file::testing::ScopedTestFile config_file(
+      testing::TempDir(), absl::StrCat("-", rule_name, "\n"));
+  LinterOptions options = {.ruleset = RuleSet::kAll,
+                           .rules = RuleBundle(),
+                           .config_file = config_file.filename(),
+                           .rules_config_search = false,
+                           .linting_start_file = "filename",
+                           .waiver_files = ""};
+
+  // The second configuration is served from the cache.
+  for (int i = 0; i < 2; ++i) {
+    LinterConfiguration config;
+    EXPECT_TRUE(config.ConfigureFromOptions(options).ok());
+    EXPECT_FALSE(config.RuleIsOn({rule_name}));
+  }
+}
+
+// Overwrites 'filename' with 'content', and sets its modification time.
+static void RewriteFile(const std::string &filename, absl::string_view content,
+                        std::filesystem::file_time_type mtime) {
+  {
+    std::ofstream stream(filename, std::ios::trunc);
+    stream << content;
+  }
+  std::filesystem::last_write_time(filename, mtime);
+}
+
+TEST(ConfigFileCacheTest, ReadsOncePerModificationTime) {
+  ConfigFileCache cache;
+  const verible::file::testing::ScopedTestFile file(testing::TempDir(),
+                                                    "first");
+  const auto mtime = std::filesystem::last_write_time(file.filename());
+
+  auto content_or = cache.GetContent(file.filename());
+  ASSERT_TRUE(content_or.ok()) << content_or.status();
+  EXPECT_EQ(**content_or, "first");
+
+  // Same modification time: the file is not read again.
+  RewriteFile(file.filename(), "other", mtime);
+  content_or = cache.GetContent(file.filename());
+  ASSERT_TRUE(content_or.ok()) << content_or.status();
+  EXPECT_EQ(**content_or, "first");
+
+  // Modified file is read again.
+  RewriteFile(file.filename(), "second", mtime + std::chrono::seconds(1));
+  content_or = cache.GetContent(file.filename());
+  ASSERT_TRUE(content_or.ok()) << content_or.status();
+  EXPECT_EQ(**content_or, "second");
+
+  // A rewrite changing the size is noticed even with the same modification
+  // time, which might have a coarse resolution.
+  RewriteFile(file.filename(), "second, resized",
+              mtime + std::chrono::seconds(1));
+  content_or = cache.GetContent(file.filename());
+  ASSERT_TRUE(content_or.ok()) << content_or.status();
+  EXPECT_EQ(**content_or, "second, resized");
+
+  // Forgetting entries also reads the file again.
+  RewriteFile(file.filename(), "third", mtime + std::chrono::seconds(1));
+  cache.Clear();
+  content_or = cache.GetContent(file.filename());
+  ASSERT_TRUE(content_or.ok()) << content_or.status();
+  EXPECT_EQ(**content_or, "third");
+}
+
+TEST(ConfigFileCacheTest, MissingFile) {
+  ConfigFileCache cache;
+  EXPECT_FALSE(cache.GetContent("non-existent-file.txt").ok());
+  std::string error;
+  EXPECT_FALSE(cache.GetRuleBundle("non-existent-file.txt", &error).ok());
+}
+
+TEST(ConfigFileCacheTest, UpwardFileSearch) {
+  namespace fs = std::filesystem;
+  // Unlikely to exist in any parent of the test directory.
+  constexpr char kConfigName[] = ".upward_search_test_config";
+  ConfigFileCache cache;
+  const fs::path top = fs::path(testing::TempDir()) / "upward_search";
+  const fs::path sub = top / "a" / "b";
+  fs::remove_all(top);
+  fs::create_directories(sub);
+  const std::string config = (top / kConfigName).string();
+  const std::string lintee = (sub / "x.sv").string();
+
+  EXPECT_FALSE(cache.UpwardFileSearch(lintee, kConfigName).ok());
+
+  // Not found before, so only found after forgetting searches.
+  RewriteFile(config, "", fs::file_time_type::clock::now());
+  EXPECT_FALSE(cache.UpwardFileSearch(lintee, kConfigName).ok());
+  cache.Clear();
+  auto found_or = cache.UpwardFileSearch(lintee, kConfigName);
+  ASSERT_TRUE(found_or.ok()) << found_or.status();
+  EXPECT_EQ(*found_or, config);
+
+  // Searches from other directories reuse what is known about parents.
+  found_or = cache.UpwardFileSearch((top / "a").string(), kConfigName);
+  ASSERT_TRUE(found_or.ok()) << found_or.status();
+  EXPECT_EQ(*found_or, config);
+
+  // A closer file shadows the one further up, once searches are forgotten.
+  const std::string closer = (sub / kConfigName).string();
+  RewriteFile(closer, "", fs::file_time_type::clock::now());
+  cache.Clear();
+  found_or = cache.UpwardFileSearch(lintee, kConfigName);
+  ASSERT_TRUE(found_or.ok()) << found_or.status();
+  EXPECT_EQ(*found_or, closer);
+
+  // A removed file is noticed without forgetting searches.
+  fs::remove(closer);
+  found_or = cache.UpwardFileSearch(lintee, kConfigName);
+  ASSERT_TRUE(found_or.ok()) << found_or.status();
+  EXPECT_EQ(*found_or, config);
+
+  fs::remove_all(top);
+}
+
+TEST(ConfigFileCacheTest, ReportsParseIssuesOnce) {
+  ConfigFileCache cache;
+  const auto rule_name = analysis::RegisteredSyntaxTreeRulesNames()[0];
+  const verible::file::testing::ScopedTestFile file(
+      testing::TempDir(), absl::StrCat(rule_name, "\nno-such-rule\n"));
+
+  std::string error;
+  auto bundle_or = cache.GetRuleBundle(file.filename(), &error);
+  ASSERT_TRUE(bundle_or.ok()) << bundle_or.status();
+  EXPECT_FALSE(error.empty());
+  EXPECT_EQ(bundle_or->rules.size(), 1);
+  EXPECT_TRUE(bundle_or->rules.at(rule_name).enabled);
+
+  error.clear();
+  bundle_or = cache.GetRuleBundle(file.filename(), &error);
+  ASSERT_TRUE(bundle_or.ok()) << bundle_or.status();
+  EXPECT_TRUE(error.empty());
+  EXPECT_EQ(bundle_or->rules.size(), 1);
+}
+
 // TODO: LinterOptions could be refactored to store the content
 // of the configuration files. After this is made it will be possible to
 // test the configuration that is applied after reading the files.
@@ -37,12 +37,15 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
+#include "common/analysis/lint_profile.h"
 #include "common/analysis/violation_handler.h"
+#include "common/strings/position.h"
 #include "common/util/file_util.h"
 #include "common/util/logging.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "verilog/analysis/default_rules.h"
+#include "verilog/analysis/lint_result_cache.h"
 #include "verilog/analysis/verilog_analyzer.h"
 #include "verilog/analysis/verilog_linter_configuration.h"
 
@@ -189,6 +192,142 @@ TEST_F(LintOneFileTest, LintError) {
   }
 }
 
+// Tests that profiling records the phases and the enabled rules.
+TEST_F(LintOneFileTest, Profile) {
+  const ScopedTestFile temp_file(testing::TempDir(),
+                                 "task automatic foo;\n"
+                                 "  $psprintf(\"blah\");\n"
+                                 "endtask\n");
+  const LintFileResult result =
+      AnalyzeAndLintFile(temp_file.filename(), config_, true, false, true);
+  ASSERT_EQ(result.exit_status, 0);
+  EXPECT_EQ(result.profile.files(), 1);
+
+  std::set<std::string> phases;
+  for (const auto& phase : result.profile.SortedPhases()) {
+    phases.insert(phase.name);
+  }
+  EXPECT_THAT(phases, ::testing::IsSupersetOf({"lex-and-parse", "line",
+                                               "token", "syntax-tree"}));
+
+  const std::set<analysis::LintRuleId> active_rules = config_.ActiveRuleIds();
+  const std::vector<verible::LintProfile::RuleEntry> rules =
+      result.profile.SortedRules();
+  EXPECT_EQ(rules.size(), active_rules.size());
+  for (const auto& rule : rules) {
+    EXPECT_TRUE(active_rules.count(rule.name)) << rule.name;
+  }
+}
+
+// Tests that nothing is profiled by default.
+TEST_F(LintOneFileTest, NoProfileByDefault) {
+  const ScopedTestFile temp_file(testing::TempDir(), "module m;\nendmodule\n");
+  const LintFileResult result =
+      AnalyzeAndLintFile(temp_file.filename(), config_, true, false);
+  ASSERT_EQ(result.exit_status, 0);
+  EXPECT_EQ(result.profile.files(), 0);
+  EXPECT_TRUE(result.profile.SortedRules().empty());
+  EXPECT_TRUE(result.profile.SortedPhases().empty());
+}
+
+// Tests that no more violations than the limit are reported.
+TEST_F(LintOneFileTest, MaxViolationsPerFile) {
+  std::string text = "task automatic foo;\n";
+  for (int i = 0; i < 1000; ++i) {
+    text += "  $psprintf(\"blah\");\t\n";  // forbidden, tab, trailing space
+  }
+  text += "endtask\n";
+  const ScopedTestFile temp_file(testing::TempDir(), text);
+  const auto count_violations = [&](size_t limit) {
+    config_.max_violations_per_file = limit;
+    const LintFileResult result =
+        AnalyzeAndLintFile(temp_file.filename(), config_, true, false);
+    EXPECT_EQ(result.exit_status, 0);
+    size_t count = 0;
+    for (const auto& status : result.rule_statuses) {
+      count += status.violations.size();
+    }
+    return count;
+  };
+  EXPECT_GT(count_violations(0), 2000);
+  EXPECT_EQ(count_violations(10), 10);
+  EXPECT_EQ(count_violations(1500), 1500);
+}
+
+// Tests that only the violations on the lines to lint are reported.
+TEST_F(LintOneFileTest, LinesToLint) {
+  std::string text = "task automatic foo;\n";
+  for (int i = 0; i < 100; ++i) {
+    text += "  $psprintf(\"blah\");\t\n";  // forbidden, tab, trailing space
+  }
+  text += "endtask\n";
+  const ScopedTestFile temp_file(testing::TempDir(), text);
+  const auto count_violations = [&](const verible::LineNumberSet& lines) {
+    config_.lines_to_lint = lines;
+    const LintFileResult result =
+        AnalyzeAndLintFile(temp_file.filename(), config_, true, false);
+    EXPECT_EQ(result.exit_status, 0);
+    size_t count = 0;
+    for (const auto& status : result.rule_statuses) {
+      count += status.violations.size();
+    }
+    return count;
+  };
+  const size_t one_line = count_violations(verible::LineNumberSet{{2, 3}});
+  EXPECT_GE(one_line, 3);
+  EXPECT_EQ(count_violations(verible::LineNumberSet{{2, 4}, {50, 51}}),
+            3 * one_line);
+  EXPECT_GE(count_violations(verible::LineNumberSet{}), 100 * one_line);
+}
+
+// Tests that findings are taken from the lint result cache the second time.
+TEST_F(LintOneFileTest, LintResultCache) {
+  const LintResultCache cache(
+      verible::file::JoinPath(
+          testing::TempDir(),
+          verible::file::testing::RandomFileBasename("lint-cache")),
+      "test");
+  const ScopedTestFile temp_file(testing::TempDir(),
+                                 "task automatic foo;\n"
+                                 "  $psprintf(\"blah\");\n"  // forbidden
+                                 "endtask\n");
+  std::string reports[2];
+  for (std::string& report : reports) {
+    const LintFileResult result = AnalyzeAndLintFile(
+        temp_file.filename(), config_, true, false, false, &cache);
+    ASSERT_EQ(result.exit_status, 0);
+    std::ostringstream output;
+    ViolationPrinter violation_printer(&output);
+    EXPECT_EQ(ReportLintFileResult(&output, temp_file.filename(), result,
+                                   &violation_printer, true, false, true),
+              1);
+    report = output.str();
+    if (&report == &reports[0]) {
+      EXPECT_NE(result.analyzer, nullptr);
+    } else {
+      EXPECT_EQ(result.analyzer, nullptr);  // not analyzed again
+      EXPECT_NE(result.cached_contents, nullptr);
+    }
+  }
+  EXPECT_FALSE(reports[0].empty());
+  EXPECT_EQ(reports[0], reports[1]);
+}
+
+// Tests that findings of files with syntax errors are not cached.
+TEST_F(LintOneFileTest, LintResultCacheSkipsSyntaxErrors) {
+  const LintResultCache cache(
+      verible::file::JoinPath(
+          testing::TempDir(),
+          verible::file::testing::RandomFileBasename("lint-cache")),
+      "test");
+  const ScopedTestFile temp_file(testing::TempDir(), "class foo;\n");
+  for (int i = 0; i < 2; ++i) {
+    const LintFileResult result = AnalyzeAndLintFile(
+        temp_file.filename(), config_, true, false, false, &cache);
+    EXPECT_NE(result.analyzer, nullptr);
+  }
+}
+
 class VerilogLinterTest : public DefaultLinterConfigTestFixture,
                           public testing::Test {
  public:
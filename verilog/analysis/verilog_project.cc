@@ -14,7 +14,9 @@
 
 #include "verilog/analysis/verilog_project.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -30,6 +32,7 @@
 #include "common/text/text_structure.h"
 #include "common/util/file_util.h"
 #include "common/util/logging.h"
+#include "common/util/thread_pool.h"
 #include "verilog/analysis/verilog_analyzer.h"
 
 namespace verilog {
@@ -363,6 +366,30 @@ void VerilogProject::AddVirtualFile(absl::string_view resolved_filename,
   }
 }
 
+std::vector<absl::Status> VerilogProject::ParseAllFiles(int num_threads) {
+  std::vector<VerilogSourceFile *> to_parse;
+  for (auto &file : files_) {
+    if (!file.second->is_parsed()) to_parse.push_back(file.second.get());
+  }
+  if (to_parse.empty()) return {};
+
+  // Each file only modifies its own state while parsing.
+  verible::ThreadPool pool(std::min<int>(num_threads, to_parse.size()));
+  std::vector<std::future<absl::Status>> parse_results;
+  parse_results.reserve(to_parse.size());
+  for (VerilogSourceFile *file : to_parse) {
+    parse_results.push_back(
+        pool.ExecAsync<absl::Status>([file]() { return file->Parse(); }));
+  }
+
+  std::vector<absl::Status> results;
+  results.reserve(parse_results.size());
+  for (auto &result : parse_results) {
+    results.push_back(result.get());
+  }
+  return results;
+}
+
 const VerilogSourceFile *VerilogProject::LookupFileOrigin(
     absl::string_view content_substring) const {
   CHECK(content_index_) << "LookupFileOrigin() not enabled in constructor";
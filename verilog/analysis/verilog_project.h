@@ -321,6 +321,13 @@ class VerilogProject {
   // Returns relative path to the VerilogProject
   std::string GetRelativePathToSource(absl::string_view absolute_filepath);
 
+  // Parses all registered files that have not been parsed yet, distributing
+  // the work on up to "num_threads" threads (0: parse in the calling thread).
+  // Files are independent at this stage, so this is a good way to speed up
+  // the subsequent, sequential, symbol table building on large projects.
+  // Returns the parse status of each file that was parsed, in file order.
+  std::vector<absl::Status> ParseAllFiles(int num_threads);
+
   // Updates file from external source with an already parsed content.
   // (e.g. Language Server).
   // "parsed" needs to be a VerilogAnalyzer that is valid until the given
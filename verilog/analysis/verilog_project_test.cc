@@ -596,6 +596,71 @@ TEST(VerilogProjectTest, IncludeFileNotFound) {
   }
 }
 
+TEST(VerilogProjectTest, ParseAllFiles) {
+  const auto tempdir = ::testing::TempDir();
+  const std::string sources_dir = JoinPath(tempdir, "srcs");
+  EXPECT_TRUE(CreateDir(sources_dir).ok());
+  VerilogProject project(sources_dir, {});
+
+  constexpr int kNumFiles = 10;
+  std::vector<std::unique_ptr<ScopedTestFile>> files;
+  for (int i = 0; i < kNumFiles; ++i) {
+    // Every third file has a syntax error.
+    files.push_back(std::make_unique<ScopedTestFile>(
+        sources_dir, absl::StrCat("module m", i, (i % 3 == 0) ? "" : ";",
+                                  "\nendmodule\n")));
+    EXPECT_TRUE(
+        project.OpenTranslationUnit(Basename(files.back()->filename())).ok());
+  }
+
+  for (int threads : {0, 3}) {
+    SCOPED_TRACE(absl::StrCat("threads: ", threads));
+    const std::vector<absl::Status> statuses = project.ParseAllFiles(threads);
+    if (threads == 0) {
+      EXPECT_EQ(statuses.size(), kNumFiles);
+    } else {
+      EXPECT_TRUE(statuses.empty()) << "Already parsed files are skipped.";
+    }
+    for (const auto &file : files) {
+      const VerilogSourceFile *source =
+          project.LookupRegisteredFile(Basename(file->filename()));
+      ASSERT_NE(source, nullptr);
+      EXPECT_TRUE(source->is_parsed());
+      ASSERT_NE(source->GetTextStructure(), nullptr);
+      EXPECT_EQ(source->Status().ok(),
+                absl::StrContains(source->GetContent(), ";"));
+    }
+  }
+}
+
+TEST(VerilogProjectTest, ParseAllFilesInParallel) {
+  const auto tempdir = ::testing::TempDir();
+  const std::string sources_dir = JoinPath(tempdir, "parallel_srcs");
+  EXPECT_TRUE(CreateDir(sources_dir).ok());
+  VerilogProject project(sources_dir, {});
+
+  constexpr int kNumFiles = 20;
+  std::vector<std::unique_ptr<ScopedTestFile>> files;
+  for (int i = 0; i < kNumFiles; ++i) {
+    files.push_back(std::make_unique<ScopedTestFile>(
+        sources_dir, absl::StrCat("module m", i, ";\nendmodule\n")));
+    EXPECT_TRUE(
+        project.OpenTranslationUnit(Basename(files.back()->filename())).ok());
+  }
+
+  const std::vector<absl::Status> statuses = project.ParseAllFiles(4);
+  EXPECT_EQ(statuses.size(), kNumFiles);
+  for (const auto &status : statuses) {
+    EXPECT_TRUE(status.ok()) << status;
+  }
+  for (const auto &file : project) {
+    const TextStructureView *text_structure = file.second->GetTextStructure();
+    ASSERT_NE(text_structure, nullptr);
+    const auto *tree = ABSL_DIE_IF_NULL(text_structure->SyntaxTree().get());
+    EXPECT_EQ(FindAllModuleDeclarations(*tree).size(), 1);
+  }
+}
+
 TEST(VerilogProjectTest, AddVirtualFile) {
   const auto tempdir = ::testing::TempDir();
   const std::string sources_dir = JoinPath(tempdir, "srcs");
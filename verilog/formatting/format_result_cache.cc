@@ -0,0 +1,195 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/formatting/format_result_cache.h"
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "common/util/file_util.h"
+#include "common/util/sha256.h"
+#include "common/util/status_macros.h"
+#include "verilog/formatting/format_style.h"
+#include "verilog/formatting/formatter.h"
+
+namespace verilog {
+namespace formatter {
+
+// Identifies the format of cache entries; change when it changes.
+static constexpr absl::string_view kEntryHeader = "verible-format-result 1\n";
+
+// File name extensions of whole-file outputs and of markers of formatted
+// top-level constructs.
+static constexpr absl::string_view kOutputExtension = ".format";
+static constexpr absl::string_view kConstructExtension = ".construct";
+
+namespace {
+
+// Appends 'n' to 'key', followed by a space.
+void AppendNumber(int n, std::string* key) { absl::StrAppend(key, n, " "); }
+
+// Appends 's' to 'key', prefixed by its length, so that it doesn't run into
+// the next part.
+void AppendString(absl::string_view s, std::string* key) {
+  absl::StrAppend(key, s.size(), ":", s);
+}
+
+// Appends all fields of 'style' to 'key'.
+void AppendStyle(const FormatStyle& style, std::string* key) {
+  for (const int field : {
+           style.indentation_spaces,
+           style.wrap_spaces,
+           style.column_limit,
+           style.over_column_limit_penalty,
+           style.line_break_penalty,
+           static_cast<int>(style.port_declarations_indentation),
+           static_cast<int>(style.port_declarations_alignment),
+           static_cast<int>(style.struct_union_members_alignment),
+           static_cast<int>(style.named_parameter_indentation),
+           static_cast<int>(style.named_parameter_alignment),
+           static_cast<int>(style.named_port_indentation),
+           static_cast<int>(style.named_port_alignment),
+           static_cast<int>(style.module_net_variable_alignment),
+           static_cast<int>(style.assignment_statement_alignment),
+           static_cast<int>(style.enum_assignment_statement_alignment),
+           static_cast<int>(style.formal_parameters_indentation),
+           static_cast<int>(style.formal_parameters_alignment),
+           static_cast<int>(style.class_member_variable_alignment),
+           static_cast<int>(style.case_items_alignment),
+           static_cast<int>(style.distribution_items_alignment),
+           static_cast<int>(
+               style.port_declarations_right_align_packed_dimensions),
+           static_cast<int>(
+               style.port_declarations_right_align_unpacked_dimensions),
+           static_cast<int>(style.try_wrap_long_lines),
+           static_cast<int>(style.expand_coverpoints),
+           static_cast<int>(style.compact_indexing_and_selections),
+           static_cast<int>(style.wrap_end_else_clauses),
+       }) {
+    AppendNumber(field, key);
+  }
+}
+
+}  // namespace
+
+FormatResultCache::FormatResultCache(absl::string_view directory,
+                                     absl::string_view version)
+    : directory_(directory), version_(version) {}
+
+std::string FormatResultCache::Key(absl::string_view contents,
+                                   const FormatStyle& style,
+                                   const ExecutionControl& control) const {
+  std::string key;
+  AppendString(kEntryHeader, &key);
+  AppendString(version_, &key);
+  AppendStyle(style, &key);
+  // Outputs of searches that ran out of states are not stored, but more
+  // states could have completed searches that failed with fewer.
+  AppendNumber(control.max_search_states, &key);
+  AppendNumber(control.verify_convergence, &key);
+  AppendString(contents, &key);
+  return verible::Sha256Hex(key);
+}
+
+std::string FormatResultCache::ConstructKey(absl::string_view text,
+                                            const FormatStyle& style) const {
+  std::string key;
+  AppendString(kEntryHeader, &key);
+  AppendString(version_, &key);
+  AppendStyle(style, &key);
+  AppendString(text, &key);
+  return verible::Sha256Hex(key);
+}
+
+std::string FormatResultCache::EntryPath(absl::string_view key,
+                                         absl::string_view extension) const {
+  return verible::file::JoinPath(directory_, absl::StrCat(key, extension));
+}
+
+absl::StatusOr<std::string> FormatResultCache::Lookup(
+    absl::string_view key) const {
+  const std::string path = EntryPath(key, kOutputExtension);
+  absl::StatusOr<std::string> entry = verible::file::GetContentAsString(path);
+  if (!entry.ok()) {
+    return absl::NotFoundError(absl::StrCat("No format result for ", key));
+  }
+  absl::string_view text = *entry;
+  if (!absl::ConsumePrefix(&text, kEntryHeader)) {
+    return absl::NotFoundError(
+        absl::StrCat("Unusable format result in ", path));
+  }
+  return std::string(text);
+}
+
+absl::Status FormatResultCache::Store(absl::string_view key,
+                                      absl::string_view formatted) const {
+  return WriteEntry(key, kOutputExtension,
+                    absl::StrCat(kEntryHeader, formatted));
+}
+
+absl::Status FormatResultCache::WriteEntry(absl::string_view key,
+                                           absl::string_view extension,
+                                           absl::string_view contents) const {
+  RETURN_IF_ERROR(verible::file::CreateDir(directory_));
+
+  // Write under a name no other writer uses, then move it into place
+  // atomically, so that readers never see a partial entry.
+  const std::string path = EntryPath(key, extension);
+  const std::string temp_path = absl::StrCat(
+      path, ".", std::hash<std::thread::id>()(std::this_thread::get_id()),
+      "-", absl::ToUnixNanos(absl::Now()), ".tmp");
+  RETURN_IF_ERROR(verible::file::SetContents(temp_path, contents));
+  std::error_code error;
+  std::filesystem::rename(temp_path, path, error);
+  if (error) {
+    std::filesystem::remove(temp_path, error);
+    return absl::UnavailableError(
+        absl::StrCat("Can't store format result in ", path));
+  }
+  return absl::OkStatus();
+}
+
+bool FormatResultCache::Constructs::IsFormatted(absl::string_view construct) {
+  if (!verible::file::FileExists(
+           cache_.EntryPath(cache_.ConstructKey(construct, style_),
+                            kConstructExtension))
+           .ok()) {
+    return false;
+  }
+  any_formatted_ = true;
+  return true;
+}
+
+void FormatResultCache::Constructs::AddFormatted(absl::string_view construct) {
+  if (!status_.ok()) return;
+  const std::string key = cache_.ConstructKey(construct, style_);
+  if (verible::file::FileExists(cache_.EntryPath(key, kConstructExtension))
+          .ok()) {
+    return;
+  }
+  status_ = cache_.WriteEntry(key, kConstructExtension, "");
+}
+
+}  // namespace formatter
+}  // namespace verilog
@@ -0,0 +1,109 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VERIBLE_VERILOG_FORMATTING_FORMAT_RESULT_CACHE_H_
+#define VERIBLE_VERILOG_FORMATTING_FORMAT_RESULT_CACHE_H_
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "verilog/formatting/format_style.h"
+#include "verilog/formatting/formatter.h"
+
+namespace verilog {
+namespace formatter {
+
+// FormatResultCache keeps formatted texts in a directory, so that files that
+// did not change since they were last formatted don't need to be formatted
+// again, e.g. in pre-commit hooks.
+//
+// It works on two levels:
+//   * Whole files: the formatted output, keyed by the SHA-256 of the contents,
+//     the style, the execution controls that affect the output, and the
+//     version of the formatter.
+//   * Top-level constructs (modules, classes, packages, ...): markers for
+//     constructs that are known to be formatted, i.e. that were part of a
+//     formatter output, keyed likewise by their text. Formatting can skip
+//     those, and only format the rest of a file that was edited.
+//
+// Lookups and stores may happen concurrently, from several threads or
+// processes: entries are written to a temporary file first, which is then
+// renamed into place.
+class FormatResultCache {
+ public:
+  // 'directory' is created when the first entry is stored.
+  // 'version' identifies the formatter build, so that outputs of other
+  // versions, possibly formatted differently, are not reused.
+  FormatResultCache(absl::string_view directory, absl::string_view version);
+
+  const std::string& directory() const { return directory_; }
+
+  // Returns the key of formatting all of 'contents' with 'style' and
+  // 'control'.
+  std::string Key(absl::string_view contents, const FormatStyle& style,
+                  const ExecutionControl& control) const;
+
+  // Returns the formatted text stored under 'key', or a NotFound error if
+  // there is none.
+  absl::StatusOr<std::string> Lookup(absl::string_view key) const;
+
+  // Stores 'formatted' text under 'key'.
+  absl::Status Store(absl::string_view key, absl::string_view formatted) const;
+
+  // The top-level constructs of a cache that are formatted with a style,
+  // for FormatVerilog().
+  class Constructs : public FormattedConstructs {
+   public:
+    Constructs(const FormatResultCache& cache, const FormatStyle& style)
+        : cache_(cache), style_(style) {}
+
+    bool IsFormatted(absl::string_view construct) final;
+    void AddFormatted(absl::string_view construct) final;
+
+    // Returns true if any construct was found to be formatted.
+    bool any_formatted() const { return any_formatted_; }
+
+    // Returns the first error of storing a construct.
+    const absl::Status& status() const { return status_; }
+
+   private:
+    const FormatResultCache& cache_;
+    const FormatStyle& style_;
+    bool any_formatted_ = false;
+    absl::Status status_;
+  };
+
+ private:
+  // Returns the key of top-level construct 'text' formatted with 'style'.
+  std::string ConstructKey(absl::string_view text,
+                           const FormatStyle& style) const;
+
+  // Writes 'contents' to the file of 'key' with 'extension'.
+  absl::Status WriteEntry(absl::string_view key, absl::string_view extension,
+                          absl::string_view contents) const;
+
+  // Returns the path of the entry of 'key' with 'extension'.
+  std::string EntryPath(absl::string_view key,
+                        absl::string_view extension) const;
+
+  const std::string directory_;
+  const std::string version_;
+};
+
+}  // namespace formatter
+}  // namespace verilog
+
+#endif  // VERIBLE_VERILOG_FORMATTING_FORMAT_RESULT_CACHE_H_
@@ -0,0 +1,159 @@
+// Copyright 2017-2023 The Verible Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "verilog/formatting/format_result_cache.h"
+
+#include <sstream>
+#include <string>
+
+#include "absl/status/status.h"
+#include "common/util/file_util.h"
+#include "gtest/gtest.h"
+#include "verilog/formatting/format_style.h"
+#include "verilog/formatting/formatter.h"
+
+namespace verilog {
+namespace formatter {
+namespace {
+
+class FormatResultCacheTest : public testing::Test {
+ protected:
+  FormatResultCacheTest()
+      : directory_(verible::file::JoinPath(
+            testing::TempDir(),
+            verible::file::testing::RandomFileBasename("format-result-cache"))),
+        cache_(directory_, "test-version") {}
+
+  const std::string directory_;
+  const FormatResultCache cache_;
+  const FormatStyle style_;
+  const ExecutionControl control_;
+};
+
+TEST_F(FormatResultCacheTest, MissWithoutEntry) {
+  const std::string key = cache_.Key("module m;", style_, control_);
+  EXPECT_EQ(cache_.Lookup(key).status().code(), absl::StatusCode::kNotFound);
+}
+
+TEST_F(FormatResultCacheTest, StoreAndLookup) {
+  const std::string key = cache_.Key("module   m;endmodule", style_, control_);
+  ASSERT_TRUE(cache_.Store(key, "module m;\nendmodule\n").ok());
+  const auto found = cache_.Lookup(key);
+  ASSERT_TRUE(found.ok()) << found.status();
+  EXPECT_EQ(*found, "module m;\nendmodule\n");
+}
+
+TEST_F(FormatResultCacheTest, KeyDependsOnInputs) {
+  const std::string key = cache_.Key("module m;", style_, control_);
+  EXPECT_EQ(key, cache_.Key("module m;", style_, control_));
+  EXPECT_NE(key, cache_.Key("module n;", style_, control_));
+
+  FormatStyle other_style = style_;
+  other_style.column_limit = 40;
+  EXPECT_NE(key, cache_.Key("module m;", other_style, control_));
+  other_style = style_;
+  other_style.wrap_end_else_clauses = !style_.wrap_end_else_clauses;
+  EXPECT_NE(key, cache_.Key("module m;", other_style, control_));
+
+  ExecutionControl other_control = control_;
+  other_control.max_search_states = 10;
+  EXPECT_NE(key, cache_.Key("module m;", style_, other_control));
+  // Only affects how fast the output is found.
+  other_control = control_;
+  other_control.wrap_search_threads = 4;
+  EXPECT_EQ(key, cache_.Key("module m;", style_, other_control));
+
+  const FormatResultCache other_version(directory_, "other-version");
+  EXPECT_NE(key, other_version.Key("module m;", style_, control_));
+}
+
+TEST_F(FormatResultCacheTest, RecordsFormattedConstructs) {
+  FormatResultCache::Constructs constructs(cache_, style_);
+  std::ostringstream formatted;
+  ASSERT_TRUE(FormatVerilog("module   m ;\nendmodule\n"
+                            "module n;\nendmodule\n",
+                            "<file>", style_, formatted, {}, control_,
+                            &constructs)
+                  .ok());
+  EXPECT_EQ(formatted.str(),
+            "module m;\nendmodule\n"
+            "module n;\nendmodule\n");
+  EXPECT_FALSE(constructs.any_formatted());
+  EXPECT_TRUE(constructs.status().ok()) << constructs.status();
+
+  FormatResultCache::Constructs known(cache_, style_);
+  EXPECT_TRUE(known.IsFormatted("module m;\nendmodule"));
+  EXPECT_TRUE(known.IsFormatted("module n;\nendmodule"));
+  EXPECT_FALSE(known.IsFormatted("module   m ;\nendmodule"));
+  EXPECT_TRUE(known.any_formatted());
+
+  // With another style, no construct is known to be formatted.
+  FormatStyle other_style = style_;
+  other_style.indentation_spaces = 4;
+  FormatResultCache::Constructs other(cache_, other_style);
+  EXPECT_FALSE(other.IsFormatted("module m;\nendmodule"));
+}
+
+TEST_F(FormatResultCacheTest, LeavesFormattedConstructs) {
+  FormatResultCache::Constructs constructs(cache_, style_);
+  constructs.AddFormatted("module   n ;\nendmodule");
+
+  // Known constructs are skipped regardless of their position.
+  std::ostringstream formatted;
+  ASSERT_TRUE(FormatVerilog("module   m ;\nendmodule\n"
+                            "module   n ;\nendmodule\n",
+                            "<file>", style_, formatted, {}, control_,
+                            &constructs)
+                  .ok());
+  EXPECT_EQ(formatted.str(),
+            "module m;\nendmodule\n"
+            "module   n ;\nendmodule\n");
+  EXPECT_TRUE(constructs.any_formatted());
+}
+
+TEST_F(FormatResultCacheTest, SkipsDisabledConstructs) {
+  FormatResultCache::Constructs constructs(cache_, style_);
+  std::ostringstream formatted;
+  ASSERT_TRUE(FormatVerilog("// verilog_format: off\n"
+                            "module   m ;\nendmodule\n"
+                            "// verilog_format: on\n"
+                            "module   n ;\nendmodule\n",
+                            "<file>", style_, formatted, {}, control_,
+                            &constructs)
+                  .ok());
+  EXPECT_EQ(formatted.str(),
+            "// verilog_format: off\n"
+            "module   m ;\nendmodule\n"
+            "// verilog_format: on\n"
+            "module n;\nendmodule\n");
+
+  // Module m is left as it is, not formatted.
+  FormatResultCache::Constructs known(cache_, style_);
+  EXPECT_FALSE(known.IsFormatted("module   m ;\nendmodule"));
+  EXPECT_TRUE(known.IsFormatted("module n;\nendmodule"));
+}
+
+TEST_F(FormatResultCacheTest, SkipsConstructsSharingLines) {
+  FormatResultCache::Constructs constructs(cache_, style_);
+  std::ostringstream formatted;
+  ASSERT_TRUE(FormatVerilog("module m;\nendmodule  // m\n", "<file>", style_,
+                            formatted, {}, control_, &constructs)
+                  .ok());
+  FormatResultCache::Constructs known(cache_, style_);
+  EXPECT_FALSE(known.IsFormatted("module m;\nendmodule"));
+}
+
+}  // namespace
+}  // namespace formatter
+}  // namespace verilog
@@ -116,7 +116,9 @@ struct FormatStyle : public verible::BasicFormatStyle {
   // Split with a \n end and else clauses
   bool wrap_end_else_clauses = false;
 
-  // -- Note: when adding new fields, add them in format_style_init.cc
+  // -- Note: when adding new fields, add them in format_style_init.cc, and
+  //    in the key of format_result_cache.cc (which also covers the fields of
+  //    BasicFormatStyle).
 
   // TODO(fangism): introduce the following knobs:
   //
@@ -15,9 +15,11 @@
 #include "verilog/formatting/formatter.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -38,6 +40,8 @@
 #include "common/strings/line_column_map.h"
 #include "common/strings/position.h"
 #include "common/strings/range.h"
+#include "common/text/concrete_syntax_tree.h"
+#include "common/text/symbol.h"
 #include "common/text/text_structure.h"
 #include "common/text/token_info.h"
 #include "common/text/tree_utils.h"
@@ -47,6 +51,7 @@
 #include "common/util/logging.h"
 #include "common/util/range.h"
 #include "common/util/spacer.h"
+#include "common/util/thread_pool.h"
 #include "common/util/tree_operations.h"
 #include "common/util/vector_tree.h"
 #include "common/util/vector_tree_iterators.h"
@@ -94,6 +99,11 @@ class Formatter {
 
   void SelectLines(const LineNumberSet& lines);
 
+  // Returns the ranges of text that are left as they are: those disabled by
+  // comment directives, and those outside of the selected lines. Complete
+  // after Format().
+  const ByteOffsetSet& DisabledRanges() const { return disabled_ranges_; }
+
   // Outputs all of the FormattedExcerpt lines to stream.
   // If "include_disabled" is false, does not contain the disabled ranges.
   void Emit(bool include_disabled, std::ostream& stream) const;
@@ -114,16 +124,19 @@ class Formatter {
 };
 
 // TODO(b/148482625): make this public/re-usable for general content comparison.
-Status VerifyFormatting(const verible::TextStructureView& text_structure,
-                        absl::string_view formatted_output,
-                        absl::string_view filename) {
+// If not null, 'formatted_analysis' receives the analysis of the formatted
+// output, when it is verified.
+Status VerifyFormatting(
+    const verible::TextStructureView& text_structure,
+    absl::string_view formatted_output, absl::string_view filename,
+    std::unique_ptr<VerilogAnalyzer>* formatted_analysis = nullptr) {
   // Verify that the formatted output creates the same lexical
   // stream (filtered) as the original.  If any tokens were lost, fall back to
   // printing the original source unformatted.
   // Note: We cannot just Tokenize() and compare because Analyze()
   // performs additional transformations like expanding MacroArgs to
   // expression subtrees.
-  const auto reanalyzer = VerilogAnalyzer::AnalyzeAutomaticMode(
+  auto reanalyzer = VerilogAnalyzer::AnalyzeAutomaticMode(
       formatted_output, filename, verilog::VerilogPreprocess::Config());
   const auto relex_status = ABSL_DIE_IF_NULL(reanalyzer)->LexStatus();
   const auto reparse_status = reanalyzer->ParseStatus();
@@ -159,6 +172,9 @@ Status VerifyFormatting(const verible::TextStructureView& text_structure,
     }
   }
 
+  if (formatted_analysis != nullptr) {
+    *formatted_analysis = std::move(reanalyzer);
+  }
   return absl::OkStatus();
 }
 
@@ -205,6 +221,28 @@ static Status ReformatVerilog(absl::string_view original_text,
                                       convergence_control);
 }
 
+// When formatting whole-file (no --lines are specified), ensure that
+// the formatting transformation is convergent after one iteration.
+//   format(format(text)) == format(text)
+static Status VerifyConvergence(absl::string_view text,
+                                absl::string_view formatted_text,
+                                absl::string_view filename,
+                                const FormatStyle& style,
+                                const LineNumberSet& lines,
+                                const ExecutionControl& control) {
+  if (!control.verify_convergence) return absl::OkStatus();
+  std::ostringstream reformat_stream;
+  if (auto reformat_status = ReformatVerilog(
+          text, formatted_text, filename, style, reformat_stream, lines,
+          control);
+      !reformat_status.ok()) {
+    return reformat_status;
+  }
+  const std::string& reformatted_text(reformat_stream.str());
+  return verible::ReformatMustMatch(text, lines, formatted_text,
+                                    reformatted_text);
+}
+
 static absl::StatusOr<std::unique_ptr<VerilogAnalyzer>> ParseWithStatus(
     absl::string_view text, absl::string_view filename) {
   std::unique_ptr<VerilogAnalyzer> analyzer =
@@ -229,11 +267,117 @@ static absl::StatusOr<std::unique_ptr<VerilogAnalyzer>> ParseWithStatus(
   return analyzer;
 }
 
-absl::Status FormatVerilog(const verible::TextStructureView& text_structure,
-                           absl::string_view filename, const FormatStyle& style,
-                           std::string* formatted_text,
-                           const verible::LineNumberSet& lines,
-                           const ExecutionControl& control) {
+// Returns the texts of the top-level constructs of 'text_structure', in
+// order. Items of the description list that have no text are empty.
+static std::vector<absl::string_view> TopLevelConstructs(
+    const verible::TextStructureView& text_structure) {
+  std::vector<absl::string_view> constructs;
+  const verible::ConcreteSyntaxTree& root = text_structure.SyntaxTree();
+  if (root == nullptr || root->Kind() != verible::SymbolKind::kNode) {
+    return constructs;
+  }
+  const verible::SyntaxTreeNode& descriptions =
+      verible::SymbolCastToNode(*root);
+  if (!descriptions.MatchesTag(NodeEnum::kDescriptionList)) return constructs;
+  for (const verible::SymbolPtr& item : descriptions.children()) {
+    constructs.push_back(item == nullptr ? absl::string_view()
+                                         : verible::StringSpanOfSymbol(*item));
+  }
+  return constructs;
+}
+
+// Returns true if 'construct' in 'text' spans whole lines, and more than one.
+// Single lines are cheap to format, and constructs sharing lines with other
+// code are not formatted independently.
+static bool SpansWholeLines(absl::string_view construct,
+                            absl::string_view text) {
+  if (construct.empty() || !verible::IsSubRange(construct, text)) return false;
+  const size_t begin = construct.begin() - text.begin();
+  const size_t end = begin + construct.length();
+  const bool starts_line = begin == 0 || text[begin - 1] == '\n';
+  const bool ends_line = end == text.length() || text[end] == '\n';
+  return starts_line && ends_line &&
+         construct.find('\n') != absl::string_view::npos;
+}
+
+// Returns the lines of 'text_structure' to format: all lines except those of
+// top-level constructs that are known to be formatted. The result is never
+// empty, because an empty set would select all lines; if all lines are known
+// to be formatted, it only has the line past the end of the text. Returns an
+// empty set if no construct is known to be formatted.
+static LineNumberSet LinesOfUnformattedConstructs(
+    const verible::TextStructureView& text_structure,
+    FormattedConstructs* constructs) {
+  const absl::string_view text = text_structure.Contents();
+  const verible::LineColumnMap& line_column_map =
+      text_structure.GetLineColumnMap();
+  // 1-based, up to the line past the end, so that the set stays non-empty.
+  const int num_lines = line_column_map.GetBeginningOfLineOffsets().size();
+  LineNumberSet lines;
+  lines.Add({1, num_lines + 2});
+
+  bool any_formatted = false;
+  for (const absl::string_view construct : TopLevelConstructs(text_structure)) {
+    if (!SpansWholeLines(construct, text) ||
+        !constructs->IsFormatted(construct)) {
+      continue;
+    }
+    any_formatted = true;
+    const int begin = construct.begin() - text.begin();
+    const int end = construct.end() - text.begin();
+    lines.Difference({line_column_map.LineAtOffset(begin) + 1,
+                      line_column_map.LineAtOffset(end - 1) + 2});
+  }
+  if (!any_formatted) return {};
+  return lines;
+}
+
+// Returns the top-level constructs of 'formatted', the output of formatting
+// 'original', that were formatted, i.e. whose corresponding construct of
+// 'original' has no part in 'disabled_ranges'. Formatting only changes
+// spacing, so the constructs of both texts correspond one to one. The
+// results are parts of 'formatted_text', the contents of 'formatted'.
+static std::vector<absl::string_view> FormattedConstructsOfOutput(
+    const verible::TextStructureView& original,
+    const ByteOffsetSet& disabled_ranges,
+    const verible::TextStructureView& formatted,
+    absl::string_view formatted_text) {
+  std::vector<absl::string_view> result;
+  const std::vector<absl::string_view> original_constructs =
+      TopLevelConstructs(original);
+  const std::vector<absl::string_view> formatted_constructs =
+      TopLevelConstructs(formatted);
+  if (original_constructs.size() != formatted_constructs.size()) return result;
+
+  const absl::string_view original_text = original.Contents();
+  for (size_t i = 0; i < original_constructs.size(); ++i) {
+    const absl::string_view construct = original_constructs[i];
+    if (construct.empty() || !verible::IsSubRange(construct, original_text)) {
+      continue;
+    }
+    const int begin = construct.begin() - original_text.begin();
+    const int end = begin + construct.length();
+    const auto disabled = disabled_ranges.LowerBound(begin);
+    if (disabled != disabled_ranges.end() && disabled->first < end) continue;
+
+    const absl::string_view output = formatted_constructs[i];
+    if (SpansWholeLines(output, formatted.Contents())) {
+      result.push_back(formatted_text.substr(
+          output.begin() - formatted.Contents().begin(), output.length()));
+    }
+  }
+  return result;
+}
+
+// Formats 'text_structure' and verifies the output, like FormatVerilog().
+// If not null, 'formatted_constructs' receives the formatted top-level
+// constructs of the output, as parts of '*formatted_text'.
+static Status FormatAndVerify(
+    const verible::TextStructureView& text_structure,
+    absl::string_view filename, const FormatStyle& style,
+    std::string* formatted_text, const verible::LineNumberSet& lines,
+    const ExecutionControl& control,
+    std::vector<absl::string_view>* formatted_constructs) {
   Formatter fmt(text_structure, style);
   fmt.SelectLines(lines);
 
@@ -259,44 +403,94 @@ absl::Status FormatVerilog(const verible::TextStructureView& text_structure,
   *formatted_text = output_buffer.str();
 
   // For now, unconditionally verify.
-  if (Status verify_status =
-          VerifyFormatting(text_structure, *formatted_text, filename);
+  std::unique_ptr<VerilogAnalyzer> formatted_analysis;
+  if (Status verify_status = VerifyFormatting(text_structure, *formatted_text,
+                                              filename, &formatted_analysis);
       !verify_status.ok()) {
     return verify_status;
   }
 
+  if (formatted_constructs != nullptr && format_status.ok()) {
+    *formatted_constructs = FormattedConstructsOfOutput(
+        text_structure, fmt.DisabledRanges(), formatted_analysis->Data(),
+        *formatted_text);
+  }
   return format_status;
 }
 
+absl::Status FormatVerilog(const verible::TextStructureView& text_structure,
+                           absl::string_view filename, const FormatStyle& style,
+                           std::string* formatted_text,
+                           const verible::LineNumberSet& lines,
+                           const ExecutionControl& control) {
+  return FormatAndVerify(text_structure, filename, style, formatted_text,
+                         lines, control, nullptr);
+}
+
 Status FormatVerilog(absl::string_view text, absl::string_view filename,
                      const FormatStyle& style, std::ostream& formatted_stream,
                      const LineNumberSet& lines,
-                     const ExecutionControl& control) {
+                     const ExecutionControl& control,
+                     FormattedConstructs* constructs) {
   const auto analyzer = ParseWithStatus(text, filename);
   if (!analyzer.ok()) return analyzer.status();
 
   const verible::TextStructureView& text_structure = analyzer->get()->Data();
+  if (!lines.empty() || control.AnyStop()) constructs = nullptr;
   std::string formatted_text;
-  Status format_status = FormatVerilog(text_structure, filename, style,
-                                       &formatted_text, lines, control);
+  std::vector<absl::string_view> formatted_constructs;
+  auto* const formatted_constructs_ptr =
+      constructs != nullptr ? &formatted_constructs : nullptr;
+  Status format_status;
+  LineNumberSet selected_lines = lines;
+  if (constructs != nullptr) {
+    selected_lines = LinesOfUnformattedConstructs(text_structure, constructs);
+  }
+  if (selected_lines != lines) {
+    // Skipping constructs only saves time; it must neither cause failures nor
+    // diagnostics that formatting the whole text wouldn't have. This includes
+    // the convergence check, so any failure of the attempt falls back to
+    // formatting the originally requested lines.
+    std::ostringstream diagnostics;
+    ExecutionControl skipping_control(control);
+    skipping_control.stream = &diagnostics;
+    format_status = FormatAndVerify(text_structure, filename, style,
+                                    &formatted_text, selected_lines,
+                                    skipping_control, formatted_constructs_ptr);
+    if (format_status.ok()) {
+      format_status = VerifyConvergence(text, formatted_text, filename, style,
+                                        selected_lines, skipping_control);
+    }
+    if (format_status.ok()) {
+      control.Stream() << diagnostics.str();
+    } else {
+      VLOG(1) << "Formatting " << filename
+              << " with known formatted constructs skipped failed, formatting "
+                 "all of it: "
+              << format_status.message();
+      selected_lines = lines;
+      formatted_text.clear();
+      formatted_constructs.clear();
+    }
+  }
+  if (selected_lines == lines) {
+    format_status =
+        FormatAndVerify(text_structure, filename, style, &formatted_text,
+                        lines, control, formatted_constructs_ptr);
+    if (format_status.ok()) {
+      format_status = VerifyConvergence(text, formatted_text, filename, style,
+                                        lines, control);
+    }
+  }
   // Commit formatted text to the output stream independent of status.
   formatted_stream << formatted_text;
   if (!format_status.ok()) return format_status;
 
-  // When formatting whole-file (no --lines are specified), ensure that
-  // the formatting transformation is convergent after one iteration.
-  //   format(format(text)) == format(text)
-  if (control.verify_convergence) {
-    std::ostringstream reformat_stream;
-    if (auto reformat_status =
-            ReformatVerilog(text, formatted_text, filename, style,
-                            reformat_stream, lines, control);
-        !reformat_status.ok()) {
-      return reformat_status;
-    }
-    const std::string& reformatted_text(reformat_stream.str());
-    return verible::ReformatMustMatch(text, lines, formatted_text,
-                                      reformatted_text);
+  // Only verified outputs tell which constructs are formatted.
+  if (constructs != nullptr) {
+    for (const absl::string_view construct : formatted_constructs) {
+      constructs->AddFormatted(construct);
+    }
   }
   return format_status;
 }
@@ -584,6 +778,51 @@ static std::vector<UnwrappedLine> MakeUnwrappedLinesWorklist(
   return unwrapped_lines;
 }
 
+// Searches the optimal line wrappings of each of 'uwlines' that is not
+// already formatted, into the slot of the same index of the result.
+// Lines are independent, so they are distributed over
+// 'control.wrap_search_threads' threads.
+static std::vector<std::vector<verible::FormattedExcerpt>>
+SearchLineWrapsOfLines(const std::vector<UnwrappedLine>& uwlines,
+                       const FormatStyle& style,
+                       const ExecutionControl& control) {
+  std::vector<std::vector<verible::FormattedExcerpt>> solutions(
+      uwlines.size());
+  std::atomic<size_t> next_line(0);
+  // Each worker takes the next line not yet taken, so that a few large
+  // partitions don't hold up the others. Returns the number of lines searched.
+  const std::function<size_t()> search_lines = [&]() {
+    size_t searched = 0;
+    for (size_t i = next_line++; i < uwlines.size(); i = next_line++) {
+      const UnwrappedLine& uwline = uwlines[i];
+      if (uwline.PartitionPolicy() == PartitionPolicyEnum::kAlreadyFormatted) {
+        continue;
+      }
+      solutions[i] =
+          verible::SearchLineWraps(uwline, style, control.max_search_states);
+      ++searched;
+    }
+    return searched;
+  };
+
+  const int threads = std::min<size_t>(
+      std::max(control.wrap_search_threads, 1), uwlines.size());
+  if (threads <= 1) {
+    search_lines();
+    return solutions;
+  }
+  verible::ThreadPool pool(threads);
+  std::vector<std::future<size_t>> workers;
+  workers.reserve(threads);
+  for (int i = 0; i < threads; ++i) {
+    workers.push_back(pool.ExecAsync<size_t>(search_lines));
+  }
+  for (auto& worker : workers) {
+    VLOG(4) << "Wrap search worker searched " << worker.get() << " lines.";
+  }
+  return solutions;
+}
+
 static void PrintLargestPartitions(
     std::ostream& stream, const TokenPartitionTree& token_partitions,
     size_t max_partitions, const verible::LineColumnMap& line_column_map,
@@ -917,13 +1156,17 @@ Status Formatter::Format(const ExecutionControl& control) {
       &unwrapper_data.preformatted_tokens);
 
   // For each UnwrappedLine: minimize total penalty of wrap/break decisions.
-  // TODO(fangism): This could be parallelized if results are written
-  // to their own 'slots'.
+  // The searches are independent, so they run first, possibly concurrently,
+  // each into its own slot. Aligning continuation comments depends on the
+  // preceding formatted lines, so that is done afterwards, in order.
+  const std::vector<std::vector<verible::FormattedExcerpt>> wrap_searches =
+      SearchLineWrapsOfLines(unwrapped_lines, style_, control);
   std::vector<const UnwrappedLine*> partially_formatted_lines;
   formatted_lines_.reserve(unwrapped_lines.size());
   ContinuationCommentAligner continuation_comment_aligner(
       text_structure_.GetLineColumnMap(), text_structure_.Contents());
-  for (const auto& uwline : unwrapped_lines) {
+  for (size_t i = 0; i < unwrapped_lines.size(); ++i) {
+    const UnwrappedLine& uwline = unwrapped_lines[i];
     // TODO(fangism): Use different formatting strategies depending on
     // uwline.PartitionPolicy().
     if (continuation_comment_aligner.HandleLine(uwline, &formatted_lines_)) {
@@ -933,9 +1176,8 @@ Status Formatter::Format(const ExecutionControl& control) {
       // line-wrapping, but instead accept the adjusted padded spacing.
       formatted_lines_.emplace_back(uwline);
     } else {
-      // In other case, default to searching for optimal line wrapping.
-      const auto optimal_solutions =
-          verible::SearchLineWraps(uwline, style_, control.max_search_states);
+      // In other case, default to the optimal line wrapping.
+      const auto& optimal_solutions = wrap_searches[i];
       if (control.show_equally_optimal_wrappings &&
           optimal_solutions.size() > 1) {
         verible::DisplayEquallyOptimalWrappings(control.Stream(), uwline,
@@ -50,6 +50,10 @@ struct ExecutionControl {
   // If this limit is exceeded, error out with a diagnostic message.
   int max_search_states = 10000;
 
+  // Number of threads searching line wraps of independent token partitions
+  // concurrently. With 1 or less, searches run in the calling thread.
+  int wrap_search_threads = 1;
+
   // If true, and not running in incremental format mode with lines specified,
   // format the formatted output one more time to compare and check for
   // convergence: format(format(text)) == format(text).
@@ -68,16 +72,39 @@ struct ExecutionControl {
   }
 };
 
+// Top-level constructs (modules, classes, packages, ...) that are known to
+// be formatted, so that FormatVerilog() can skip them, e.g. when they were
+// formatted in an earlier run. Only constructs that span whole lines, and
+// more than one, are considered.
+class FormattedConstructs {
+ public:
+  virtual ~FormattedConstructs() = default;
+
+  // Returns true if 'construct', the text of a top-level construct, is known
+  // to be formatted.
+  virtual bool IsFormatted(absl::string_view construct) = 0;
+
+  // Records that 'construct', the text of a top-level construct of a
+  // formatter output, is formatted.
+  virtual void AddFormatted(absl::string_view construct) = 0;
+};
+
 // Formats Verilog/SystemVerilog source code.
 // 'lines' controls which lines have formattting explicitly enabled.
 // If this is empty, interpret as all lines enabled for formatting.
 // Does verification of the resulting format (re-parse and compare) and
 // convergence test (if enabled in "control")
+// With 'constructs' and all lines enabled, top-level constructs that are
+// known to be formatted are left as they are, and the constructs of the
+// output that were formatted (i.e. not disabled by comment directives) are
+// added to 'constructs'. If formatting fails with skipped constructs, the
+// whole text is formatted again, and only its diagnostics are printed.
 absl::Status FormatVerilog(absl::string_view text, absl::string_view filename,
                            const FormatStyle& style,
                            std::ostream& formatted_stream,
                            const verible::LineNumberSet& lines = {},
-                           const ExecutionControl& control = {});
+                           const ExecutionControl& control = {},
+                           FormattedConstructs* constructs = nullptr);
 // Ditto, but with TextStructureView as input and std::string as output.
 // This does verification of the resulting format, but _no_ convergence test.
 absl::Status FormatVerilog(const verible::TextStructureView& text_structure,
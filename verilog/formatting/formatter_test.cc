@@ -15509,6 +15509,23 @@ TEST(FormatterEndToEndTest, VerilogFormatTest) {
   }
 }
 
+// Tests that searching line wraps concurrently yields the same results.
+TEST(FormatterEndToEndTest, ConcurrentLineWrapSearch) {
+  FormatStyle style;
+  style.column_limit = 40;
+  style.indentation_spaces = 2;
+  style.wrap_spaces = 4;
+  ExecutionControl control;
+  control.wrap_search_threads = 4;
+  for (const auto& test_case : kFormatterTestCases) {
+    std::ostringstream stream;
+    const auto status = FormatVerilog(test_case.input, "<filename>", style,
+                                      stream, kEnableAllLines, control);
+    EXPECT_OK(status) << status.message();
+    EXPECT_EQ(stream.str(), test_case.expected) << "code:\n" << test_case.input;
+  }
+}
+
 TEST(FormatterEndToEndTest, AutoInferAlignment) {
   static constexpr FormatterTestCase kTestCases[] = {
       {"", ""},
@@ -39,6 +39,13 @@ bool VerilogLexer::TokenIsError(const TokenInfo &token) const {
   return token.token_enum() == TK_OTHER;
 }
 
+bool VerilogLexer::InInitialState() const {
+  // Flex encodes start condition N as yy_start == 2 * N + 1 (zero before the
+  // first token); INITIAL is start condition 0. Nested states are pushed on
+  // the start condition stack.
+  return yy_start <= 1 && yy_start_stack_ptr == 0 && balance_ == 0;
+}
+
 bool VerilogLexer::KeepSyntaxTreeTokens(const TokenInfo &t) {
   switch (t.token_enum()) {
     case TK_COMMENT_BLOCK:  // fall-through
@@ -53,6 +53,11 @@ class VerilogLexer : public verible::FlexLexerAdapter<verilogFlexLexer> {
   // Filter predicate that can be used for testing and parsing.
   static bool KeepSyntaxTreeTokens(const verible::TokenInfo &);
 
+  // Returns true if the lexer is in its initial state, i.e. the next token
+  // is lexed exactly as if lexing had started at its position. Lexing can be
+  // restarted at such token boundaries (see VerilogLexedText).
+  bool InInitialState() const;
+
  private:
   // Main lexing function. Will be defined by Flex.
   int yylex() final;
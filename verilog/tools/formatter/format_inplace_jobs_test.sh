@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+# Copyright 2017-2023 The Verible Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Tests the --jobs flag of verible-verilog-format with --inplace and --verify.
+
+declare -r MY_EXPECT_FILE="${TEST_TMPDIR}/myexpect.txt"
+
+# Get tool from argument
+[[ "$#" == 1 ]] || {
+  echo "Expecting 1 positional argument, verible-verilog-format path."
+  exit 1
+}
+formatter="$(rlocation ${TEST_WORKSPACE}/$1)"
+
+cat >${MY_EXPECT_FILE} <<EOF
+module m;
+endmodule
+EOF
+
+# Will overwrite these files in-place.
+MY_OUTPUT_FILES=()
+for i in 1 2 3 4 5 6 7 8; do
+  MY_OUTPUT_FILE="${TEST_TMPDIR}/myoutput-${i}.txt"
+  cat >${MY_OUTPUT_FILE} <<EOF
+  module    m   ;endmodule
+EOF
+  MY_OUTPUT_FILES+=("${MY_OUTPUT_FILE}")
+done
+
+# Only some files need formatting: --verify must still report that.
+cp "${MY_EXPECT_FILE}" "${MY_OUTPUT_FILES[0]}"
+${formatter} --verify --jobs=3 "${MY_OUTPUT_FILES[@]}" && exit 1
+
+# Run formatter.
+${formatter} --inplace --jobs=3 "${MY_OUTPUT_FILES[@]}" || exit 2
+for f in "${MY_OUTPUT_FILES[@]}"; do
+  diff --strip-trailing-cr "${f}" "${MY_EXPECT_FILE}" || exit 3
+done
+
+${formatter} --verify --jobs=3 "${MY_OUTPUT_FILES[@]}" || exit 4
+
+echo "PASS"
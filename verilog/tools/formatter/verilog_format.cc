@@ -22,63 +22,43 @@
 //   0: stdout output can be used to replace original file
 //   nonzero: stdout output (if any) should be discarded
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <sstream>  // IWYU pragma: keep  // for ostringstream
 #include <string>   // for string, allocator, etc
+#include <thread>
 #include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/flags/usage.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
-#include "absl/strings/str_join.h"
-#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "common/strings/position.h"
 #include "common/util/file_util.h"
 #include "common/util/init_command_line.h"
 #include "common/util/interval_set.h"
+#include "common/util/line_ranges_flag.h"
+#include "common/util/logging.h"
+#include "common/util/thread_pool.h"
+#include "verilog/formatting/format_result_cache.h"
 #include "verilog/formatting/format_style.h"
 #include "verilog/formatting/format_style_init.h"
 #include "verilog/formatting/formatter.h"
 
 using absl::StatusCode;
 using verible::LineNumberSet;
+using verible::LineRanges;
 using verilog::formatter::ExecutionControl;
+using verilog::formatter::FormatResultCache;
 using verilog::formatter::FormatStyle;
 using verilog::formatter::FormatVerilog;
 
-// Pseudo-singleton, so that repeated flag occurrences accumulate values.
-//   --flag x --flag y yields [x, y]
-struct LineRanges {
-  // need to copy string, cannot just use string_view
-  using storage_type = std::vector<std::string>;
-  static storage_type values;
-};
-
-LineRanges::storage_type LineRanges::values;  // global initializer
-
-bool AbslParseFlag(absl::string_view flag_arg, LineRanges* /* unused */,
-                   std::string* error) {
-  auto& values = LineRanges::values;
-  // Pre-split strings, so that "--flag v1,v2" and "--flag v1 --flag v2" are
-  // equivalent.
-  const std::vector<absl::string_view> tokens = absl::StrSplit(flag_arg, ',');
-  values.reserve(values.size() + tokens.size());
-  for (const absl::string_view& token : tokens) {
-    // need to copy string, cannot just use string_view
-    values.emplace_back(token.begin(), token.end());
-  }
-  // Range validation done later.
-  return true;
-}
-
-std::string AbslUnparseFlag(LineRanges /* unused */) {
-  const auto& values = LineRanges::values;
-  return absl::StrJoin(values.begin(), values.end(), ",",
-                       absl::StreamFormatter());
-}
-
 // TODO(fangism): Provide -i alias, as it is canonical to many formatters
 ABSL_FLAG(bool, inplace, false,
           "If true, overwrite the input file on successful conditions.");
@@ -121,38 +101,50 @@ ABSL_FLAG(bool, show_equally_optimal_wrappings, false,
 ABSL_FLAG(int, max_search_states, 100000,
           "Limits the number of search states explored during "
           "line wrap optimization.");
+ABSL_FLAG(int, jobs, 1,
+          "Number of files to format concurrently. 0 uses all available "
+          "cores. Results are reported and written in the order the files "
+          "were given. With a single file, number of threads searching line "
+          "wraps of its independent token partitions.");
+ABSL_FLAG(std::string, cache_dir, "",
+          "Directory to keep formatted outputs in. Files that were formatted "
+          "before with the same contents and style are not formatted again, "
+          "and neither are unchanged top-level constructs of edited files. "
+          "Disabled if empty, and not used with --lines.");
 
 static std::ostream& FileMsg(absl::string_view filename) {
   std::cerr << filename << ": ";
   return std::cerr;
 }
 
-// TODO: Refactor and simplify
-static bool formatOneFile(absl::string_view filename,
-                          const LineNumberSet& lines_to_format,
-                          bool* any_changes) {
-  const bool inplace = absl::GetFlag(FLAGS_inplace);
-  const bool check_changes_only = absl::GetFlag(FLAGS_verify);
+// Everything computed for one file before anything is printed or written,
+// so that independent files can be formatted concurrently.
+struct FormatFileResult {
+  // Original file contents, or the error reading them.
+  absl::StatusOr<std::string> content;
+  absl::Status format_status;
+  std::string formatted_output;
+  // Diagnostic output of the formatter (--show_* flags), if buffered.
+  std::string diagnostics;
+};
+
+// Reads and formats a file, including convergence verification if requested.
+// Does not produce any output. If 'diagnostic_stream' is nullptr, formatter
+// diagnostics are collected in the result instead. Line wraps are searched
+// with 'wrap_search_threads' threads. With a 'cache', formatting is skipped
+// for contents and top-level constructs that were formatted before.
+static FormatFileResult FormatOneFileContent(
+    absl::string_view filename, const LineNumberSet& lines_to_format,
+    std::ostream* diagnostic_stream, int wrap_search_threads,
+    const FormatResultCache* cache) {
   const bool is_stdin = filename == "-";
   const auto& stdin_name = absl::GetFlag(FLAGS_stdin_name);
-  *any_changes = false;
-
-  if (inplace && is_stdin) {
-    FileMsg(filename)
-        << "--inplace is incompatible with stdin.  Ignoring --inplace "
-        << "and writing to stdout." << std::endl;
-  }
-
   const auto diagnostic_filename = is_stdin ? stdin_name : filename;
 
+  FormatFileResult result;
   // Read contents into memory first.
-  const absl::StatusOr<std::string> content_or =
-      verible::file::GetContentAsString(filename);
-  if (!content_or.ok()) {
-    // Not using FileMsg(): file status already has filename attached.
-    std::cerr << content_or.status().message() << std::endl;
-    return false;
-  }
+  result.content = verible::file::GetContentAsString(filename);
+  if (!result.content.ok()) return result;
 
   // TODO(fangism): When requesting --inplace, verify that file
   // is write-able, and fail-early if it is not.
@@ -160,11 +152,13 @@ static bool formatOneFile(absl::string_view filename,
   FormatStyle format_style;
   verilog::formatter::InitializeFromFlags(&format_style);
 
+  std::ostringstream diagnostics;
   // Handle special debugging modes.
   ExecutionControl formatter_control;
   {
     // execution control flags
-    formatter_control.stream = &std::cout;  // for diagnostics only
+    formatter_control.stream = diagnostic_stream ? diagnostic_stream
+                                                 : &diagnostics;
     formatter_control.show_largest_token_partitions =
         absl::GetFlag(FLAGS_show_largest_token_partitions);
     formatter_control.show_token_partition_tree =
@@ -175,20 +169,86 @@ static bool formatOneFile(absl::string_view filename,
         absl::GetFlag(FLAGS_show_equally_optimal_wrappings);
     formatter_control.max_search_states =
         absl::GetFlag(FLAGS_max_search_states);
+    formatter_control.wrap_search_threads = wrap_search_threads;
     formatter_control.verify_convergence =
         absl::GetFlag(FLAGS_verify_convergence);
   }
 
+  // Contents that were formatted before need no formatting at all.
+  const bool use_cache = cache != nullptr && lines_to_format.empty() &&
+                         !formatter_control.AnyStop();
+  std::string cache_key;
+  if (use_cache) {
+    cache_key = cache->Key(*result.content, format_style, formatter_control);
+    if (auto cached = cache->Lookup(cache_key); cached.ok()) {
+      result.formatted_output = *std::move(cached);
+      return result;
+    }
+  }
+
+  // Neither do top-level constructs that are known to be formatted.
+  std::optional<FormatResultCache::Constructs> constructs;
+  if (use_cache) constructs.emplace(*cache, format_style);
   std::ostringstream stream;
-  const auto format_status =
-      FormatVerilog(*content_or, diagnostic_filename, format_style, stream,
-                    lines_to_format, formatter_control);
+  result.format_status = FormatVerilog(
+      *result.content, diagnostic_filename, format_style, stream,
+      lines_to_format, formatter_control,
+      constructs.has_value() ? &*constructs : nullptr);
+  result.formatted_output = stream.str();
+  result.diagnostics = diagnostics.str();
+
+  if (use_cache && result.format_status.ok()) {
+    // Failing to cache only costs time on later runs.
+    absl::Status status = constructs->status();
+    if (status.ok()) status = cache->Store(cache_key, result.formatted_output);
+    if (status.ok() && result.formatted_output != *result.content &&
+        !constructs->any_formatted() && formatter_control.verify_convergence) {
+      // The whole output was verified to format to itself, e.g. when it is
+      // formatted again after being written in place.
+      status = cache->Store(
+          cache->Key(result.formatted_output, format_style, formatter_control),
+          result.formatted_output);
+    }
+    if (!status.ok()) {
+      VLOG(1) << "Format result of " << diagnostic_filename
+              << " not cached: " << status.message();
+    }
+  }
+  return result;
+}
 
-  const std::string& formatted_output(stream.str());
+// Prints or writes the result of FormatOneFileContent() according to
+// --inplace and --verify.
+// Returns false on failure; 'any_changes' is set if the file would change.
+static bool ReportFormatResult(absl::string_view filename,
+                               const FormatFileResult& result,
+                               bool* any_changes) {
+  const bool inplace = absl::GetFlag(FLAGS_inplace);
+  const bool check_changes_only = absl::GetFlag(FLAGS_verify);
+  const bool is_stdin = filename == "-";
+  *any_changes = false;
+
+  if (inplace && is_stdin) {
+    FileMsg(filename)
+        << "--inplace is incompatible with stdin.  Ignoring --inplace "
+        << "and writing to stdout." << std::endl;
+  }
+
+  if (!result.content.ok()) {
+    // Not using FileMsg(): file status already has filename attached.
+    std::cerr << result.content.status().message() << std::endl;
+    return false;
+  }
+  const std::string& content = *result.content;
+
+  std::cout << result.diagnostics;
+
+  const absl::Status& format_status = result.format_status;
+  const std::string& formatted_output = result.formatted_output;
   if (!format_status.ok()) {
     if (!inplace) {
       // Fall back to printing original content regardless of error condition.
-      std::cout << *content_or;
+      std::cout << content;
     }
     switch (format_status.code()) {
       case StatusCode::kCancelled:
@@ -210,7 +270,7 @@ static bool formatOneFile(absl::string_view filename,
   }
 
   // Check if the output is the same as the input.
-  *any_changes = (*content_or != formatted_output);
+  *any_changes = (content != formatted_output);
 
   // Don't output or write if --check is set.
   if (check_changes_only) {
@@ -278,13 +338,61 @@ int main(int argc, char** argv) {
     }
   }
 
+  std::unique_ptr<FormatResultCache> cache;
+  if (const std::string cache_dir = absl::GetFlag(FLAGS_cache_dir);
+      !cache_dir.empty()) {
+    cache = std::make_unique<FormatResultCache>(
+        cache_dir, verible::GetRepositoryVersion());
+  }
+
+  int jobs = absl::GetFlag(FLAGS_jobs);
+  if (jobs <= 0) jobs = std::max<int>(1, std::thread::hardware_concurrency());
+
+  // A single file gets all jobs for searching line wraps of its partitions.
+  const int wrap_search_threads = file_args.size() == 2 ? jobs : 1;
+  if (file_args.size() == 2) jobs = 1;
+
+  // With a single job, files are formatted in this thread (ThreadPool with
+  // zero threads executes synchronously) and diagnostics are streamed
+  // directly; each file is reported before the next one is formatted, so
+  // that its diagnostics don't interleave with the next file's. Otherwise
+  // files are formatted on the pool, and this thread reports and writes
+  // results in the order the files were given.
+  verible::ThreadPool pool(jobs > 1 ? jobs : 0);
+  std::ostream* const diagnostic_stream = jobs > 1 ? nullptr : &std::cout;
+  const size_t max_in_flight = jobs > 1 ? 2 * jobs : 1;
+  struct PendingFile {
+    absl::string_view filename;
+    std::future<FormatFileResult> result;
+  };
+  std::deque<PendingFile> pending;
+
   bool all_success = true;
   bool any_changes = false;
+  const auto report_oldest = [&]() {
+    PendingFile& oldest = pending.front();
+    bool file_changes = false;
+    all_success &=
+        ReportFormatResult(oldest.filename, oldest.result.get(), &file_changes);
+    any_changes |= file_changes;
+    pending.pop_front();
+  };
+
   // All positional arguments are file names.  Exclude program name.
   for (const absl::string_view filename :
        verible::make_range(file_args.begin() + 1, file_args.end())) {
-    all_success &= formatOneFile(filename, lines_to_format, &any_changes);
+    pending.push_back(
+        {filename, pool.ExecAsync<FormatFileResult>([filename, &lines_to_format,
+                                                     diagnostic_stream,
+                                                     wrap_search_threads,
+                                                     &cache]() {
+           return FormatOneFileContent(filename, lines_to_format,
+                                       diagnostic_stream, wrap_search_threads,
+                                       cache.get());
+         })});
+    while (pending.size() >= max_in_flight) report_oldest();
   }
+  while (!pending.empty()) report_oldest();
 
   int ret_val = 0;
   if (absl::GetFlag(FLAGS_verify)) {
@@ -230,6 +230,158 @@ status="$?"
   exit 1
 }
 
+################################################################################
+echo "=== Test --jobs reports in file order"
+
+JOBS_TEST_FILES=()
+for i in 1 2 3 4 5 6 7 8; do
+  JOBS_TEST_FILE="${TEST_TMPDIR}/jobs-lint-error-${i}.sv"
+  cat > "${JOBS_TEST_FILE}" <<EOF
+class	c${i};  // tabs
+endclass
+EOF
+  JOBS_TEST_FILES+=("${JOBS_TEST_FILE}")
+done
+
+"$lint_tool" --rules=no-tabs --jobs=1 "${JOBS_TEST_FILES[@]}" \
+    > /dev/null 2> "${MY_OUTPUT_FILE}.sequential"
+sequential_status="$?"
+
+"$lint_tool" --rules=no-tabs --jobs=4 "${JOBS_TEST_FILES[@]}" \
+    > /dev/null 2> "${MY_OUTPUT_FILE}.parallel"
+
+status="$?"
+[[ $status == $sequential_status ]] || {
+  echo "Expected exit code $sequential_status, but got $status"
+  exit 1
+}
+
+diff -u "${MY_OUTPUT_FILE}.sequential" "${MY_OUTPUT_FILE}.parallel" || {
+  echo "Expected --jobs=4 output to match --jobs=1 output."
+  exit 1
+}
+
+################################################################################
+echo "=== Test --output_format=jsonl"
+
+"$lint_tool" --rules=no-tabs --output_format=jsonl "$TEST_FILE" \
+    > /dev/null 2> "${MY_OUTPUT_FILE}.err"
+
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1, but got $status"
+  exit 1
+}
+
+grep -q '"column":6,"end_column":7,"end_line":1,' "${MY_OUTPUT_FILE}.err" &&
+    grep -q '"rule":"no-tabs",' "${MY_OUTPUT_FILE}.err" || {
+  echo "Expected a JSON line for the no-tabs violation, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+
+################################################################################
+echo "=== Test --max_violations_per_file and --max_violations_total"
+
+MANY_TABS_FILE="${TEST_TMPDIR}/many-tabs.sv"
+cat > "${MANY_TABS_FILE}" <<EOF
+class	c;  // tabs
+	int	a;
+	int	b;
+endclass
+EOF
+
+"$lint_tool" --ruleset=none --rules=no-tabs --max_violations_per_file=2 \
+    "$MANY_TABS_FILE" "$MANY_TABS_FILE" > /dev/null 2> "${MY_OUTPUT_FILE}.err"
+
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1, but got $status"
+  exit 1
+}
+[[ $(grep -c "no-tabs" "${MY_OUTPUT_FILE}.err") == 4 ]] || {
+  echo "Expected 2 violations per file, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+
+"$lint_tool" --ruleset=none --rules=no-tabs --max_violations_total=3 \
+    "$MANY_TABS_FILE" "$MANY_TABS_FILE" "$MANY_TABS_FILE" \
+    > /dev/null 2> "${MY_OUTPUT_FILE}.err"
+
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1, but got $status"
+  exit 1
+}
+[[ $(grep -c "no-tabs" "${MY_OUTPUT_FILE}.err") == 3 ]] || {
+  echo "Expected 3 violations in total, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+grep -q "Reached --max_violations_total=3" "${MY_OUTPUT_FILE}.err" || {
+  echo "Expected a message about skipped files, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+
+################################################################################
+echo "=== Test --lines and --lines_from_diff"
+
+"$lint_tool" --ruleset=none --rules=no-tabs --lines=2-3 \
+    "$MANY_TABS_FILE" > /dev/null 2> "${MY_OUTPUT_FILE}.err"
+
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1, but got $status"
+  exit 1
+}
+[[ $(grep -c "no-tabs" "${MY_OUTPUT_FILE}.err") == 2 ]] &&
+    ! grep -q ":1:[0-9]*: " "${MY_OUTPUT_FILE}.err" || {
+  echo "Expected violations on lines 2 and 3 only, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+
+"$lint_tool" --ruleset=none --rules=no-tabs --lines=2 \
+    "$MANY_TABS_FILE" "$MANY_TABS_FILE" > /dev/null 2>&1
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1 for --lines with several files, but got $status"
+  exit 1
+}
+
+DIFF_FILE_FOR_LINES="${TEST_TMPDIR}/many-tabs.diff"
+cat > "${DIFF_FILE_FOR_LINES}" <<EOF
+--- a/many-tabs.sv
++++ b/many-tabs.sv
+@@ -3,1 +3,1 @@
+-  int b;
++	int	b;
+--- a/unchanged.sv
++++ b/unchanged.sv
+@@ -1,1 +0,0 @@
+-	int	x;
+EOF
+cp "$MANY_TABS_FILE" "${TEST_TMPDIR}/unchanged.sv"
+
+(cd "${TEST_TMPDIR}" &&
+  "$lint_tool" --ruleset=none --rules=no-tabs \
+      --lines_from_diff="${DIFF_FILE_FOR_LINES}" many-tabs.sv unchanged.sv \
+      > /dev/null 2> "${MY_OUTPUT_FILE}.err")
+
+status="$?"
+[[ $status == 1 ]] || {
+  echo "Expected exit code 1, but got $status"
+  exit 1
+}
+[[ $(grep -c "no-tabs" "${MY_OUTPUT_FILE}.err") == 1 ]] &&
+    grep -q "many-tabs.sv:3:" "${MY_OUTPUT_FILE}.err" || {
+  echo "Expected violations on the added line only, but got:"
+  cat "${MY_OUTPUT_FILE}.err"
+  exit 1
+}
+
 ################################################################################
 echo "=== Test module filename rule for stdin"
 
@@ -19,22 +19,35 @@
 // verilog_lint files...
 
 #include <algorithm>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>  // IWYU pragma: keep  // for ostringstream
 #include <string>   // for string, allocator, etc
+#include <thread>
 #include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "common/analysis/lint_profile.h"
+#include "common/analysis/lint_rule_status.h"
 #include "common/analysis/violation_handler.h"
+#include "common/strings/patch.h"
+#include "common/strings/position.h"
 #include "common/util/enum_flags.h"
 #include "common/util/file_util.h"
 #include "common/util/init_command_line.h"
+#include "common/util/line_ranges_flag.h"
 #include "common/util/logging.h"  // for operator<<, LOG, LogMessage, etc
+#include "common/util/thread_pool.h"
+#include "verilog/analysis/lint_result_cache.h"
 #include "verilog/analysis/verilog_linter.h"
 #include "verilog/analysis/verilog_linter_configuration.h"
 
@@ -75,6 +88,70 @@ bool AbslParseFlag(absl::string_view text, AutofixMode* mode,
   return AutofixModeEnumStringMap().Parse(text, mode, error, "--autofix value");
 }
 
+// Format in which lint violations are reported.
+enum class OutputFormat {
+  kText,       // Human readable messages
+  kJsonLines,  // One JSON object per line
+};
+
+static const verible::EnumNameMap<OutputFormat>& OutputFormatEnumStringMap() {
+  static const verible::EnumNameMap<OutputFormat> kOutputFormatEnumStringMap({
+      {"text", OutputFormat::kText},
+      {"jsonl", OutputFormat::kJsonLines},
+  });
+  return kOutputFormatEnumStringMap;
+}
+
+std::ostream& operator<<(std::ostream& stream, OutputFormat format) {
+  return OutputFormatEnumStringMap().Unparse(format, stream);
+}
+
+std::string AbslUnparseFlag(const OutputFormat& format) {
+  std::ostringstream stream;
+  OutputFormatEnumStringMap().Unparse(format, stream);
+  return stream.str();
+}
+
+bool AbslParseFlag(absl::string_view text, OutputFormat* format,
+                   std::string* error) {
+  return OutputFormatEnumStringMap().Parse(text, format, error,
+                                           "--output_format value");
+}
+
+// Format of the lint rule profile, if any.
+enum class ProfileRulesMode {
+  kNone,  // No profiling
+  kText,  // Human readable table
+  kJson,  // JSON object
+};
+
+static const verible::EnumNameMap<ProfileRulesMode>&
+ProfileRulesModeEnumStringMap() {
+  static const verible::EnumNameMap<ProfileRulesMode>
+      kProfileRulesModeEnumStringMap({
+          {"none", ProfileRulesMode::kNone},
+          {"text", ProfileRulesMode::kText},
+          {"json", ProfileRulesMode::kJson},
+      });
+  return kProfileRulesModeEnumStringMap;
+}
+
+std::ostream& operator<<(std::ostream& stream, ProfileRulesMode mode) {
+  return ProfileRulesModeEnumStringMap().Unparse(mode, stream);
+}
+
+std::string AbslUnparseFlag(const ProfileRulesMode& mode) {
+  std::ostringstream stream;
+  ProfileRulesModeEnumStringMap().Unparse(mode, stream);
+  return stream.str();
+}
+
+bool AbslParseFlag(absl::string_view text, ProfileRulesMode* mode,
+                   std::string* error) {
+  return ProfileRulesModeEnumStringMap().Parse(text, mode, error,
+                                               "--profile_rules value");
+}
+
 // LINT.IfChange
 
 ABSL_FLAG(bool, check_syntax, true,
@@ -105,14 +182,60 @@ ABSL_FLAG(std::string, autofix_output_file, "",
           "File to write a patch with autofixes to if "
           "--autofix=patch or --autofix=patch-interactive "
           "or a waiver file if --autofix=generate-waiver");
+ABSL_FLAG(OutputFormat, output_format, OutputFormat::kText,
+          "Format of the lint violations written to stderr; one of "
+          "[text|jsonl]. 'jsonl' writes one JSON object per violation and "
+          "line, for other tools to consume. Only applies to "
+          "--autofix=no.");
+ABSL_FLAG(int, jobs, 1,
+          "Number of files to lex, parse and lint concurrently. "
+          "0 uses all available cores. Output is always reported "
+          "in the order the files were given.");
+ABSL_FLAG(int, max_violations_total, 0,
+          "Stop linting once this many violations are reported over all "
+          "files; remaining files are skipped. 0 means no limit.");
+ABSL_FLAG(ProfileRulesMode, profile_rules, ProfileRulesMode::kNone,
+          "Measure wall time and number of calls per lint rule and per "
+          "linter phase, and report them, slowest first, after all files "
+          "are linted; one of [none|text|json]");
+ABSL_FLAG(std::string, profile_rules_output, "",
+          "File to write the --profile_rules report to; "
+          "stderr if empty.");
+ABSL_FLAG(std::string, cache_dir, "",
+          "Directory to keep lint results in. Files that were linted before "
+          "with the same contents, rules and waivers are not analyzed again. "
+          "Disabled if empty.");
+ABSL_FLAG(verible::LineRanges, lines, {},
+          "Specific lines to lint, 1-based, comma-separated, inclusive N-M "
+          "ranges, N is short for N-N. Only works for a single file. "
+          "By default, all lines are linted. (repeatable, cumulative)");
+ABSL_FLAG(std::string, lines_from_diff, "",
+          "Unified diff (e.g. from 'git diff') of which only the added lines "
+          "are linted. Files that are not changed by it are skipped.");
 
 // LINT.ThenChange(README.md)
 
+using verible::LineRanges;
 using verilog::LinterConfiguration;
 
 // LintOneFile returns 0, 1, or 2
 static const int kAutofixErrorExitStatus = 3;
 
+// Returns the lines added to 'filename' according to 'changed_lines', or
+// nullptr if it is not changed. Paths in diffs made by git carry a "b/"
+// prefix, unless it was made with --no-prefix.
+static const verible::LineNumberSet* FindChangedLines(
+    const verible::FileLineNumbersMap& changed_lines,
+    absl::string_view filename) {
+  absl::ConsumePrefix(&filename, "./");
+  for (const std::string& path : {std::string(filename),
+                                  absl::StrCat("b/", filename)}) {
+    const auto found = changed_lines.find(path);
+    if (found != changed_lines.end()) return &found->second;
+  }
+  return nullptr;
+}
+
 int main(int argc, char** argv) {
   const auto usage =
       absl::StrCat("usage: ", argv[0], " [options] <file> [<file>...]");
@@ -164,6 +287,13 @@ int main(int argc, char** argv) {
               << autofix_mode << std::endl;
   }
 
+  const OutputFormat output_format = absl::GetFlag(FLAGS_output_format);
+  if (output_format != OutputFormat::kText &&
+      autofix_mode != AutofixMode::kNo) {
+    std::cerr << "--output_format=" << output_format
+              << " has no effect for --autofix=" << autofix_mode << std::endl;
+  }
+
   const verible::ViolationFixer::AnswerChooser applyAllFixes =
       [](const verible::LintViolation&,
          absl::string_view) -> verible::ViolationFixer::Answer {
@@ -173,7 +303,12 @@ int main(int argc, char** argv) {
   std::unique_ptr<verible::ViolationHandler> violation_handler;
   switch (autofix_mode) {
     case AutofixMode::kNo:
-      violation_handler.reset(new verible::ViolationPrinter(&std::cerr));
+      if (output_format == OutputFormat::kJsonLines) {
+        violation_handler.reset(
+            new verible::ViolationJsonLinesPrinter(&std::cerr));
+      } else {
+        violation_handler.reset(new verible::ViolationPrinter(&std::cerr));
+      }
       break;
     case AutofixMode::kPatchInteractive:
       CHECK(autofix_output_stream);
@@ -198,25 +333,176 @@ int main(int argc, char** argv) {
       break;
   }
 
+  const bool check_syntax = absl::GetFlag(FLAGS_check_syntax);
+  const bool parse_fatal = absl::GetFlag(FLAGS_parse_fatal);
+  const bool lint_fatal = absl::GetFlag(FLAGS_lint_fatal);
+  const bool show_context = absl::GetFlag(FLAGS_show_diagnostic_context);
+  const ProfileRulesMode profile_mode = absl::GetFlag(FLAGS_profile_rules);
+  const bool profile = profile_mode != ProfileRulesMode::kNone;
+  verible::LintProfile lint_profile;
+
+  std::unique_ptr<verilog::LintResultCache> lint_cache;
+  if (const std::string cache_dir = absl::GetFlag(FLAGS_cache_dir);
+      !cache_dir.empty()) {
+    lint_cache = std::make_unique<verilog::LintResultCache>(
+        cache_dir, verible::GetRepositoryVersion());
+  }
+
+  // Lines to lint in all files (--lines), or per file (--lines_from_diff).
+  verible::LineNumberSet lines_to_lint;
+  if (!verible::ParseInclusiveRanges(
+          &lines_to_lint, LineRanges::values.begin(), LineRanges::values.end(),
+          &std::cerr, '-')) {
+    std::cerr << "Error parsing --lines." << std::endl;
+    std::cerr << "Got: --lines=" << AbslUnparseFlag(LineRanges()) << std::endl;
+    return 1;
+  }
+  if (!lines_to_lint.empty() && args.size() > 2) {
+    std::cerr << "--lines only works for single files." << std::endl;
+    return 1;
+  }
+  std::optional<verible::FileLineNumbersMap> changed_lines;
+  if (const std::string diff_file = absl::GetFlag(FLAGS_lines_from_diff);
+      !diff_file.empty()) {
+    if (!lines_to_lint.empty()) {
+      std::cerr << "--lines and --lines_from_diff can't be combined."
+                << std::endl;
+      return 1;
+    }
+    const absl::StatusOr<std::string> diff =
+        verible::file::GetContentAsString(diff_file);
+    verible::PatchSet patch_set;
+    const absl::Status status =
+        diff.ok() ? patch_set.Parse(*diff) : diff.status();
+    if (!status.ok()) {
+      std::cerr << "Error reading --lines_from_diff=" << diff_file << ": "
+                << status.message() << std::endl;
+      return 1;
+    }
+    // New files are linted entirely.
+    changed_lines = patch_set.AddedLinesMap(true);
+  }
+
+  int jobs = absl::GetFlag(FLAGS_jobs);
+  if (jobs <= 0) jobs = std::max<int>(1, std::thread::hardware_concurrency());
+  if (jobs > 1 && (autofix_mode == AutofixMode::kPatchInteractive ||
+                   autofix_mode == AutofixMode::kInplaceInteractive)) {
+    // Analysis could still run concurrently, but with a human answering
+    // questions for each file there is nothing to gain.
+    jobs = 1;
+  }
+
+  // With a single job, files are linted in this thread (ThreadPool with zero
+  // threads executes synchronously), strictly one after the other: each file
+  // is reported before the next one is analyzed. Otherwise, files are
+  // analyzed on the pool while this thread reports results in input order;
+  // the number of files in flight is bounded to limit memory held by
+  // finished results.
+  verible::ThreadPool pool(jobs > 1 ? jobs : 0);
+  const size_t max_in_flight = jobs > 1 ? 2 * jobs : 1;
+  struct PendingFile {
+    absl::string_view filename;
+    std::future<verilog::LintFileResult> result;
+  };
+  std::deque<PendingFile> pending;
+
+  // Violations that may still be reported with --max_violations_total.
+  const int max_violations_total = absl::GetFlag(FLAGS_max_violations_total);
+  size_t violations_left = std::max(0, max_violations_total);
+  const auto total_limit_reached = [&]() {
+    return max_violations_total > 0 && violations_left == 0;
+  };
+  size_t skipped_files = 0;
+
+  const auto report_oldest = [&]() {
+    PendingFile& oldest = pending.front();
+    verilog::LintFileResult result = oldest.result.get();
+    if (max_violations_total > 0) {
+      verible::KeepFirstViolations(violations_left, &result.rule_statuses);
+      for (const auto& status : result.rule_statuses) {
+        violations_left -= status.violations.size();
+      }
+    }
+    const int lint_status = verilog::ReportLintFileResult(
+        &std::cout, oldest.filename, result, violation_handler.get(),
+        check_syntax, parse_fatal, lint_fatal, show_context);
+    exit_status = std::max(lint_status, exit_status);
+    lint_profile.Merge(result.profile);
+    pending.pop_front();
+  };
+
   // All positional arguments are file names.  Exclude program name.
   for (const absl::string_view filename :
        verible::make_range(args.begin() + 1, args.end())) {
+    if (total_limit_reached()) {
+      ++skipped_files;
+      continue;
+    }
     // Copy configuration, so that it can be locally modified per file.
     auto config_status = verilog::LinterConfigurationFromFlags(filename);
     if (!config_status.ok()) {
+      // Keep diagnostics in file order.
+      while (!pending.empty()) report_oldest();
       std::cerr << config_status.status().message() << std::endl;
       exit_status = 1;
       continue;
     }
-    const LinterConfiguration& config = *config_status;
+    if (changed_lines.has_value()) {
+      const verible::LineNumberSet* lines =
+          FindChangedLines(*changed_lines, filename);
+      // Nothing was added to this file, e.g. only lines were removed.
+      if (lines == nullptr || lines->empty()) continue;
+      config_status->lines_to_lint = *lines;
+    } else {
+      config_status->lines_to_lint = lines_to_lint;
+    }
+    if (max_violations_total > 0) {
+      // No file can report more than what is left now, so it can stop
+      // linting there.
+      size_t& per_file = config_status->max_violations_per_file;
+      if (per_file == 0 || per_file > violations_left) {
+        per_file = violations_left;
+      }
+    }
 
-    const int lint_status = verilog::LintOneFile(
-        &std::cout, filename, config, violation_handler.get(),
-        absl::GetFlag(FLAGS_check_syntax), absl::GetFlag(FLAGS_parse_fatal),
-        absl::GetFlag(FLAGS_lint_fatal),
-        absl::GetFlag(FLAGS_show_diagnostic_context));
-    exit_status = std::max(lint_status, exit_status);
+    pending.push_back(
+        {filename, pool.ExecAsync<verilog::LintFileResult>(
+                       [filename, config = *std::move(config_status),
+                        check_syntax, parse_fatal, profile,
+                        cache = lint_cache.get()]() {
+                         return verilog::AnalyzeAndLintFile(
+                             filename, config, check_syntax, parse_fatal,
+                             profile, cache);
+                       })});
+    while (pending.size() >= max_in_flight) report_oldest();
   }  // for each file
+  while (!pending.empty()) report_oldest();
+  if (skipped_files > 0) {
+    std::cerr << "Reached --max_violations_total=" << max_violations_total
+              << ", skipped linting " << skipped_files << " file(s)."
+              << std::endl;
+  }
+
+  if (profile) {
+    const std::string profile_output_file =
+        absl::GetFlag(FLAGS_profile_rules_output);
+    std::ofstream profile_file;
+    std::ostream* profile_stream = &std::cerr;
+    if (!profile_output_file.empty()) {
+      profile_file.open(profile_output_file);
+      if (profile_file.good()) {
+        profile_stream = &profile_file;
+      } else {
+        LOG(ERROR) << "Failed to create/open profile output file: "
+                   << profile_output_file;
+      }
+    }
+    if (profile_mode == ProfileRulesMode::kJson) {
+      lint_profile.PrintJson(profile_stream);
+    } else {
+      lint_profile.PrintReport(profile_stream);
+    }
+  }
 
   return exit_status;
 }
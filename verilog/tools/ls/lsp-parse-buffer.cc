@@ -15,8 +15,14 @@
 
 #include "verilog/tools/ls/lsp-parse-buffer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -27,6 +33,7 @@
 #include "common/lsp/lsp-file-utils.h"
 #include "common/lsp/lsp-text-buffer.h"
 #include "common/util/logging.h"
+#include "common/util/thread_pool.h"
 
 namespace verilog {
 static absl::StatusOr<std::vector<verible::LintRuleStatus>> RunLinter(
@@ -46,13 +53,55 @@ static absl::StatusOr<std::vector<verible::LintRuleStatus>> RunLinter(
 }
 
 ParsedBuffer::ParsedBuffer(int64_t version, absl::string_view uri,
-                           absl::string_view content)
+                           absl::string_view content,
+                           const std::function<bool()> &cancelled)
+    : ParsedBuffer(version, uri, VerilogLexedText::Lex(content), cancelled) {}
+
+ParsedBuffer::ParsedBuffer(int64_t version, absl::string_view uri,
+                           std::shared_ptr<const VerilogLexedText> lexed,
+                           const std::function<bool()> &cancelled)
+    : ParsedBuffer(version, uri, lexed,
+                   verilog::VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
+                       lexed, uri, /*speculative=*/true),
+                   cancelled) {}
+
+static std::unique_ptr<verilog::VerilogAnalyzer> ReparseOrAnalyze(
+    const std::shared_ptr<const VerilogLexedText> &lexed,
+    absl::string_view uri, const ParsedBuffer &previous,
+    const verible::lsp::EditTextBuffer::ChangedRegion &changed) {
+  if (auto reparsed = verilog::VerilogAnalyzer::ReparseIncrementally(
+          previous.parser(), lexed, uri, changed.unchanged_prefix,
+          changed.unchanged_suffix)) {
+    return reparsed;
+  }
+  return verilog::VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
+      lexed, uri, /*speculative=*/true);
+}
+
+ParsedBuffer::ParsedBuffer(
+    int64_t version, absl::string_view uri,
+    std::shared_ptr<const VerilogLexedText> lexed, const ParsedBuffer &previous,
+    const verible::lsp::EditTextBuffer::ChangedRegion &changed,
+    const std::function<bool()> &cancelled)
+    : ParsedBuffer(version, uri, lexed,
+                   ReparseOrAnalyze(lexed, uri, previous, changed), cancelled) {
+}
+
+ParsedBuffer::ParsedBuffer(int64_t version, absl::string_view uri,
+                           std::shared_ptr<const VerilogLexedText> lexed,
+                           std::unique_ptr<verilog::VerilogAnalyzer> parser,
+                           const std::function<bool()> &cancelled)
     : version_(version),
       uri_(uri),
-      parser_(verilog::VerilogAnalyzer::AnalyzeAutomaticPreprocessFallback(
-          content, uri)) {
+      lexed_(std::move(lexed)),
+      parser_(std::move(parser)) {
   VLOG(1) << "Analyzed " << uri << " lex:" << parser_->LexStatus()
           << "; parser:" << parser_->ParseStatus() << std::endl;
+  if (cancelled && cancelled()) {
+    VLOG(1) << "Superseded " << uri << " version " << version
+            << "; skip linting" << std::endl;
+    return;
+  }
   // TODO(hzeller): should we use a filename not URI ?
   if (auto lint_result = RunLinter(uri, *parser_); lint_result.ok()) {
     lint_statuses_ = std::move(lint_result.value());
@@ -66,50 +115,181 @@ void BufferTracker::Update(const std::string &uri,
     return;  // Nothing to do (we don't really expect this to happen)
   }
   txt.RequestContent([&txt, &uri, this](absl::string_view content) {
-    current_.reset(new ParsedBuffer(txt.last_global_version(), uri, content));
+    Update(std::make_shared<ParsedBuffer>(txt.last_global_version(), uri,
+                                          content));
   });
+}
+
+void BufferTracker::Update(const std::shared_ptr<const ParsedBuffer> &parsed) {
+  current_ = parsed;
   if (current_->parsed_successfully()) {
     last_good_ = current_;
   }
 }
 
+BufferTrackerContainer::BufferTrackerContainer(int parse_threads)
+    : parse_pool_(new verible::ThreadPool(parse_threads)) {}
+
+// Out of line, as ThreadPool is only forward-declared in the header.
+BufferTrackerContainer::~BufferTrackerContainer() = default;
+
 verible::lsp::BufferCollection::UriBufferCallback
 BufferTrackerContainer::GetSubscriptionCallback() {
   return
       [this](const std::string &uri, const verible::lsp::EditTextBuffer *txt) {
-        // The Update() might replace, thus discard, old parsed buffers.
-        // However, the change listeners we're about to inform might
-        // expect them to be still alive while the update takes place.
-        // So hold on to them here until all updates are performed.
+        if (txt) {
+          ScheduleParse(uri, *txt);
+          // Without parse threads, this is where the freshly parsed
+          // buffer is picked up; otherwise whatever finished in the meantime.
+          ProcessCompletedParses();
+          return;
+        }
+
+        // The Remove() discards old parsed buffers. However, the change
+        // listeners we're about to inform might expect them to be still
+        // alive while the update takes place. So hold on to them here until
+        // all updates are performed.
         // (this copy is cheap as it is just reference counted pointers).
         BufferTracker remember_previous;
         if (const BufferTracker *tracker = FindBufferTrackerOrNull(uri)) {
           remember_previous = *tracker;
         }
+        Remove(uri);
+        for (const auto &change_listener : change_listeners_) {
+          change_listener(uri, nullptr);
+        }
+      };
+}
 
-        if (txt) {
-          const BufferTracker *tracker = Update(uri, *txt);
-          // Updated current() and last_good(); Now inform our listeners.
-          for (const auto &change_listener : change_listeners_) {
-            change_listener(uri, tracker);
-          }
+void BufferTrackerContainer::ScheduleParse(
+    const std::string &uri, const verible::lsp::EditTextBuffer &txt) {
+  const int64_t version = txt.last_global_version();
+  if (const BufferTracker *tracker = FindBufferTrackerOrNull(uri);
+      tracker && tracker->current() &&
+      tracker->current()->version() == version) {
+    LOG(DFATAL) << "Testing: Forgot to update version number ?";
+    return;  // Nothing to do (we don't really expect this to happen)
+  }
+
+  // Supersede all pending parses of this uri. Jobs that did not start yet
+  // return right away; none of them is waited for or processed anymore.
+  auto &latest = latest_version_[uri];
+  if (!latest) latest = std::make_shared<std::atomic<int64_t>>();
+  latest->store(version);
+  DropPendingParses(uri);
+
+  // The text buffer might change while we parse, so work on a copy.
+  // (shared_ptr, as the job needs to be copyable).
+  auto content = std::make_shared<std::string>();
+  txt.RequestContent([&content](absl::string_view c) {
+    content->assign(c.begin(), c.end());
+  });
+
+  // If we know what changed since the last parse, only re-lex and re-parse
+  // that part.
+  std::shared_ptr<const ParsedBuffer> previous;
+  std::optional<verible::lsp::EditTextBuffer::ChangedRegion> changed;
+  if (const BufferTracker *tracker = FindBufferTrackerOrNull(uri);
+      tracker && tracker->current()) {
+    changed = txt.ChangedRegionSince(tracker->current()->version());
+    if (changed) previous = tracker->current();
+  }
+
+  std::shared_ptr<const std::atomic<int64_t>> latest_version = latest;
+  std::function<std::shared_ptr<const ParsedBuffer>()> parse_job =
+      [uri, version, content, previous, changed, latest_version]() {
+        const std::function<bool()> superseded = [&]() {
+          return latest_version->load() != version;
+        };
+        std::shared_ptr<const ParsedBuffer> result;
+        if (superseded()) return result;  // Newer edit arrived while queued.
+        if (previous) {
+          auto lexed = VerilogLexedText::Relex(
+              *previous->lexed_text(), *content, changed->unchanged_prefix,
+              changed->unchanged_suffix);
+          result = std::make_shared<ParsedBuffer>(
+              version, uri, std::move(lexed), *previous, *changed, superseded);
         } else {
-          Remove(uri);
-          for (const auto &change_listener : change_listeners_) {
-            change_listener(uri, nullptr);
-          }
+          result = std::make_shared<ParsedBuffer>(
+              version, uri, VerilogLexedText::Lex(*content), superseded);
         }
+        if (superseded()) result.reset();
+        return result;
       };
+  pending_parses_.push_back({uri, version, parse_pool_->ExecAsync(parse_job)});
 }
 
-BufferTracker *BufferTrackerContainer::Update(
-    const std::string &uri, const verible::lsp::EditTextBuffer &txt) {
+void BufferTrackerContainer::ProcessCompletedParses() {
+  // First collect all that are done, as the listeners we inform while
+  // installing them should see a consistent pending_parses_.
+  std::vector<PendingParse> completed;
+  for (auto it = pending_parses_.begin(); it != pending_parses_.end();) {
+    if (it->result.wait_for(std::chrono::seconds(0)) ==
+        std::future_status::ready) {
+      completed.push_back(std::move(*it));
+      it = pending_parses_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (PendingParse &done : completed) {
+    InstallParse(done.uri, done.version, done.result.get());
+  }
+}
+
+void BufferTrackerContainer::WaitForPendingParses() {
+  for (const PendingParse &pending : pending_parses_) {
+    pending.result.wait();
+  }
+  ProcessCompletedParses();
+}
+
+void BufferTrackerContainer::WaitForPendingParses(const std::string &uri) {
+  for (const PendingParse &pending : pending_parses_) {
+    if (pending.uri == uri) pending.result.wait();
+  }
+  ProcessCompletedParses();
+}
+
+void BufferTrackerContainer::DropPendingParses(const std::string &uri) {
+  pending_parses_.erase(
+      std::remove_if(pending_parses_.begin(), pending_parses_.end(),
+                     [&uri](const PendingParse &p) { return p.uri == uri; }),
+      pending_parses_.end());
+}
+
+void BufferTrackerContainer::InstallParse(
+    const std::string &uri, int64_t version,
+    const std::shared_ptr<const ParsedBuffer> &parsed) {
+  const auto latest = latest_version_.find(uri);
+  if (!parsed || latest == latest_version_.end() ||
+      latest->second->load() != version) {
+    return;  // Superseded by a newer edit or the buffer has been closed.
+  }
+
+  // The Update() might replace, thus discard, old parsed buffers. Keep them
+  // alive while the listeners are informed (see GetSubscriptionCallback()).
   auto inserted = buffers_.insert({uri, nullptr});
   if (inserted.second) {
     inserted.first->second.reset(new BufferTracker());
   }
-  inserted.first->second->Update(uri, txt);
-  return inserted.first->second.get();
+  BufferTracker *tracker = inserted.first->second.get();
+  const BufferTracker remember_previous = *tracker;
+  tracker->Update(parsed);
+
+  // Updated current() and last_good(); Now inform our listeners.
+  for (const auto &change_listener : change_listeners_) {
+    change_listener(uri, tracker);
+  }
+}
+
+void BufferTrackerContainer::Remove(const std::string &uri) {
+  if (auto found = latest_version_.find(uri); found != latest_version_.end()) {
+    found->second->store(-1);  // Cancel everything still pending.
+    latest_version_.erase(found);
+  }
+  DropPendingParses(uri);
+  buffers_.erase(uri);
 }
 
 const BufferTracker *BufferTrackerContainer::FindBufferTrackerOrNull(
@@ -16,8 +16,11 @@
 #ifndef VERILOG_TOOLS_LS_LSP_PARSE_BUFFER_H
 #define VERILOG_TOOLS_LS_LSP_PARSE_BUFFER_H
 
+#include <atomic>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -27,6 +30,7 @@
 #include "common/lsp/lsp-text-buffer.h"
 #include "common/util/logging.h"
 #include "verilog/analysis/verilog_analyzer.h"
+#include "verilog/analysis/verilog_lexed_text.h"
 #include "verilog/analysis/verilog_linter.h"
 
 // ParseBuffer and BufferTrackerContainer are tracking fully parsed content
@@ -34,17 +38,38 @@
 // verible::lsp::BufferCollection that are responsible for tracking the
 // bare editor text.
 
+namespace verible {
+class ThreadPool;
+}  // namespace verible
+
 namespace verilog {
 // A parsed buffer collects all the artifacts generated from a text buffer
 // from parsing or running the linter.
 //
-// Right now, the ParsedBuffer is synchronously filling its internal structure
-// on construction, but plan is to do that on-demand and possibly with
-// std::future<>s evaluated in separate threads.
+// The ParsedBuffer is synchronously filling its internal structure on
+// construction; the BufferTrackerContainer decides in which thread that
+// happens.
 class ParsedBuffer {
  public:
+  // If "cancelled" is given and returns true after parsing, linting is
+  // skipped: the result is about to be thrown away anyway.
+  ParsedBuffer(int64_t version, absl::string_view uri,
+               absl::string_view content,
+               const std::function<bool()> &cancelled = nullptr);
+
+  // Same, with text that has already been lexed, e.g. incrementally
+  // re-lexed from a previous version.
+  ParsedBuffer(int64_t version, absl::string_view uri,
+               std::shared_ptr<const VerilogLexedText> lexed,
+               const std::function<bool()> &cancelled = nullptr);
+
+  // Same, with text that is the text of "previous" changed in the "changed"
+  // region. If possible, only the changed part is re-parsed.
   ParsedBuffer(int64_t version, absl::string_view uri,
-               absl::string_view content);
+               std::shared_ptr<const VerilogLexedText> lexed,
+               const ParsedBuffer &previous,
+               const verible::lsp::EditTextBuffer::ChangedRegion &changed,
+               const std::function<bool()> &cancelled = nullptr);
 
   bool parsed_successfully() const {
     return parser_->LexStatus().ok() && parser_->ParseStatus().ok();
@@ -58,9 +83,20 @@ class ParsedBuffer {
   int64_t version() const { return version_; }
   const std::string &uri() const { return uri_; }
 
+  // Lexer output, to incrementally re-lex the next version of the text.
+  const std::shared_ptr<const VerilogLexedText> &lexed_text() const {
+    return lexed_;
+  }
+
  private:
+  ParsedBuffer(int64_t version, absl::string_view uri,
+               std::shared_ptr<const VerilogLexedText> lexed,
+               std::unique_ptr<verilog::VerilogAnalyzer> parser,
+               const std::function<bool()> &cancelled);
+
   const int64_t version_;
   const std::string uri_;
+  const std::shared_ptr<const VerilogLexedText> lexed_;
   const std::unique_ptr<verilog::VerilogAnalyzer> parser_;
   std::vector<verible::LintRuleStatus> lint_statuses_;
 };
@@ -76,6 +112,10 @@ class BufferTracker {
   // re-parsing and updating our current() and potentially last_good().
   void Update(const std::string &uri, const verible::lsp::EditTextBuffer &txt);
 
+  // Update with an already parsed buffer, e.g. one that has been created
+  // in a background thread.
+  void Update(const std::shared_ptr<const ParsedBuffer> &parsed);
+
   // ---
   // Thread guarantee for the following functions.
   // As long as the caller (typically some operation) holds on to the returned
@@ -117,8 +157,23 @@ class BufferTracker {
 // This is the correspondent to verible::lsp::BufferCollection that
 // internally stores file content by uri. Here we keep parsed files per uri,
 // whenever we're informed of a change in the buffer collection.
+//
+// With parse threads, buffers are parsed and linted in the background, so that
+// typing in a large file does not block the JSON-RPC thread. Each change of
+// a buffer supersedes pending parses of the same uri: they are dropped, and
+// if they did not start yet they are skipped, if they are already running,
+// their linting is skipped. Thus, a burst of edits only results in the final
+// version being fully processed.
+// Results are handed to the BufferTrackers and change listeners only in
+// ProcessCompletedParses() or WaitForPendingParses(), so all of that still
+// happens in the caller's thread.
 class BufferTrackerContainer {
  public:
+  // Create a container parsing in "parse_threads" background threads. With
+  // zero threads, buffers are parsed synchronously whenever they change.
+  explicit BufferTrackerContainer(int parse_threads = 0);
+  ~BufferTrackerContainer();
+
   // Return a callback that allows to subscribe to an lsp::BufferCollection
   // to update our internal state whenever the editor state changes.
   // (internally, they exercise Update() and Remove())
@@ -143,17 +198,51 @@ class BufferTrackerContainer {
   // Given the URI, find the associated parse buffer if it exists.
   const BufferTracker *FindBufferTrackerOrNull(const std::string &uri) const;
 
+  // Returns true if there are parses that have not been processed yet.
+  bool HasPendingParses() const { return !pending_parses_.empty(); }
+
+  // Take the results of all finished background parses, update the buffer
+  // trackers and inform the change listeners. Does not block.
+  void ProcessCompletedParses();
+
+  // Wait until all pending parses are finished, then process them.
+  void WaitForPendingParses();
+
+  // Wait until the pending parses of "uri" are finished, then process all
+  // that are finished.
+  void WaitForPendingParses(const std::string &uri);
+
  private:
-  // Update internal state of the given "uri" with the content of the text
-  // buffer. Return the buffer tracker.
-  BufferTracker *Update(const std::string &uri,
-                        const verible::lsp::EditTextBuffer &txt);
+  struct PendingParse {
+    std::string uri;
+    int64_t version;
+    std::future<std::shared_ptr<const ParsedBuffer>> result;
+  };
+
+  // Schedule parsing of the content of the text buffer for the given "uri".
+  void ScheduleParse(const std::string &uri,
+                     const verible::lsp::EditTextBuffer &txt);
+
+  // Forget the pending parses of the given "uri", which got superseded.
+  void DropPendingParses(const std::string &uri);
+
+  // Update internal state of the given "uri" with a finished parse and
+  // inform the listeners; unless it has been superseded or the buffer closed.
+  void InstallParse(const std::string &uri, int64_t version,
+                    const std::shared_ptr<const ParsedBuffer> &parsed);
 
   // Remove the buffer tracker for the given "uri".
-  void Remove(const std::string &uri) { buffers_.erase(uri); }
+  void Remove(const std::string &uri);
 
   std::vector<ChangeCallback> change_listeners_;
   std::unordered_map<std::string, std::unique_ptr<BufferTracker>> buffers_;
+
+  // Latest version requested per uri. Shared with the parse jobs, so that
+  // they can check if they got superseded.
+  std::unordered_map<std::string, std::shared_ptr<std::atomic<int64_t>>>
+      latest_version_;
+  std::deque<PendingParse> pending_parses_;
+  std::unique_ptr<verible::ThreadPool> parse_pool_;
 };
 }  // namespace verilog
 #endif  // VERILOG_TOOLS_LS_LSP_PARSE_BUFFER_H
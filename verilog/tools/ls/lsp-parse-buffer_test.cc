@@ -15,12 +15,18 @@
 #include "verilog/tools/ls/lsp-parse-buffer.h"
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "common/lsp/lsp-text-buffer.h"
 #include "common/text/text_structure.h"
+#include "common/text/tree_compare.h"
 #include "gtest/gtest.h"
+#include "verilog/analysis/verilog_analyzer.h"
+#include "verilog/preprocessor/verilog_preprocess.h"
 
 namespace verilog {
 namespace {
@@ -124,5 +130,127 @@ TEST(BufferTrackerConatainer, ParseUpdateNotification) {
   EXPECT_EQ(update_remove_count, 1);
 }
 
+TEST(BufferTrackerConatainer, EditsAreRelexedIncrementally) {
+  BufferTrackerContainer container;
+  auto feed_callback = container.GetSubscriptionCallback();
+
+  std::string content;
+  for (int i = 0; i < 100; ++i) {
+    absl::StrAppend(&content, "module m", i, "; endmodule\n");
+  }
+  verible::lsp::EditTextBuffer doc(content);
+  doc.set_last_global_version(1);
+  feed_callback("foo.sv", &doc);
+
+  const verible::lsp::TextDocumentContentChangeEvent change = {
+      .range =
+          {
+              .start = {50, 10},
+              .end = {50, 10},
+          },
+      .has_range = true,
+      .text = "_renamed",
+  };
+  ASSERT_TRUE(doc.ApplyChange(change));
+  doc.set_last_global_version(2);
+  feed_callback("foo.sv", &doc);
+
+  const BufferTracker *tracker = container.FindBufferTrackerOrNull("foo.sv");
+  ASSERT_NE(tracker, nullptr);
+  const ParsedBuffer &parsed = *tracker->current();
+  EXPECT_EQ(parsed.version(), 2);
+  EXPECT_TRUE(parsed.parsed_successfully());
+  EXPECT_LT(parsed.lexed_text()->lexed_token_count(),
+            parsed.lexed_text()->tokens().size() / 10);
+  EXPECT_TRUE(absl::StrContains(parsed.parser().Data().Contents(),
+                                "module m50_renamed;"));
+
+  // Only the edited module has been re-parsed; still the same as a full parse.
+  const auto full = VerilogAnalyzer::AnalyzeAutomaticMode(
+      parsed.parser().Data().Contents(), "foo.sv", VerilogPreprocess::Config());
+  EXPECT_TRUE(verible::EqualTreesByEnumString(
+      full->SyntaxTree().get(), parsed.parser().SyntaxTree().get()));
+}
+
+TEST(BufferTrackerConatainer, BackgroundParseOnlyInstallsLatestVersion) {
+  BufferTrackerContainer container(/*parse_threads=*/2);
+
+  std::vector<int64_t> notified_versions;
+  container.AddChangeListener(
+      [&notified_versions](const std::string &, const BufferTracker *tracker) {
+        ASSERT_NE(tracker, nullptr);
+        notified_versions.push_back(tracker->current()->version());
+      });
+
+  // A burst of edits; each supersedes the previous ones.
+  auto feed_callback = container.GetSubscriptionCallback();
+  std::vector<std::unique_ptr<verible::lsp::EditTextBuffer>> edits;
+  for (int64_t version = 1; version <= 10; ++version) {
+    edits.emplace_back(new verible::lsp::EditTextBuffer(
+        absl::StrCat("module foo", version, "(); endmodule")));
+    edits.back()->set_last_global_version(version);
+    feed_callback("foo.sv", edits.back().get());
+  }
+
+  container.WaitForPendingParses();
+  EXPECT_FALSE(container.HasPendingParses());
+
+  // Whatever finished early, the last one to be seen is the latest version.
+  ASSERT_FALSE(notified_versions.empty());
+  EXPECT_EQ(notified_versions.back(), 10);
+
+  const BufferTracker *tracker = container.FindBufferTrackerOrNull("foo.sv");
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_EQ(tracker->current()->version(), 10);
+  EXPECT_TRUE(absl::StrContains(tracker->current()->parser().Data().Contents(),
+                                "module foo10"));
+  EXPECT_EQ(tracker->last_good().get(), tracker->current().get());
+}
+
+TEST(BufferTrackerConatainer, BackgroundParseWaitForUri) {
+  BufferTrackerContainer container(/*parse_threads=*/1);
+  auto feed_callback = container.GetSubscriptionCallback();
+  verible::lsp::EditTextBuffer foo_doc("module foo(); endmodule");
+  foo_doc.set_last_global_version(1);
+  feed_callback("foo.sv", &foo_doc);
+  verible::lsp::EditTextBuffer bar_doc("module bar(); endmodule");
+  bar_doc.set_last_global_version(2);
+  feed_callback("bar.sv", &bar_doc);
+
+  container.WaitForPendingParses("foo.sv");
+  const BufferTracker *tracker = container.FindBufferTrackerOrNull("foo.sv");
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_EQ(tracker->current()->version(), 1);
+
+  container.WaitForPendingParses();
+  EXPECT_NE(container.FindBufferTrackerOrNull("bar.sv"), nullptr);
+}
+
+TEST(BufferTrackerConatainer, BackgroundParseDiscardedOnRemove) {
+  BufferTrackerContainer container(/*parse_threads=*/1);
+  bool removed = false;
+  int updates_after_remove = 0;
+  container.AddChangeListener([&](const std::string &,
+                                  const BufferTracker *tracker) {
+    if (tracker == nullptr) {
+      removed = true;
+    } else if (removed) {
+      ++updates_after_remove;
+    }
+  });
+
+  auto feed_callback = container.GetSubscriptionCallback();
+  verible::lsp::EditTextBuffer foo_doc("module foo(); endmodule");
+  foo_doc.set_last_global_version(1);
+  feed_callback("foo.sv", &foo_doc);
+  feed_callback("foo.sv", nullptr);  // Closed, likely before parse finished.
+  EXPECT_TRUE(removed);
+  EXPECT_FALSE(container.HasPendingParses());  // Dropped, not waited for.
+
+  container.WaitForPendingParses();
+  EXPECT_EQ(updates_after_remove, 0);  // Late parse result not installed.
+  EXPECT_EQ(container.FindBufferTrackerOrNull("foo.sv"), nullptr);
+}
+
 }  // namespace
 }  // namespace verilog
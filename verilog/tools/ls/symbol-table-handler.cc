@@ -21,6 +21,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
@@ -115,12 +116,8 @@ void SymbolTableHandler::ParseProjectFiles() {
   // Parse all files separate from SymbolTable::Build() to report parse duration
   VLOG(1) << "Parsing project files...";
   const absl::Time start = absl::Now();
-  std::vector<absl::Status> results;
-  for (auto &unit : *curr_project_) {
-    VerilogSourceFile *const verilog_file = unit.second.get();
-    if (verilog_file->is_parsed()) continue;
-    results.emplace_back(verilog_file->Parse());
-  }
+  const std::vector<absl::Status> results =
+      curr_project_->ParseAllFiles(std::thread::hardware_concurrency());
   LogFullIfVLog(results);
 
   VLOG(1) << "VerilogSourceFile::Parse() for " << results.size()
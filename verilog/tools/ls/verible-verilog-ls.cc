@@ -21,6 +21,7 @@
 #include "verilog/tools/ls/verilog-language-server.h"
 
 #ifndef _WIN32
+#include <poll.h>
 #include <unistd.h>
 #else
 #include <fcntl.h>
@@ -54,7 +55,17 @@ int main(int argc, char *argv[]) {
   // Input: Messages received from the read function are dispatched and
   // processed until shutdown message received.
   constexpr int kInputFD = 0;  // STDIN_FILENO, but Win does not have that macro
-  absl::Status status = server.Run([](char *buf, int size) -> int {  //
+  absl::Status status = server.Run([&server](char *buf, int size) -> int {
+#ifndef _WIN32
+    // While buffers are parsed in the background, don't just block in read(),
+    // but publish their results (e.g. diagnostics) as soon as they are ready.
+    struct pollfd input;
+    input.fd = kInputFD;
+    input.events = POLLIN;
+    while (server.HasPendingParses() && poll(&input, 1, 50) == 0) {
+      server.ProcessCompletedParses();
+    }
+#endif
     return read(kInputFD, buf, size);
   });
 
@@ -33,14 +33,23 @@
 ABSL_FLAG(bool, variables_in_outline, true,
           "Variables should be included into the symbol outline");
 
+ABSL_FLAG(int, parse_threads, 1,
+          "Number of background threads parsing and linting edited buffers, "
+          "so that the server stays responsive while working on large "
+          "files. With 0, buffers are parsed synchronously on every change.");
+
 namespace verilog {
 
 VerilogLanguageServer::VerilogLanguageServer(const WriteFun &write_fun)
-    : dispatcher_(write_fun), text_buffers_(&dispatcher_) {
+    : dispatcher_(write_fun),
+      text_buffers_(&dispatcher_),
+      parsed_buffers_(absl::GetFlag(FLAGS_parse_threads)) {
   // All bodies the stream splitter extracts are pushed to the json dispatcher
   stream_splitter_.SetMessageProcessor(
       [this](absl::string_view header, absl::string_view body) {
-        return dispatcher_.DispatchMessage(body);
+        dispatcher_.DispatchMessage(body);
+        // Opportunity to publish whatever finished parsing in the meantime.
+        parsed_buffers_.ProcessCompletedParses();
       });
 
   // Whenever the text changes in the editor, reparse affected code.
@@ -97,14 +106,14 @@ void VerilogLanguageServer::SetRequestHandlers() {
                                   return InitializeRequestHandler(params);
                                 });
 
-  dispatcher_.AddRequestHandler(  // Provide diagnostics on request
+  AddRequestHandlerOnCompletedParses(  // Provide diagnostics on request
       "textDocument/diagnostic",
       [this](const verible::lsp::DocumentDiagnosticParams &p) {
         return verilog::GenerateDiagnosticReport(
             parsed_buffers_.FindBufferTrackerOrNull(p.textDocument.uri), p);
       });
 
-  dispatcher_.AddRequestHandler(  // Provide autofixes
+  AddRequestHandlerOnLatestParse(  // Provide autofixes
       "textDocument/codeAction",
       [this](const verible::lsp::CodeActionParams &p) {
         return verilog::GenerateCodeActions(
@@ -112,7 +121,7 @@ void VerilogLanguageServer::SetRequestHandlers() {
             parsed_buffers_.FindBufferTrackerOrNull(p.textDocument.uri), p);
       });
 
-  dispatcher_.AddRequestHandler(  // Provide document outline/index
+  AddRequestHandlerOnCompletedParses(  // Provide document outline/index
       "textDocument/documentSymbol",
       [this](const verible::lsp::DocumentSymbolParams &p) {
         // The `false` sets the kate workaround to the set default, as it was
@@ -122,37 +131,37 @@ void VerilogLanguageServer::SetRequestHandlers() {
             false, this->include_variables);
       });
 
-  dispatcher_.AddRequestHandler(  // Highlight related symbols under cursor
+  AddRequestHandlerOnCompletedParses(  // Highlight related symbols under cursor
       "textDocument/documentHighlight",
       [this](const verible::lsp::DocumentHighlightParams &p) {
         return verilog::CreateHighlightRanges(
             parsed_buffers_.FindBufferTrackerOrNull(p.textDocument.uri), p);
       });
 
-  dispatcher_.AddRequestHandler(  // format range of file
+  AddRequestHandlerOnLatestParse(  // format range of file
       "textDocument/rangeFormatting",
       [this](const verible::lsp::DocumentFormattingParams &p) {
         return verilog::FormatRange(
             parsed_buffers_.FindBufferTrackerOrNull(p.textDocument.uri), p);
       });
-  dispatcher_.AddRequestHandler(  // format entire file
+  AddRequestHandlerOnLatestParse(  // format entire file
       "textDocument/formatting",
       [this](const verible::lsp::DocumentFormattingParams &p) {
         return verilog::FormatRange(
             parsed_buffers_.FindBufferTrackerOrNull(p.textDocument.uri), p);
       });
-  dispatcher_.AddRequestHandler(  // go-to definition
+  AddRequestHandlerOnCompletedParses(  // go-to definition
       "textDocument/definition",
       [this](const verible::lsp::DefinitionParams &p) {
         return symbol_table_handler_.FindDefinitionLocation(p, parsed_buffers_);
       });
-  dispatcher_.AddRequestHandler(  // go-to references
+  AddRequestHandlerOnCompletedParses(  // go-to references
       "textDocument/references",
       [this](const verible::lsp::ReferenceParams &p) {
         return symbol_table_handler_.FindReferencesLocations(p,
                                                              parsed_buffers_);
       });
-  dispatcher_.AddRequestHandler(
+  AddRequestHandlerOnCompletedParses(
       "textDocument/prepareRename",
       [this](const verible::lsp::PrepareRenameParams &p) -> nlohmann::json {
         auto range = symbol_table_handler_.FindRenameableRangeAtCursor(
@@ -160,11 +169,13 @@ void VerilogLanguageServer::SetRequestHandlers() {
         if (range.has_value()) return range.value();
         return nullptr;
       });
-  dispatcher_.AddRequestHandler(
-      "textDocument/rename", [this](const verible::lsp::RenameParams &p) {
+  AddRequestHandlerOnLatestParse(
+      "textDocument/rename",
+      [this](const verible::lsp::RenameParams &p) {
         return symbol_table_handler_.FindRenameLocationsAndCreateEdits(
             p, parsed_buffers_);
-      });
+      },
+      /*all_documents=*/true);
   // The client sends a request to shut down. Use that to exit our loop.
   dispatcher_.AddRequestHandler("shutdown", [this](const nlohmann::json &) {
     shutdown_requested_ = true;
@@ -172,6 +183,42 @@ void VerilogLanguageServer::SetRequestHandlers() {
   });
 }
 
+void VerilogLanguageServer::AddRequestHandlerOnCompletedParses(
+    const std::string &method,
+    const verible::lsp::JsonRpcDispatcher::RPCCallHandler &handler) {
+  dispatcher_.AddRequestHandler(method,
+                                [this, handler](const nlohmann::json &params) {
+                                  parsed_buffers_.ProcessCompletedParses();
+                                  return handler(params);
+                                });
+}
+
+void VerilogLanguageServer::AddRequestHandlerOnLatestParse(
+    const std::string &method,
+    const verible::lsp::JsonRpcDispatcher::RPCCallHandler &handler,
+    bool all_documents) {
+  dispatcher_.AddRequestHandler(
+      method, [this, handler, all_documents](const nlohmann::json &params) {
+        const auto document = params.find("textDocument");
+        if (all_documents || document == params.end() ||
+            !document->contains("uri")) {
+          parsed_buffers_.WaitForPendingParses();
+        } else {
+          parsed_buffers_.WaitForPendingParses(
+              (*document)["uri"].get<std::string>());
+        }
+        return handler(params);
+      });
+}
+
+bool VerilogLanguageServer::HasPendingParses() const {
+  return parsed_buffers_.HasPendingParses();
+}
+
+void VerilogLanguageServer::ProcessCompletedParses() {
+  parsed_buffers_.ProcessCompletedParses();
+}
+
 absl::Status VerilogLanguageServer::Step(const ReadFun &read_fun) {
   return stream_splitter_.PullFrom(read_fun);
 }
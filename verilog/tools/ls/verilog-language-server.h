@@ -46,6 +46,15 @@ class VerilogLanguageServer {
   // Runs the Language Server, calling "read_fun" until we receive shutdown.
   absl::Status Run(const ReadFun &read_fun);
 
+  // Returns true if there are buffers being parsed in the background whose
+  // results have not been published yet.
+  bool HasPendingParses() const;
+
+  // Publish results of finished background parses (e.g. diagnostics).
+  // Happens after each message received anyway; call this when idle waiting
+  // for input to not delay them until the next message.
+  void ProcessCompletedParses();
+
   // Prints statistics of the current Language Server session.
   void PrintStatistics() const;
 
@@ -56,6 +65,22 @@ class VerilogLanguageServer {
   // Creates callbacks for requests from Language Server Client
   void SetRequestHandlers();
 
+  // Register request handler that first takes the results of finished
+  // background parses. It does not wait for pending ones: until they finish,
+  // it operates on the previous current() and last_good() buffers.
+  void AddRequestHandlerOnCompletedParses(
+      const std::string &method,
+      const verible::lsp::JsonRpcDispatcher::RPCCallHandler &handler);
+
+  // Register handler for a request that returns edits. It first waits for
+  // the pending parses of the request's document, or of all documents with
+  // "all_documents" (for edits across files), as edits computed from an
+  // outdated parse would corrupt the text the client has now.
+  void AddRequestHandlerOnLatestParse(
+      const std::string &method,
+      const verible::lsp::JsonRpcDispatcher::RPCCallHandler &handler,
+      bool all_documents = false);
+
   // The "initialize" method requests server capabilities.
   verible::lsp::InitializeResult InitializeRequestHandler(
       const verible::lsp::InitializeParams &params);
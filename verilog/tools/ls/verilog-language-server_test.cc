@@ -15,12 +15,15 @@
 #include "verilog/tools/ls/verilog-language-server.h"
 
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "absl/flags/declare.h"
 #include "absl/flags/flag.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -40,6 +43,8 @@
   else                                               \
     EXPECT_TRUE(status__.ok()) << status__
 
+ABSL_DECLARE_FLAG(int, parse_threads);
+
 namespace verilog {
 namespace {
 
@@ -121,6 +126,9 @@ class VerilogLanguageServerTest : public ::testing::Test {
   // sends textDocument/initialize request.
   // It stores the response in initialize_response field for further processing
   void SetUp() override {
+    // Parse synchronously, so that diagnostics are published right after
+    // the notification that changed the buffer.
+    absl::SetFlag(&FLAGS_parse_threads, 0);
     server_ = std::make_unique<VerilogLanguageServer>(
         [this](absl::string_view response) { response_stream_ << response; });
 
@@ -233,6 +241,114 @@ TEST_F(VerilogLanguageServerTest, SyntaxError) {
       << "No syntax error found";
 }
 
+// Splits concatenated responses into the individual json messages.
+static std::vector<json> ParseResponses(const std::string &responses) {
+  std::vector<json> result;
+  std::istringstream in(responses);
+  while ((in >> std::ws).peek() != std::char_traits<char>::eof()) {
+    json message;
+    in >> message;
+    result.push_back(message);
+  }
+  return result;
+}
+
+// With background parsing, requests are answered from the parses that
+// finished, without waiting for pending ones.
+TEST_F(VerilogLanguageServerTest, BackgroundParseRequestSeesCompletedParses) {
+  absl::SetFlag(&FLAGS_parse_threads, 2);
+  server_ = std::make_unique<VerilogLanguageServer>(
+      [this](absl::string_view response) { response_stream_ << response; });
+  ASSERT_OK(InitializeCommunication());
+  GetResponse();
+
+  const std::string wrong_file =
+      DidOpenRequest("file://syntaxerror.sv", "brokenfile");
+  ASSERT_OK(SendRequest(wrong_file)) << "process file with syntax error";
+  // Diagnostics might or might not be published yet.
+  std::vector<json> responses = ParseResponses(GetResponse());
+  while (server_->HasPendingParses()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    server_->ProcessCompletedParses();
+  }
+  for (const json &response : ParseResponses(GetResponse())) {
+    responses.push_back(response);
+  }
+
+  const absl::string_view diagnostic_request = R"(
+    {
+      "jsonrpc": "2.0", "id": 2, "method": "textDocument/diagnostic",
+      "params":
+      {
+        "textDocument": {"uri": "file://syntaxerror.sv"}
+      }
+    }
+  )";
+  ASSERT_OK(SendRequest(diagnostic_request));
+  for (const json &response : ParseResponses(GetResponse())) {
+    responses.push_back(response);
+  }
+
+  bool published = false;
+  bool answered = false;
+  for (const json &response : responses) {
+    if (response.contains("method")) {
+      EXPECT_EQ(response["method"], "textDocument/publishDiagnostics");
+      EXPECT_FALSE(answered) << "Diagnostics published after response";
+      published = true;
+    } else {
+      EXPECT_EQ(response["id"], 2) << "Invalid id";
+      EXPECT_TRUE(absl::StrContains(
+          response["result"]["items"][0]["message"].get<std::string>(),
+          "syntax error"))
+          << "No syntax error found";
+      answered = true;
+    }
+  }
+  EXPECT_TRUE(published);
+  EXPECT_TRUE(answered);
+}
+
+// Requests that return edits wait for pending parses of their document, as
+// edits of an outdated parse would corrupt the text.
+TEST_F(VerilogLanguageServerTest, BackgroundParseFormattingSeesLatestEdit) {
+  absl::SetFlag(&FLAGS_parse_threads, 2);
+  server_ = std::make_unique<VerilogLanguageServer>(
+      [this](absl::string_view response) { response_stream_ << response; });
+  ASSERT_OK(InitializeCommunication());
+  GetResponse();
+
+  ASSERT_OK(SendRequest(DidOpenRequest("file://fmt.sv", "module fmt();\n")));
+  while (server_->HasPendingParses()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    server_->ProcessCompletedParses();
+  }
+  GetResponse();
+
+  // Request formatting right after the edit, while it is still being parsed.
+  const absl::string_view change_request =
+      R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{"textDocument":{"uri":"file://fmt.sv"},"contentChanges":[{"range":{"start":{"character":0,"line":1},"end":{"character":0,"line":1}},"text":"assign a=1;\nendmodule\n"}]}})";
+  ASSERT_OK(SendRequest(change_request));
+  const absl::string_view formatting_request =
+      R"({"jsonrpc":"2.0", "id":35, "method":"textDocument/formatting","params":{"textDocument":{"uri":"file://fmt.sv"}}})";
+  ASSERT_OK(SendRequest(formatting_request));
+
+  bool answered = false;
+  for (const json &response : ParseResponses(GetResponse())) {
+    if (response.contains("method")) continue;  // Diagnostics.
+    EXPECT_EQ(response["id"], 35);
+    ASSERT_EQ(response["result"].size(), 1);
+    EXPECT_EQ(std::string(response["result"][0]["newText"]),
+              "module fmt ();\n  assign a = 1;\nendmodule\n");
+    EXPECT_EQ(
+        response["result"][0]["range"],
+        json::parse(
+            R"({"start":{"line":0, "character": 0}, "end":{"line":3, "character": 0}})"));
+    answered = true;
+  }
+  EXPECT_TRUE(answered);
+}
+
 // Tests diagnostics for file with linting error before and after fix
 TEST_F(VerilogLanguageServerTest, LintErrorDetection) {
   const std::string lint_error =
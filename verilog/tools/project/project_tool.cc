@@ -15,6 +15,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -130,6 +131,10 @@ struct ProjectSymbols {
   // Builds symbol table.
   void Build(std::vector<absl::Status> *build_statuses) {
     VLOG(1) << __FUNCTION__;
+    // Parse all files up-front in parallel; parse errors are recorded
+    // with each file and reported while building the symbol table.
+    project->ParseAllFiles(std::thread::hardware_concurrency());
+
     // For now, ingest files in the order they were listed.
     // Without conflicting definitions in files, this order should not matter.
     for (const auto &file : config.file_list.file_paths) {